@@ -36,33 +36,37 @@
 
 #include "driver_mlx90614_advance.h"
 
-static mlx90614_handle_t gs_handle;        /**< mlx90614 handle */
+static mlx90614_advance_sensor_t gs_sensor;        /**< mlx90614 sensor of the single sensor functions */
 
 /**
- * @brief  advance example init
- * @return status code
- *         - 0 success
- *         - 1 init failed
- * @note   none
+ * @brief     advance example link and init the handle
+ * @param[in] *sensor pointer to an advance sensor structure
+ * @param[in] *config pointer to an advance config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
  */
-uint8_t mlx90614_advance_init(void)
+static uint8_t a_mlx90614_advance_open(mlx90614_advance_sensor_t *sensor, const mlx90614_advance_config_t *config)
 {
     uint8_t res;
-    uint16_t reg;
+    mlx90614_handle_t *handle = &sensor->handle;
     
     /* link interface function */
-    DRIVER_MLX90614_LINK_INIT(&gs_handle, mlx90614_handle_t);
-    DRIVER_MLX90614_LINK_IIC_INIT(&gs_handle, mlx90614_interface_iic_init);
-    DRIVER_MLX90614_LINK_IIC_DEINIT(&gs_handle, mlx90614_interface_iic_deinit);
-    DRIVER_MLX90614_LINK_IIC_READ(&gs_handle, mlx90614_interface_iic_read);
-    DRIVER_MLX90614_LINK_IIC_WRITE(&gs_handle, mlx90614_interface_iic_write);
-    DRIVER_MLX90614_LINK_SCL_WRITE(&gs_handle, mlx90614_interface_scl_write);
-    DRIVER_MLX90614_LINK_SDA_WRITE(&gs_handle, mlx90614_interface_sda_write);
-    DRIVER_MLX90614_LINK_DELAY_MS(&gs_handle, mlx90614_interface_delay_ms);
-    DRIVER_MLX90614_LINK_DEBUG_PRINT(&gs_handle, mlx90614_interface_debug_print);
+    DRIVER_MLX90614_LINK_INIT(handle, mlx90614_handle_t);
+    DRIVER_MLX90614_LINK_IIC_INIT(handle, mlx90614_interface_iic_init);
+    DRIVER_MLX90614_LINK_IIC_DEINIT(handle, mlx90614_interface_iic_deinit);
+    DRIVER_MLX90614_LINK_IIC_READ(handle, mlx90614_interface_iic_read);
+    DRIVER_MLX90614_LINK_IIC_WRITE(handle, mlx90614_interface_iic_write);
+    DRIVER_MLX90614_LINK_SCL_WRITE(handle, mlx90614_interface_scl_write);
+    DRIVER_MLX90614_LINK_SDA_WRITE(handle, mlx90614_interface_sda_write);
+    DRIVER_MLX90614_LINK_DELAY_MS(handle, mlx90614_interface_delay_ms);
+    DRIVER_MLX90614_LINK_DEBUG_PRINT(handle, mlx90614_interface_debug_print);
+    sensor->config = *config;
+    sensor->start_path = MLX90614_START_PATH_FAST;
     
     /* set address */
-    res = mlx90614_set_addr(&gs_handle, MLX90614_ADDRESS_DEFAULT);
+    res = mlx90614_set_addr(handle, config->addr);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set addr failed.\n");
@@ -71,7 +75,7 @@ uint8_t mlx90614_advance_init(void)
     }
     
     /* mlx90614 init */
-    res = mlx90614_init(&gs_handle);
+    res = mlx90614_init(handle);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: init failed.\n");
@@ -79,134 +83,165 @@ uint8_t mlx90614_advance_init(void)
         return 1;
     }
     
-    /* pwm to smbus */
-    res = mlx90614_pwm_to_smbus(&gs_handle);
-    if (res != 0)
-    {
-        mlx90614_interface_debug_print("mlx90614: pwm to smbus failed.\n");
-        (void)(void)mlx90614_deinit(&gs_handle);
-        
-        return 1;
-    }
+    return 0;
+}
+
+/**
+ * @brief     advance example get the config1 register of the config
+ * @param[in] *config pointer to an advance config structure
+ * @return    config1 register
+ * @note      the config fields cover all 16 bits of config1
+ */
+static uint16_t a_mlx90614_advance_config1(const mlx90614_advance_config_t *config)
+{
+    uint16_t config1;
     
-    /* exit sleep mode */
-    res = mlx90614_exit_sleep_mode(&gs_handle);
+    config1 = (uint16_t)((uint16_t)config->iir & 0x7);                             /* bits 2:0 */
+    config1 |= (uint16_t)(((uint16_t)config->repeat_sensor_test & 0x1) << 3);      /* bit 3 */
+    config1 |= (uint16_t)(((uint16_t)config->mode & 0x3) << 4);                    /* bits 5:4 */
+    config1 |= (uint16_t)(((uint16_t)config->ir_sensor & 0x1) << 6);               /* bit 6 */
+    config1 |= (uint16_t)(((uint16_t)config->ks & 0x1) << 7);                      /* bit 7 */
+    config1 |= (uint16_t)(((uint16_t)config->fir_length & 0x7) << 8);              /* bits 10:8 */
+    config1 |= (uint16_t)(((uint16_t)config->gain & 0x7) << 11);                   /* bits 13:11 */
+    config1 |= (uint16_t)(((uint16_t)config->kt2 & 0x1) << 14);                    /* bit 14 */
+    config1 |= (uint16_t)(((uint16_t)config->sensor_test & 0x1) << 15);            /* bit 15 */
+    
+    return config1;
+}
+
+/**
+ * @brief     advance example write the settings of the config
+ * @param[in] *sensor pointer to an opened advance sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 provision failed
+ * @note      the handle is deinited on failure
+ */
+static uint8_t a_mlx90614_advance_provision(mlx90614_advance_sensor_t *sensor)
+{
+    uint8_t res;
+    uint16_t reg;
+    mlx90614_handle_t *handle = &sensor->handle;
+    const mlx90614_advance_config_t *config = &sensor->config;
+    
+    /* probe first, recover only when needed */
+    res = mlx90614_start(handle, &sensor->start_path);
     if (res != 0)
     {
-        mlx90614_interface_debug_print("mlx90614: exit sleep mode failed.\n");
-        (void)(void)mlx90614_deinit(&gs_handle);
+        mlx90614_interface_debug_print("mlx90614: start failed.\n");
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default fir length */
-    res = mlx90614_set_fir_length(&gs_handle, MLX90614_ADVANCE_DEFAULT_FIR_LENGTH);
+    /* set fir length */
+    res = mlx90614_set_fir_length(handle, config->fir_length);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set fir length failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default iir */
-    res = mlx90614_set_iir(&gs_handle, MLX90614_ADVANCE_DEFAULT_IIR);
+    /* set iir */
+    res = mlx90614_set_iir(handle, config->iir);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set iir failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default mode */
-    res = mlx90614_set_mode(&gs_handle, MLX90614_ADVANCE_DEFAULT_MODE);
+    /* set mode */
+    res = mlx90614_set_mode(handle, config->mode);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set mode failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default ir sensor */
-    res = mlx90614_set_ir_sensor(&gs_handle, MLX90614_ADVANCE_DEFAULT_IR_SENSOR);
+    /* set ir sensor */
+    res = mlx90614_set_ir_sensor(handle, config->ir_sensor);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set ir sensor failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default ks */
-    res = mlx90614_set_ks(&gs_handle, MLX90614_ADVANCE_DEFAULT_KS);
+    /* set ks */
+    res = mlx90614_set_ks(handle, config->ks);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set ks failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default kt2 */
-    res = mlx90614_set_kt2(&gs_handle, MLX90614_ADVANCE_DEFAULT_KT2);
+    /* set kt2 */
+    res = mlx90614_set_kt2(handle, config->kt2);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set kt2 failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default gain */
-    res = mlx90614_set_gain(&gs_handle, MLX90614_ADVANCE_DEFAULT_GAIN);
+    /* set gain */
+    res = mlx90614_set_gain(handle, config->gain);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set gain failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default sensor test */
-    res = mlx90614_set_sensor_test(&gs_handle, MLX90614_ADVANCE_DEFAULT_SENSOR_TEST);
+    /* set sensor test */
+    res = mlx90614_set_sensor_test(handle, config->sensor_test);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set sensor test failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default repeat sensor test */
-    res = mlx90614_set_repeat_sensor_test(&gs_handle, MLX90614_ADVANCE_DEFAULT_REPEAT_SENSOR_TEST);
+    /* set repeat sensor test */
+    res = mlx90614_set_repeat_sensor_test(handle, config->repeat_sensor_test);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set repeat sensor test failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
     /* convert emissivity correction coefficient */
-    res = mlx90614_emissivity_correction_coefficient_convert_to_register(&gs_handle, 
-                                                                         MLX90614_ADVANCE_DEFAULT_EMISSIVITY_CORRECTION_COEFFICIENT,
+    res = mlx90614_emissivity_correction_coefficient_convert_to_register(handle, 
+                                                                         config->emissivity,
                                                                         (uint16_t *)&reg);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: emissivity correction coefficient convert to register failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
     
-    /* set default emissivity correction coefficient */
-    res = mlx90614_set_emissivity_correction_coefficient(&gs_handle, reg);
+    /* set emissivity correction coefficient */
+    res = mlx90614_set_emissivity_correction_coefficient(handle, reg);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set emissivity correction coefficient failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
@@ -215,18 +250,142 @@ uint8_t mlx90614_advance_init(void)
 }
 
 /**
- * @brief  advance example deinit
- * @return status code
- *         - 0 success
- *         - 1 deinit failed
- * @note   none
+ * @brief      advance example fill a config with the default settings
+ * @param[out] *config pointer to an advance config structure
+ * @return     status code
+ *             - 0 success
+ * @note       none
  */
-uint8_t mlx90614_advance_deinit(void)
+uint8_t mlx90614_advance_config_default(mlx90614_advance_config_t *config)
+{
+    config->addr = MLX90614_ADVANCE_DEFAULT_ADDRESS;
+    config->fir_length = MLX90614_ADVANCE_DEFAULT_FIR_LENGTH;
+    config->iir = MLX90614_ADVANCE_DEFAULT_IIR;
+    config->mode = MLX90614_ADVANCE_DEFAULT_MODE;
+    config->ir_sensor = MLX90614_ADVANCE_DEFAULT_IR_SENSOR;
+    config->ks = MLX90614_ADVANCE_DEFAULT_KS;
+    config->kt2 = MLX90614_ADVANCE_DEFAULT_KT2;
+    config->gain = MLX90614_ADVANCE_DEFAULT_GAIN;
+    config->sensor_test = MLX90614_ADVANCE_DEFAULT_SENSOR_TEST;
+    config->repeat_sensor_test = MLX90614_ADVANCE_DEFAULT_REPEAT_SENSOR_TEST;
+    config->relay_pin = MLX90614_ADVANCE_DEFAULT_RELAY_PIN;
+    config->emissivity = MLX90614_ADVANCE_DEFAULT_EMISSIVITY_CORRECTION_COEFFICIENT;
+    
+    return 0;
+}
+
+/**
+ * @brief     advance example init one sensor
+ * @param[in] *sensor pointer to an advance sensor structure
+ * @param[in] *config pointer to an advance config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the config is copied into the sensor
+ */
+uint8_t mlx90614_advance_sensor_init(mlx90614_advance_sensor_t *sensor, const mlx90614_advance_config_t *config)
+{
+    /* open the handle */
+    if (a_mlx90614_advance_open(sensor, config) != 0)
+    {
+        return 1;
+    }
+    
+    /* write the settings */
+    return a_mlx90614_advance_provision(sensor);
+}
+
+/**
+ * @brief      advance example init one sensor with a device registry
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[in]  *config pointer to an advance config structure
+ * @param[in]  *registry pointer to an inited registry
+ * @param[out] *warm pointer to a warm start flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       a chip whose registry entry holds the config1 and emissivity of the config and still matches
+ *             the chip costs one read and keeps its eeprom untouched, otherwise the settings of the config
+ *             are written and the entry is refreshed
+ */
+uint8_t mlx90614_advance_sensor_init_with_registry(mlx90614_advance_sensor_t *sensor, const mlx90614_advance_config_t *config,
+                                                   mlx90614_registry_t *registry, mlx90614_bool_t *warm)
+{
+    uint8_t res;
+    uint8_t found;
+    uint8_t matched;
+    uint16_t emissivity;
+    mlx90614_registry_entry_t entry;
+    mlx90614_registry_entry_t known;
+    
+    *warm = MLX90614_BOOL_FALSE;
+    
+    /* open the handle */
+    if (a_mlx90614_advance_open(sensor, config) != 0)
+    {
+        return 1;
+    }
+    
+    /* the entry must hold the settings of this config */
+    found = (uint8_t)(mlx90614_registry_find_addr(registry, config->addr, &known) == 0);
+    res = mlx90614_emissivity_correction_coefficient_convert_to_register(&sensor->handle, config->emissivity, &emissivity);
+    matched = (uint8_t)((found != 0) && (res == 0) && (known.config1 == a_mlx90614_advance_config1(config)) &&
+                        (known.emissivity == emissivity));
+    
+    /* verify the known chip with one read */
+    if ((matched != 0) && (mlx90614_registry_verify(&sensor->handle, &known) == 0))
+    {
+        *warm = MLX90614_BOOL_TRUE;
+        
+        return 0;
+    }
+    
+    /* write the settings */
+    res = a_mlx90614_advance_provision(sensor);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* refresh the entry, the calibration offsets belong to the chip */
+    memset(&entry, 0, sizeof(entry));
+    res = mlx90614_registry_capture(&sensor->handle, &entry);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: registry capture failed.\n");
+        (void)mlx90614_deinit(&sensor->handle);
+        
+        return 1;
+    }
+    if ((found != 0) && (known.id == entry.id))
+    {
+        entry.ambient_offset = known.ambient_offset;
+        entry.object_offset = known.object_offset;
+    }
+    res = mlx90614_registry_store(registry, &entry);
+    if (res != 0)
+    {
+        /* the chip is ready, only the next start is cold again */
+        mlx90614_interface_debug_print("mlx90614: registry store failed.\n");
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      advance example deinit one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 deinit failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_deinit(mlx90614_advance_sensor_t *sensor)
 {
     uint8_t res;
     
     /* deinit */
-    res = mlx90614_deinit(&gs_handle);
+    res = mlx90614_deinit(&sensor->handle);
     if (res != 0)
     {
         return 1;
@@ -238,18 +397,19 @@ uint8_t mlx90614_advance_deinit(void)
 }
 
 /**
- * @brief  advance example enter sleep
- * @return status code
- *         - 0 success
- *         - 1 enter sleep failed
- * @note   none
+ * @brief      advance example enter sleep of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 enter sleep failed
+ * @note       none
  */
-uint8_t mlx90614_advance_enter_sleep(void)
+uint8_t mlx90614_advance_sensor_enter_sleep(mlx90614_advance_sensor_t *sensor)
 {
     uint8_t res;
     
     /* enter sleep */
-    res = mlx90614_enter_sleep_mode(&gs_handle);
+    res = mlx90614_enter_sleep_mode(&sensor->handle);
     if (res != 0)
     {
         return 1;
@@ -261,18 +421,19 @@ uint8_t mlx90614_advance_enter_sleep(void)
 }
 
 /**
- * @brief  advance example exit sleep
- * @return status code
- *         - 0 success
- *         - 1 exit sleep failed
- * @note   none
+ * @brief      advance example exit sleep of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 exit sleep failed
+ * @note       none
  */
-uint8_t mlx90614_advance_exit_sleep(void)
+uint8_t mlx90614_advance_sensor_exit_sleep(mlx90614_advance_sensor_t *sensor)
 {
     uint8_t res;
     
     /* exit sleep */
-    res = mlx90614_exit_sleep_mode(&gs_handle);
+    res = mlx90614_exit_sleep_mode(&sensor->handle);
     if (res != 0)
     {
         return 1;
@@ -284,28 +445,229 @@ uint8_t mlx90614_advance_exit_sleep(void)
 }
 
 /**
- * @brief     advance example read
- * @param[in] *ambient pointer to a ambient buffer
- * @param[in] *object pointer to a object buffer
- * @return    status code
- *            - 0 success
- *            - 1 read failed
- * @note      none
+ * @brief      advance example get id of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[out] *id pointer to a id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get id failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_get_id(mlx90614_advance_sensor_t *sensor, uint16_t id[4])
+{
+    uint8_t res;
+    
+    /* read id */
+    res = mlx90614_get_id(&sensor->handle, id);
+    if (res != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      advance example set the thermal relay of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[in]  threshold object temperature threshold
+ * @param[in]  hysteresis hysteresis below the threshold
+ * @return     status code
+ *             - 0 success
+ *             - 1 set thermal relay failed
+ * @note       the relay output starts after the next power on
+ */
+uint8_t mlx90614_advance_sensor_set_thermal_relay(mlx90614_advance_sensor_t *sensor, mlx90614_temperature_t threshold, mlx90614_temperature_t hysteresis)
+{
+    uint8_t res;
+    
+    /* set thermal relay */
+    res = mlx90614_set_thermal_relay(&sensor->handle, threshold, hysteresis, sensor->config.relay_pin);
+    if (res != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      advance example dump the whole eeprom of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[out] *image pointer to an eeprom image structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom dump failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_eeprom_dump(mlx90614_advance_sensor_t *sensor, mlx90614_eeprom_image_t *image)
+{
+    uint8_t res;
+    
+    /* dump eeprom */
+    res = mlx90614_eeprom_dump(&sensor->handle, image);
+    if (res != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      advance example restore the user cells of an eeprom image of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[in]  *image pointer to an eeprom image structure
+ * @param[out] *written pointer to a written cell number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom restore failed
+ * @note       the address cell is kept, so an image can be cloned to many chips on one bus
+ */
+uint8_t mlx90614_advance_sensor_eeprom_restore(mlx90614_advance_sensor_t *sensor, const mlx90614_eeprom_image_t *image, uint8_t *written)
+{
+    uint8_t res;
+    
+    /* restore eeprom */
+    res = mlx90614_eeprom_restore(&sensor->handle, image, MLX90614_EEPROM_USER_MASK, written);
+    if (res != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      advance example read one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[out] *ambient pointer to a ambient buffer
+ * @param[out] *object pointer to a object buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
  */
-uint8_t mlx90614_advance_read(float *ambient, float *object)
+uint8_t mlx90614_advance_sensor_read(mlx90614_advance_sensor_t *sensor, mlx90614_temperature_t *ambient, mlx90614_temperature_t *object)
 {
     uint8_t res;
     uint16_t raw;
     
     /* read ambient */
-    res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, ambient);
+    res = mlx90614_read_ambient(&sensor->handle, (uint16_t *)&raw, ambient);
     if (res != 0)
     {
         return 1;
     }
     
     /* read object1 */
-    res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, object);
+    res = mlx90614_read_object1(&sensor->handle, (uint16_t *)&raw, object);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      advance example wait until the data of the filter setting of one sensor is settled
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait ready failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_wait_ready(mlx90614_advance_sensor_t *sensor)
+{
+    uint8_t res;
+    uint8_t frames;
+    uint32_t ms;
+    
+    /* get the settling model */
+    res = mlx90614_settling_model(&sensor->handle, sensor->config.fir_length, sensor->config.iir, &frames, &ms);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* wait for the settled data */
+    res = mlx90614_wait_ready(&sensor->handle, frames, 2 * ms + MLX90614_READY_TIMEOUT_MS, NULL);
+    if (res != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      advance example run duty cycled samples of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[in]  period_ms sample period in ms
+ * @param[in]  times sample times
+ * @param[out] *stats pointer to a duty cycle stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 duty cycle failed
+ * @note       the sensor sleeps between the samples and is left in sleep mode,
+ *             a wake up timeout is counted in the stats and does not stop the run
+ */
+uint8_t mlx90614_advance_sensor_duty(mlx90614_advance_sensor_t *sensor, uint32_t period_ms, uint32_t times,
+                                     mlx90614_duty_stats_t *stats)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t awake;
+    uint64_t awake_ms;
+    uint16_t ambient_raw;
+    uint16_t object_raw;
+    mlx90614_temperature_t ambient;
+    mlx90614_temperature_t object;
+    mlx90614_duty_t duty;
+    
+    /* the scheduler starts from sleep mode */
+    res = mlx90614_enter_sleep_mode(&sensor->handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    res = mlx90614_duty_init(&duty, &sensor->handle, period_ms, NULL);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    for (i = 0; i < times; i++)
+    {
+        /* wake, read and sleep */
+        awake_ms = duty.awake_ms;
+        res = mlx90614_duty_sample(&duty, &ambient_raw, &ambient, &object_raw, &object);
+        if ((res != 0) && (res != 4))
+        {
+            return 1;
+        }
+        
+        /* sleep for the rest of the period */
+        awake = (uint32_t)(duty.awake_ms - awake_ms);
+        if (period_ms > awake)
+        {
+            sensor->handle.delay_ms(period_ms - awake);
+        }
+    }
+    
+    /* get the stats */
+    res = mlx90614_duty_get_stats(&duty, stats);
     if (res != 0)
     {
         return 1;
@@ -314,6 +676,107 @@ uint8_t mlx90614_advance_read(float *ambient, float *object)
     return 0;
 }
 
+/**
+ * @brief  advance example init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+uint8_t mlx90614_advance_init(void)
+{
+    mlx90614_advance_config_t config;
+    
+    /* init the single sensor with the default settings */
+    (void)mlx90614_advance_config_default(&config);
+    
+    return mlx90614_advance_sensor_init(&gs_sensor, &config);
+}
+
+/**
+ * @brief      advance example init with a device registry
+ * @param[in]  *registry pointer to an inited registry
+ * @param[out] *warm pointer to a warm start flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       a chip whose registry entry holds the default settings and still matches the chip costs one
+ *             read and keeps its eeprom untouched, otherwise the default settings are written and the entry is refreshed
+ */
+uint8_t mlx90614_advance_init_with_registry(mlx90614_registry_t *registry, mlx90614_bool_t *warm)
+{
+    mlx90614_advance_config_t config;
+    
+    /* init the single sensor with the default settings */
+    (void)mlx90614_advance_config_default(&config);
+    
+    return mlx90614_advance_sensor_init_with_registry(&gs_sensor, &config, registry, warm);
+}
+
+/**
+ * @brief      advance example get the path the last init took
+ * @param[out] *path pointer to a start path buffer
+ * @return     status code
+ *             - 0 success
+ * @note       fast means the probe read answered and no recovery sequence ran
+ */
+uint8_t mlx90614_advance_get_start_path(mlx90614_start_path_t *path)
+{
+    *path = gs_sensor.start_path;
+    
+    return 0;
+}
+
+/**
+ * @brief  advance example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t mlx90614_advance_deinit(void)
+{
+    return mlx90614_advance_sensor_deinit(&gs_sensor);
+}
+
+/**
+ * @brief  advance example enter sleep
+ * @return status code
+ *         - 0 success
+ *         - 1 enter sleep failed
+ * @note   none
+ */
+uint8_t mlx90614_advance_enter_sleep(void)
+{
+    return mlx90614_advance_sensor_enter_sleep(&gs_sensor);
+}
+
+/**
+ * @brief  advance example exit sleep
+ * @return status code
+ *         - 0 success
+ *         - 1 exit sleep failed
+ * @note   none
+ */
+uint8_t mlx90614_advance_exit_sleep(void)
+{
+    return mlx90614_advance_sensor_exit_sleep(&gs_sensor);
+}
+
+/**
+ * @brief     advance example read
+ * @param[in] *ambient pointer to a ambient buffer
+ * @param[in] *object pointer to a object buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      none
+ */
+uint8_t mlx90614_advance_read(mlx90614_temperature_t *ambient, mlx90614_temperature_t *object)
+{
+    return mlx90614_advance_sensor_read(&gs_sensor, ambient, object);
+}
+
 /**
  * @brief     advance example get id
  * @param[in] *id pointer to a id buffer
@@ -323,17 +786,95 @@ uint8_t mlx90614_advance_read(float *ambient, float *object)
  * @note      none
  */
 uint8_t mlx90614_advance_get_id(uint16_t id[4])
+{
+    return mlx90614_advance_sensor_get_id(&gs_sensor, id);
+}
+
+/**
+ * @brief  advance example wait until the data of the default filter setting is settled
+ * @return status code
+ *         - 0 success
+ *         - 1 wait ready failed
+ * @note   none
+ */
+uint8_t mlx90614_advance_wait_ready(void)
+{
+    return mlx90614_advance_sensor_wait_ready(&gs_sensor);
+}
+
+/**
+ * @brief     advance example set the thermal relay
+ * @param[in] threshold object temperature threshold
+ * @param[in] hysteresis hysteresis below the threshold
+ * @return    status code
+ *            - 0 success
+ *            - 1 set thermal relay failed
+ * @note      the relay output starts after the next power on
+ */
+uint8_t mlx90614_advance_set_thermal_relay(mlx90614_temperature_t threshold, mlx90614_temperature_t hysteresis)
+{
+    return mlx90614_advance_sensor_set_thermal_relay(&gs_sensor, threshold, hysteresis);
+}
+
+/**
+ * @brief      advance example dump the whole eeprom
+ * @param[out] *image pointer to an eeprom image structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom dump failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_eeprom_dump(mlx90614_eeprom_image_t *image)
+{
+    return mlx90614_advance_sensor_eeprom_dump(&gs_sensor, image);
+}
+
+/**
+ * @brief      advance example restore the user cells of an eeprom image
+ * @param[in]  *image pointer to an eeprom image structure
+ * @param[out] *written pointer to a written cell number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom restore failed
+ * @note       the address cell is kept, so an image can be cloned to many chips on one bus
+ */
+uint8_t mlx90614_advance_eeprom_restore(const mlx90614_eeprom_image_t *image, uint8_t *written)
+{
+    return mlx90614_advance_sensor_eeprom_restore(&gs_sensor, image, written);
+}
+
+/**
+ * @brief      advance example run duty cycled samples with one filter setting
+ * @param[in]  fir_length fir length
+ * @param[in]  iir iir
+ * @param[in]  period_ms sample period in ms
+ * @param[in]  times sample times
+ * @param[out] *stats pointer to a duty cycle stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 duty cycle failed
+ * @note       the filter setting is written to config1 when it differs and is kept after the run,
+ *             the other settings are the defaults and the sensor is left in sleep mode
+ */
+uint8_t mlx90614_advance_duty(mlx90614_fir_length_t fir_length, mlx90614_iir_t iir, uint32_t period_ms, uint32_t times,
+                              mlx90614_duty_stats_t *stats)
 {
     uint8_t res;
+    mlx90614_advance_config_t config;
     
-    /* read id */
-    res = mlx90614_get_id(&gs_handle, id);
+    /* init the single sensor with the filter setting */
+    (void)mlx90614_advance_config_default(&config);
+    config.fir_length = fir_length;
+    config.iir = iir;
+    res = mlx90614_advance_sensor_init(&gs_sensor, &config);
     if (res != 0)
     {
         return 1;
     }
-    else
-    {
-        return 0;
-    }
+    
+    /* run the duty cycle */
+    res = mlx90614_advance_sensor_duty(&gs_sensor, period_ms, times, stats);
+    (void)mlx90614_advance_sensor_deinit(&gs_sensor);
+    
+    return res;
 }
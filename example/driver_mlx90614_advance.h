@@ -38,6 +38,8 @@
 #define DRIVER_MLX90614_ADVANCE_H
 
 #include "driver_mlx90614_interface.h"
+#include "driver_mlx90614_registry.h"
+#include "driver_mlx90614_duty.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -51,6 +53,7 @@ extern "C"{
 /**
  * @brief mlx90614 advance example default definition
  */
+#define MLX90614_ADVANCE_DEFAULT_ADDRESS                                  MLX90614_ADDRESS_DEFAULT        /**< default address */
 #define MLX90614_ADVANCE_DEFAULT_FIR_LENGTH                               MLX90614_FIR_LENGTH_1024        /**< fir length 1024 */
 #define MLX90614_ADVANCE_DEFAULT_IIR                                      MLX90614_IIR_A1_1_B1_0          /**< iir a1 1 b1 0 */
 #define MLX90614_ADVANCE_DEFAULT_MODE                                     MLX90614_MODE_TA_TOBJ1          /**< ta tobj1 mode */
@@ -60,7 +63,190 @@ extern "C"{
 #define MLX90614_ADVANCE_DEFAULT_GAIN                                     MLX90614_GAIN_100               /**< gain 100 */
 #define MLX90614_ADVANCE_DEFAULT_SENSOR_TEST                              MLX90614_BOOL_FALSE             /**< false */
 #define MLX90614_ADVANCE_DEFAULT_REPEAT_SENSOR_TEST                       MLX90614_BOOL_FALSE             /**< false */
+#define MLX90614_ADVANCE_DEFAULT_RELAY_PIN                                MLX90614_PWM_PIN_PUSH_PULL      /**< push pull relay pin */
+#ifdef MLX90614_FIXED_POINT
+#define MLX90614_ADVANCE_DEFAULT_EMISSIVITY_CORRECTION_COEFFICIENT        MLX90614_EMISSIVITY_SCALE       /**< 1.0 */
+#else
 #define MLX90614_ADVANCE_DEFAULT_EMISSIVITY_CORRECTION_COEFFICIENT        1.0                             /**< 1.0 */
+#endif
+
+/**
+ * @brief mlx90614 advance config structure definition
+ */
+typedef struct mlx90614_advance_config_s
+{
+    uint8_t addr;                                  /**< iic address */
+    mlx90614_fir_length_t fir_length;              /**< fir length */
+    mlx90614_iir_t iir;                            /**< iir */
+    mlx90614_mode_t mode;                          /**< mode */
+    mlx90614_ir_sensor_t ir_sensor;                /**< ir sensor */
+    mlx90614_ks_t ks;                              /**< ks */
+    mlx90614_kt2_t kt2;                            /**< kt2 */
+    mlx90614_gain_t gain;                          /**< gain */
+    mlx90614_bool_t sensor_test;                   /**< sensor test */
+    mlx90614_bool_t repeat_sensor_test;            /**< repeat sensor test */
+    mlx90614_pwm_pin_t relay_pin;                  /**< thermal relay pin */
+    mlx90614_emissivity_t emissivity;              /**< emissivity correction coefficient */
+} mlx90614_advance_config_t;
+
+/**
+ * @brief mlx90614 advance sensor structure definition
+ */
+typedef struct mlx90614_advance_sensor_s
+{
+    mlx90614_handle_t handle;                      /**< mlx90614 handle */
+    mlx90614_advance_config_t config;              /**< settings the sensor was inited with */
+    mlx90614_start_path_t start_path;              /**< start path of the last init */
+} mlx90614_advance_sensor_t;
+
+/**
+ * @brief      advance example fill a config with the default settings
+ * @param[out] *config pointer to an advance config structure
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t mlx90614_advance_config_default(mlx90614_advance_config_t *config);
+
+/**
+ * @brief     advance example init one sensor
+ * @param[in] *sensor pointer to an advance sensor structure
+ * @param[in] *config pointer to an advance config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the config is copied into the sensor
+ */
+uint8_t mlx90614_advance_sensor_init(mlx90614_advance_sensor_t *sensor, const mlx90614_advance_config_t *config);
+
+/**
+ * @brief      advance example init one sensor with a device registry
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[in]  *config pointer to an advance config structure
+ * @param[in]  *registry pointer to an inited registry
+ * @param[out] *warm pointer to a warm start flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       a chip whose registry entry holds the config1 and emissivity of the config and still matches
+ *             the chip costs one read and keeps its eeprom untouched, otherwise the settings of the config
+ *             are written and the entry is refreshed
+ */
+uint8_t mlx90614_advance_sensor_init_with_registry(mlx90614_advance_sensor_t *sensor, const mlx90614_advance_config_t *config,
+                                                   mlx90614_registry_t *registry, mlx90614_bool_t *warm);
+
+/**
+ * @brief      advance example deinit one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 deinit failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_deinit(mlx90614_advance_sensor_t *sensor);
+
+/**
+ * @brief      advance example enter sleep of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 enter sleep failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_enter_sleep(mlx90614_advance_sensor_t *sensor);
+
+/**
+ * @brief      advance example exit sleep of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 exit sleep failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_exit_sleep(mlx90614_advance_sensor_t *sensor);
+
+/**
+ * @brief      advance example get id of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[out] *id pointer to a id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get id failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_get_id(mlx90614_advance_sensor_t *sensor, uint16_t id[4]);
+
+/**
+ * @brief      advance example set the thermal relay of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[in]  threshold object temperature threshold
+ * @param[in]  hysteresis hysteresis below the threshold
+ * @return     status code
+ *             - 0 success
+ *             - 1 set thermal relay failed
+ * @note       the relay output starts after the next power on
+ */
+uint8_t mlx90614_advance_sensor_set_thermal_relay(mlx90614_advance_sensor_t *sensor, mlx90614_temperature_t threshold, mlx90614_temperature_t hysteresis);
+
+/**
+ * @brief      advance example dump the whole eeprom of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[out] *image pointer to an eeprom image structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom dump failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_eeprom_dump(mlx90614_advance_sensor_t *sensor, mlx90614_eeprom_image_t *image);
+
+/**
+ * @brief      advance example restore the user cells of an eeprom image of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[in]  *image pointer to an eeprom image structure
+ * @param[out] *written pointer to a written cell number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom restore failed
+ * @note       the address cell is kept, so an image can be cloned to many chips on one bus
+ */
+uint8_t mlx90614_advance_sensor_eeprom_restore(mlx90614_advance_sensor_t *sensor, const mlx90614_eeprom_image_t *image, uint8_t *written);
+
+/**
+ * @brief      advance example read one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[out] *ambient pointer to a ambient buffer
+ * @param[out] *object pointer to a object buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_read(mlx90614_advance_sensor_t *sensor, mlx90614_temperature_t *ambient, mlx90614_temperature_t *object);
+
+/**
+ * @brief      advance example wait until the data of the filter setting of one sensor is settled
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait ready failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_sensor_wait_ready(mlx90614_advance_sensor_t *sensor);
+
+/**
+ * @brief      advance example run duty cycled samples of one sensor
+ * @param[in]  *sensor pointer to an advance sensor structure
+ * @param[in]  period_ms sample period in ms
+ * @param[in]  times sample times
+ * @param[out] *stats pointer to a duty cycle stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 duty cycle failed
+ * @note       the sensor sleeps between the samples and is left in sleep mode,
+ *             a wake up timeout is counted in the stats and does not stop the run
+ */
+uint8_t mlx90614_advance_sensor_duty(mlx90614_advance_sensor_t *sensor, uint32_t period_ms, uint32_t times,
+                                     mlx90614_duty_stats_t *stats);
 
 /**
  * @brief  advance example init
@@ -71,6 +257,18 @@ extern "C"{
  */
 uint8_t mlx90614_advance_init(void);
 
+/**
+ * @brief      advance example init with a device registry
+ * @param[in]  *registry pointer to an inited registry
+ * @param[out] *warm pointer to a warm start flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       a chip whose registry entry holds the default settings and still matches the chip costs one
+ *             read and keeps its eeprom untouched, otherwise the default settings are written and the entry is refreshed
+ */
+uint8_t mlx90614_advance_init_with_registry(mlx90614_registry_t *registry, mlx90614_bool_t *warm);
+
 /**
  * @brief  advance example deinit
  * @return status code
@@ -80,6 +278,15 @@ uint8_t mlx90614_advance_init(void);
  */
 uint8_t mlx90614_advance_deinit(void);
 
+/**
+ * @brief      advance example get the path the last init took
+ * @param[out] *path pointer to a start path buffer
+ * @return     status code
+ *             - 0 success
+ * @note       fast means the probe read answered and no recovery sequence ran
+ */
+uint8_t mlx90614_advance_get_start_path(mlx90614_start_path_t *path);
+
 /**
  * @brief  advance example enter sleep
  * @return status code
@@ -107,7 +314,7 @@ uint8_t mlx90614_advance_exit_sleep(void);
  *            - 1 read failed
  * @note      none
  */
-uint8_t mlx90614_advance_read(float *ambient, float *object);
+uint8_t mlx90614_advance_read(mlx90614_temperature_t *ambient, mlx90614_temperature_t *object);
 
 /**
  * @brief     advance example get id
@@ -119,6 +326,63 @@ uint8_t mlx90614_advance_read(float *ambient, float *object);
  */
 uint8_t mlx90614_advance_get_id(uint16_t id[4]);
 
+/**
+ * @brief  advance example wait until the data of the default filter setting is settled
+ * @return status code
+ *         - 0 success
+ *         - 1 wait ready failed
+ * @note   none
+ */
+uint8_t mlx90614_advance_wait_ready(void);
+
+/**
+ * @brief     advance example set the thermal relay
+ * @param[in] threshold object temperature threshold
+ * @param[in] hysteresis hysteresis below the threshold
+ * @return    status code
+ *            - 0 success
+ *            - 1 set thermal relay failed
+ * @note      the relay output starts after the next power on
+ */
+uint8_t mlx90614_advance_set_thermal_relay(mlx90614_temperature_t threshold, mlx90614_temperature_t hysteresis);
+
+/**
+ * @brief      advance example dump the whole eeprom
+ * @param[out] *image pointer to an eeprom image structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom dump failed
+ * @note       none
+ */
+uint8_t mlx90614_advance_eeprom_dump(mlx90614_eeprom_image_t *image);
+
+/**
+ * @brief      advance example restore the user cells of an eeprom image
+ * @param[in]  *image pointer to an eeprom image structure
+ * @param[out] *written pointer to a written cell number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom restore failed
+ * @note       the address cell is kept, so an image can be cloned to many chips on one bus
+ */
+uint8_t mlx90614_advance_eeprom_restore(const mlx90614_eeprom_image_t *image, uint8_t *written);
+
+/**
+ * @brief      advance example run duty cycled samples with one filter setting
+ * @param[in]  fir_length fir length
+ * @param[in]  iir iir
+ * @param[in]  period_ms sample period in ms
+ * @param[in]  times sample times
+ * @param[out] *stats pointer to a duty cycle stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 duty cycle failed
+ * @note       the filter setting is written to config1 when it differs and is kept after the run,
+ *             the other settings are the defaults and the sensor is left in sleep mode
+ */
+uint8_t mlx90614_advance_duty(mlx90614_fir_length_t fir_length, mlx90614_iir_t iir, uint32_t period_ms, uint32_t times,
+                              mlx90614_duty_stats_t *stats);
+
 /**
  * @}
  */
@@ -36,32 +36,51 @@
 
 #include "driver_mlx90614_basic.h"
 
-static mlx90614_handle_t gs_handle;        /**< mlx90614 handle */
+static mlx90614_basic_sensor_t gs_sensor;        /**< mlx90614 sensor of the single sensor functions */
 
 /**
- * @brief  basic example init
- * @return status code
- *         - 0 success
- *         - 1 init failed
- * @note   none
+ * @brief      basic example fill a config with the default settings
+ * @param[out] *config pointer to a basic config structure
+ * @return     status code
+ *             - 0 success
+ * @note       none
  */
-uint8_t mlx90614_basic_init(void)
+uint8_t mlx90614_basic_config_default(mlx90614_basic_config_t *config)
+{
+    config->addr = MLX90614_BASIC_DEFAULT_ADDRESS;
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example init one sensor
+ * @param[in] *sensor pointer to a basic sensor structure
+ * @param[in] *config pointer to a basic config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every sensor owns its handle, sensors on one bus differ by the address,
+ *            the first sensor that needs a wake up wakes the whole bus so the others take the fast path
+ */
+uint8_t mlx90614_basic_sensor_init(mlx90614_basic_sensor_t *sensor, const mlx90614_basic_config_t *config)
 {
     uint8_t res;
+    mlx90614_handle_t *handle = &sensor->handle;
     
     /* link interface function */
-    DRIVER_MLX90614_LINK_INIT(&gs_handle, mlx90614_handle_t);
-    DRIVER_MLX90614_LINK_IIC_INIT(&gs_handle, mlx90614_interface_iic_init);
-    DRIVER_MLX90614_LINK_IIC_DEINIT(&gs_handle, mlx90614_interface_iic_deinit);
-    DRIVER_MLX90614_LINK_IIC_READ(&gs_handle, mlx90614_interface_iic_read);
-    DRIVER_MLX90614_LINK_IIC_WRITE(&gs_handle, mlx90614_interface_iic_write);
-    DRIVER_MLX90614_LINK_SCL_WRITE(&gs_handle, mlx90614_interface_scl_write);
-    DRIVER_MLX90614_LINK_SDA_WRITE(&gs_handle, mlx90614_interface_sda_write);
-    DRIVER_MLX90614_LINK_DELAY_MS(&gs_handle, mlx90614_interface_delay_ms);
-    DRIVER_MLX90614_LINK_DEBUG_PRINT(&gs_handle, mlx90614_interface_debug_print);
+    DRIVER_MLX90614_LINK_INIT(handle, mlx90614_handle_t);
+    DRIVER_MLX90614_LINK_IIC_INIT(handle, mlx90614_interface_iic_init);
+    DRIVER_MLX90614_LINK_IIC_DEINIT(handle, mlx90614_interface_iic_deinit);
+    DRIVER_MLX90614_LINK_IIC_READ(handle, mlx90614_interface_iic_read);
+    DRIVER_MLX90614_LINK_IIC_WRITE(handle, mlx90614_interface_iic_write);
+    DRIVER_MLX90614_LINK_SCL_WRITE(handle, mlx90614_interface_scl_write);
+    DRIVER_MLX90614_LINK_SDA_WRITE(handle, mlx90614_interface_sda_write);
+    DRIVER_MLX90614_LINK_DELAY_MS(handle, mlx90614_interface_delay_ms);
+    DRIVER_MLX90614_LINK_DEBUG_PRINT(handle, mlx90614_interface_debug_print);
+    sensor->start_path = MLX90614_START_PATH_FAST;
     
     /* set address */
-    res = mlx90614_set_addr(&gs_handle, MLX90614_ADDRESS_DEFAULT);
+    res = mlx90614_set_addr(handle, config->addr);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: set addr failed.\n");
@@ -70,7 +89,7 @@ uint8_t mlx90614_basic_init(void)
     }
     
     /* mlx90614 init */
-    res = mlx90614_init(&gs_handle);
+    res = mlx90614_init(handle);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: init failed.\n");
@@ -78,22 +97,12 @@ uint8_t mlx90614_basic_init(void)
         return 1;
     }
     
-    /* pwm to smbus */
-    res = mlx90614_pwm_to_smbus(&gs_handle);
-    if (res != 0)
-    {
-        mlx90614_interface_debug_print("mlx90614: pwm to smbus failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* exit sleep mode */
-    res = mlx90614_exit_sleep_mode(&gs_handle);
+    /* probe first, recover only when needed */
+    res = mlx90614_start(handle, &sensor->start_path);
     if (res != 0)
     {
-        mlx90614_interface_debug_print("mlx90614: exit sleep mode failed.\n");
-        (void)mlx90614_deinit(&gs_handle);
+        mlx90614_interface_debug_print("mlx90614: start failed.\n");
+        (void)mlx90614_deinit(handle);
         
         return 1;
     }
@@ -102,18 +111,19 @@ uint8_t mlx90614_basic_init(void)
 }
 
 /**
- * @brief  basic example deinit
- * @return status code
- *         - 0 success
- *         - 1 deinit failed
- * @note   none
+ * @brief     basic example deinit one sensor
+ * @param[in] *sensor pointer to a basic sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
  */
-uint8_t mlx90614_basic_deinit(void)
+uint8_t mlx90614_basic_sensor_deinit(mlx90614_basic_sensor_t *sensor)
 {
     uint8_t res;
     
     /* deinit */
-    res = mlx90614_deinit(&gs_handle);
+    res = mlx90614_deinit(&sensor->handle);
     if (res != 0)
     {
         return 1;
@@ -125,28 +135,29 @@ uint8_t mlx90614_basic_deinit(void)
 }
 
 /**
- * @brief     basic example read
- * @param[in] *ambient pointer to a ambient buffer
- * @param[in] *object pointer to a object buffer
- * @return    status code
- *            - 0 success
- *            - 1 read failed
- * @note      none
+ * @brief      basic example read one sensor
+ * @param[in]  *sensor pointer to a basic sensor structure
+ * @param[out] *ambient pointer to a ambient buffer
+ * @param[out] *object pointer to a object buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
  */
-uint8_t mlx90614_basic_read(float *ambient, float *object)
+uint8_t mlx90614_basic_sensor_read(mlx90614_basic_sensor_t *sensor, mlx90614_temperature_t *ambient, mlx90614_temperature_t *object)
 {
     uint8_t res;
     uint16_t raw;
     
     /* read ambient */
-    res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, ambient);
+    res = mlx90614_read_ambient(&sensor->handle, (uint16_t *)&raw, ambient);
     if (res != 0)
     {
         return 1;
     }
     
     /* read object1 */
-    res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, object);
+    res = mlx90614_read_object1(&sensor->handle, (uint16_t *)&raw, object);
     if (res != 0)
     {
         return 1;
@@ -154,3 +165,60 @@ uint8_t mlx90614_basic_read(float *ambient, float *object)
     
     return 0;
 }
+
+/**
+ * @brief  basic example init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+uint8_t mlx90614_basic_init(void)
+{
+    mlx90614_basic_config_t config;
+    
+    /* init the single sensor with the default settings */
+    (void)mlx90614_basic_config_default(&config);
+    
+    return mlx90614_basic_sensor_init(&gs_sensor, &config);
+}
+
+/**
+ * @brief  basic example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t mlx90614_basic_deinit(void)
+{
+    return mlx90614_basic_sensor_deinit(&gs_sensor);
+}
+
+/**
+ * @brief      basic example get the path the last init took
+ * @param[out] *path pointer to a start path buffer
+ * @return     status code
+ *             - 0 success
+ * @note       fast means the probe read answered and no recovery sequence ran
+ */
+uint8_t mlx90614_basic_get_start_path(mlx90614_start_path_t *path)
+{
+    *path = gs_sensor.start_path;
+    
+    return 0;
+}
+
+/**
+ * @brief     basic example read
+ * @param[in] *ambient pointer to a ambient buffer
+ * @param[in] *object pointer to a object buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      none
+ */
+uint8_t mlx90614_basic_read(mlx90614_temperature_t *ambient, mlx90614_temperature_t *object)
+{
+    return mlx90614_basic_sensor_read(&gs_sensor, ambient, object);
+}
@@ -50,6 +50,71 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief mlx90614 basic example default definition
+ */
+#define MLX90614_BASIC_DEFAULT_ADDRESS        MLX90614_ADDRESS_DEFAULT        /**< default address */
+
+/**
+ * @brief mlx90614 basic config structure definition
+ */
+typedef struct mlx90614_basic_config_s
+{
+    uint8_t addr;        /**< iic address */
+} mlx90614_basic_config_t;
+
+/**
+ * @brief mlx90614 basic sensor structure definition
+ */
+typedef struct mlx90614_basic_sensor_s
+{
+    mlx90614_handle_t handle;                  /**< mlx90614 handle */
+    mlx90614_start_path_t start_path;          /**< start path of the last init */
+} mlx90614_basic_sensor_t;
+
+/**
+ * @brief      basic example fill a config with the default settings
+ * @param[out] *config pointer to a basic config structure
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t mlx90614_basic_config_default(mlx90614_basic_config_t *config);
+
+/**
+ * @brief     basic example init one sensor
+ * @param[in] *sensor pointer to a basic sensor structure
+ * @param[in] *config pointer to a basic config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      every sensor owns its handle, sensors on one bus differ by the address,
+ *            the first sensor that needs a wake up wakes the whole bus so the others take the fast path
+ */
+uint8_t mlx90614_basic_sensor_init(mlx90614_basic_sensor_t *sensor, const mlx90614_basic_config_t *config);
+
+/**
+ * @brief     basic example deinit one sensor
+ * @param[in] *sensor pointer to a basic sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mlx90614_basic_sensor_deinit(mlx90614_basic_sensor_t *sensor);
+
+/**
+ * @brief      basic example read one sensor
+ * @param[in]  *sensor pointer to a basic sensor structure
+ * @param[out] *ambient pointer to a ambient buffer
+ * @param[out] *object pointer to a object buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mlx90614_basic_sensor_read(mlx90614_basic_sensor_t *sensor, mlx90614_temperature_t *ambient, mlx90614_temperature_t *object);
+
 /**
  * @brief  basic example init
  * @return status code
@@ -68,6 +133,15 @@ uint8_t mlx90614_basic_init(void);
  */
 uint8_t mlx90614_basic_deinit(void);
 
+/**
+ * @brief      basic example get the path the last init took
+ * @param[out] *path pointer to a start path buffer
+ * @return     status code
+ *             - 0 success
+ * @note       fast means the probe read answered and no recovery sequence ran
+ */
+uint8_t mlx90614_basic_get_start_path(mlx90614_start_path_t *path);
+
 /**
  * @brief     basic example read
  * @param[in] *ambient pointer to a ambient buffer
@@ -77,7 +151,7 @@ uint8_t mlx90614_basic_deinit(void);
  *            - 1 read failed
  * @note      none
  */
-uint8_t mlx90614_basic_read(float *ambient, float *object);
+uint8_t mlx90614_basic_read(mlx90614_temperature_t *ambient, mlx90614_temperature_t *object);
 
 /**
  * @}
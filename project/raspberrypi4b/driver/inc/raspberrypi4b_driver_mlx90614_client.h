@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      raspberrypi4b_driver_mlx90614_client.h
+ * @brief     raspberrypi4b driver mlx90614 client header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MLX90614_CLIENT_H
+#define RASPBERRYPI4B_DRIVER_MLX90614_CLIENT_H
+
+#include "shm_ring.h"
+#include "shm_table.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_client_driver mlx90614 client driver function
+ * @brief    mlx90614 client driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 client default definition
+ */
+#define MLX90614_CLIENT_DEFAULT_NAME        "/mlx90614d"        /**< default shm object name */
+#define MLX90614_LATEST_SUFFIX              ".latest"           /**< latest table shm object name suffix */
+
+/**
+ * @brief mlx90614 sample structure definition
+ */
+typedef struct mlx90614_sample_s
+{
+    uint64_t timestamp_ns;        /**< CLOCK_REALTIME timestamp in ns */
+    uint64_t id;                  /**< 64 bits chip id, id[0] is the lowest word */
+    uint16_t ambient_raw;         /**< ta raw data in 0.02K */
+    uint16_t object_raw;          /**< tobj1 raw data in 0.02K */
+    uint8_t addr;                 /**< iic address */
+    uint8_t status;               /**< read status code, 0 means success */
+    uint8_t reserved[2];          /**< reserved */
+} mlx90614_sample_t;
+
+/**
+ * @brief mlx90614 client structure definition
+ */
+typedef struct mlx90614_client_s
+{
+    shm_ring_t ring;        /**< sample ring */
+} mlx90614_client_t;
+
+/**
+ * @brief mlx90614 latest structure definition
+ */
+typedef struct mlx90614_latest_s
+{
+    shm_table_t table;        /**< latest value table */
+} mlx90614_latest_t;
+
+/**
+ * @brief     open the client
+ * @param[in] *client pointer to an mlx90614 client structure
+ * @param[in] *name pointer to a shm object name, NULL means the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t mlx90614_client_open(mlx90614_client_t *client, const char *name);
+
+/**
+ * @brief     close the client
+ * @param[in] *client pointer to an mlx90614 client structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_client_close(mlx90614_client_t *client);
+
+/**
+ * @brief      read the next sample
+ * @param[in]  *client pointer to an mlx90614 client structure
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new sample
+ * @note       none
+ */
+uint8_t mlx90614_client_read(mlx90614_client_t *client, mlx90614_sample_t *sample);
+
+/**
+ * @brief      get the next sample in the shared memory without copying
+ * @param[in]  *client pointer to an mlx90614 client structure
+ * @param[out] **sample pointer to a sample address buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new sample
+ * @note       the sample must be checked with mlx90614_client_release after use
+ */
+uint8_t mlx90614_client_peek(mlx90614_client_t *client, const mlx90614_sample_t **sample);
+
+/**
+ * @brief     release the sample got by mlx90614_client_peek
+ * @param[in] *client pointer to an mlx90614 client structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sample was overwritten while in use and must be dropped
+ * @note      none
+ */
+uint8_t mlx90614_client_release(mlx90614_client_t *client);
+
+/**
+ * @brief     get the number of lost samples
+ * @param[in] *client pointer to an mlx90614 client structure
+ * @return    samples overwritten before this client read them
+ * @note      none
+ */
+uint64_t mlx90614_client_lost(mlx90614_client_t *client);
+
+/**
+ * @brief     open the latest value table
+ * @param[in] *latest pointer to an mlx90614 latest structure
+ * @param[in] *name pointer to the daemon shm object name, NULL means the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the table object is named name + MLX90614_LATEST_SUFFIX
+ */
+uint8_t mlx90614_latest_open(mlx90614_latest_t *latest, const char *name);
+
+/**
+ * @brief     close the latest value table
+ * @param[in] *latest pointer to an mlx90614 latest structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_latest_close(mlx90614_latest_t *latest);
+
+/**
+ * @brief      find the slot of a sensor
+ * @param[in]  *latest pointer to an mlx90614 latest structure
+ * @param[in]  id 64 bits chip id
+ * @param[out] *index pointer to a slot index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sensor not found
+ * @note       look the slot up once and keep the index
+ */
+uint8_t mlx90614_latest_find(mlx90614_latest_t *latest, uint64_t id, uint32_t *index);
+
+/**
+ * @brief      read the latest sample of a slot
+ * @param[in]  *latest pointer to an mlx90614 latest structure
+ * @param[in]  index slot index
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       no syscall, torn reads are retried
+ */
+uint8_t mlx90614_latest_read(mlx90614_latest_t *latest, uint32_t index, mlx90614_sample_t *sample);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
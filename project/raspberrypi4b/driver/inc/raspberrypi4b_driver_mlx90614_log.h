@@ -0,0 +1,254 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      raspberrypi4b_driver_mlx90614_log.h
+ * @brief     driver mlx90614 log header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MLX90614_LOG_H
+#define RASPBERRYPI4B_DRIVER_MLX90614_LOG_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_log_driver mlx90614 log driver function
+ * @brief    mlx90614 log driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 log format definition
+ */
+#define MLX90614_LOG_MAGIC                0x4C584C4DU                                               /**< file magic "MLXL" */
+#define MLX90614_LOG_BLOCK_MAGIC          0x42584C4DU                                               /**< block magic "MLXB" */
+#define MLX90614_LOG_VERSION              1                                                         /**< format version */
+#define MLX90614_LOG_HEADER_SIZE          64                                                        /**< file header size */
+#define MLX90614_LOG_BLOCK_SIZE           4096                                                      /**< block size */
+#define MLX90614_LOG_BLOCK_HEADER_SIZE    40                                                        /**< block header size */
+#define MLX90614_LOG_BLOCK_PAYLOAD        (MLX90614_LOG_BLOCK_SIZE - MLX90614_LOG_BLOCK_HEADER_SIZE) /**< block payload size */
+#define MLX90614_LOG_BLOCK_MAX_RECORD     (MLX90614_LOG_BLOCK_PAYLOAD / 3)                          /**< max records in one block */
+
+/**
+ * @brief mlx90614 log block header structure definition
+ * @note  every block starts from zero, so blocks decode independently
+ */
+typedef struct mlx90614_log_block_s
+{
+    uint32_t magic;               /**< block magic */
+    uint16_t count;               /**< record number */
+    uint16_t used;                /**< used payload bytes */
+    uint64_t id;                  /**< 64 bits chip id */
+    uint16_t config1;             /**< config1 register fingerprint */
+    uint16_t reserved[3];         /**< reserved */
+    uint64_t first_us;            /**< timestamp of the first record in us */
+    uint64_t last_us;             /**< timestamp of the last record in us */
+} mlx90614_log_block_t;
+
+/**
+ * @brief mlx90614 log record structure definition
+ */
+typedef struct mlx90614_log_record_s
+{
+    uint64_t timestamp_us;        /**< timestamp in us */
+    uint16_t ambient_raw;         /**< ta raw data in 0.02K */
+    uint16_t object_raw;          /**< tobj1 raw data in 0.02K */
+    uint8_t reserved[4];          /**< reserved */
+} mlx90614_log_record_t;
+
+/**
+ * @brief mlx90614 log writer structure definition
+ */
+typedef struct mlx90614_log_writer_s
+{
+    int fd;                                           /**< file handle */
+    uint64_t block;                                   /**< current block index */
+    uint64_t last_us;                                 /**< last timestamp */
+    uint16_t last_ambient;                            /**< last ambient raw data */
+    uint16_t last_object;                             /**< last object raw data */
+    uint8_t dirty;                                    /**< unsaved data flag */
+    union
+    {
+        mlx90614_log_block_t header;                  /**< block header */
+        uint8_t buf[MLX90614_LOG_BLOCK_SIZE];         /**< block buffer */
+    } b;                                              /**< current block */
+} mlx90614_log_writer_t;
+
+/**
+ * @brief mlx90614 log reader structure definition
+ */
+typedef struct mlx90614_log_reader_s
+{
+    const uint8_t *map;        /**< mapped file */
+    size_t size;               /**< mapped size */
+    uint64_t blocks;           /**< block number */
+} mlx90614_log_reader_t;
+
+/**
+ * @brief     open a log file for appending
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @param[in] *path pointer to a file path
+ * @param[in] id 64 bits chip id
+ * @param[in] config1 config1 register value
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      new records always start a new block after the existing ones
+ */
+uint8_t mlx90614_log_writer_open(mlx90614_log_writer_t *writer, const char *path, uint64_t id, uint16_t config1);
+
+/**
+ * @brief     close a log file
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_log_writer_close(mlx90614_log_writer_t *writer);
+
+/**
+ * @brief     change the sensor or config1 fingerprint of the following records
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @param[in] id 64 bits chip id
+ * @param[in] config1 config1 register value
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a change starts a new block
+ */
+uint8_t mlx90614_log_writer_set_stream(mlx90614_log_writer_t *writer, uint64_t id, uint16_t config1);
+
+/**
+ * @brief     append a record
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @param[in] timestamp_us timestamp in us
+ * @param[in] ambient_raw ambient raw data
+ * @param[in] object_raw object raw data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      only touches the file when a block is full
+ */
+uint8_t mlx90614_log_writer_append(mlx90614_log_writer_t *writer, uint64_t timestamp_us,
+                                   uint16_t ambient_raw, uint16_t object_raw);
+
+/**
+ * @brief     write the current partial block to the file
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      the block is rewritten in place until it is full
+ */
+uint8_t mlx90614_log_writer_flush(mlx90614_log_writer_t *writer);
+
+/**
+ * @brief     map a log file
+ * @param[in] *reader pointer to an mlx90614 log reader structure
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t mlx90614_log_reader_open(mlx90614_log_reader_t *reader, const char *path);
+
+/**
+ * @brief     unmap a log file
+ * @param[in] *reader pointer to an mlx90614 log reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_log_reader_close(mlx90614_log_reader_t *reader);
+
+/**
+ * @brief      get a block header
+ * @param[in]  *reader pointer to an mlx90614 log reader structure
+ * @param[in]  index block index
+ * @param[out] *block pointer to a block header buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index is invalid
+ *             - 4 block is broken
+ * @note       none
+ */
+uint8_t mlx90614_log_reader_block(mlx90614_log_reader_t *reader, uint64_t index, mlx90614_log_block_t *block);
+
+/**
+ * @brief      find the first block holding records at or after a time
+ * @param[in]  *reader pointer to an mlx90614 log reader structure
+ * @param[in]  timestamp_us timestamp in us
+ * @param[out] *index pointer to a block index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no such block
+ * @note       binary search on the block headers, blocks must be in time order
+ */
+uint8_t mlx90614_log_reader_seek(mlx90614_log_reader_t *reader, uint64_t timestamp_us, uint64_t *index);
+
+/**
+ * @brief         decode all records of a block
+ * @param[in]     *reader pointer to an mlx90614 log reader structure
+ * @param[in]     index block index
+ * @param[out]    *record pointer to a record buffer
+ * @param[in,out] *len pointer to a record buffer length
+ * @return        status code
+ *                - 0 success
+ *                - 1 index is invalid
+ *                - 4 block is broken
+ *                - 5 buffer is too small
+ * @note          MLX90614_LOG_BLOCK_MAX_RECORD records always fit
+ */
+uint8_t mlx90614_log_reader_decode(mlx90614_log_reader_t *reader, uint64_t index,
+                                   mlx90614_log_record_t *record, uint16_t *len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
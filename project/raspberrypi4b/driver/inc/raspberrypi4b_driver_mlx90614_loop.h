@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      raspberrypi4b_driver_mlx90614_loop.h
+ * @brief     raspberrypi4b driver mlx90614 loop header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MLX90614_LOOP_H
+#define RASPBERRYPI4B_DRIVER_MLX90614_LOOP_H
+
+#include "driver_mlx90614_interface.h"
+#include "loop.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_loop_driver mlx90614 loop driver function
+ * @brief    mlx90614 loop driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 loop bus definition
+ * @note  all loop sensors share one bus, a wake pulse holds sda low, so the other sensors keep off the
+ *        bus until it ends and retry after this delay
+ */
+#ifndef MLX90614_LOOP_BUS_RETRY_MS
+#define MLX90614_LOOP_BUS_RETRY_MS        5        /**< retry delay in ms while a wake pulse holds the bus */
+#endif
+
+/**
+ * @brief mlx90614 loop state enumeration definition
+ */
+typedef enum
+{
+    MLX90614_LOOP_STATE_IDLE    = 0x00,        /**< no pending work */
+    MLX90614_LOOP_STATE_SAMPLE  = 0x01,        /**< periodic sampling */
+    MLX90614_LOOP_STATE_WAKE    = 0x02,        /**< wake up request in progress */
+    MLX90614_LOOP_STATE_SETTLE  = 0x03,        /**< waiting for the first valid data after wake up */
+    MLX90614_LOOP_STATE_ERASE   = 0x04,        /**< eeprom erase cycle in progress */
+    MLX90614_LOOP_STATE_PROGRAM = 0x05,        /**< eeprom write cycle in progress */
+    MLX90614_LOOP_STATE_SLEEP   = 0x06,        /**< sleep mode */
+} mlx90614_loop_state_t;
+
+/**
+ * @brief mlx90614 loop operation enumeration definition
+ */
+typedef enum
+{
+    MLX90614_LOOP_OP_WAKE   = 0x00,        /**< exit sleep mode */
+    MLX90614_LOOP_OP_EEPROM = 0x01,        /**< eeprom write */
+} mlx90614_loop_op_t;
+
+/**
+ * @brief mlx90614 loop sensor structure definition
+ */
+typedef struct mlx90614_loop_sensor_s
+{
+    mlx90614_handle_t handle;                                                                       /**< mlx90614 handle */
+    loop_timer_t timer;                                                                             /**< deadline timer */
+    mlx90614_loop_state_t state;                                                                    /**< current state */
+    uint32_t period_ms;                                                                             /**< sampling period, 0 means stopped */
+    uint8_t eeprom_reg;                                                                             /**< pending eeprom register */
+    uint16_t eeprom_data;                                                                           /**< pending eeprom data */
+    void (*sample_callback)(struct mlx90614_loop_sensor_s *sensor, uint8_t res,
+                            uint16_t ambient_raw, uint16_t object_raw);                             /**< sample callback */
+    void (*done_callback)(struct mlx90614_loop_sensor_s *sensor, mlx90614_loop_op_t op, uint8_t res);  /**< operation done callback */
+    void *user;                                                                                     /**< user data */
+} mlx90614_loop_sensor_t;
+
+/**
+ * @brief     loop sensor init
+ * @param[in] loop loop handle
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @param[in] addr iic address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      callbacks and user data can be set after this call
+ */
+uint8_t mlx90614_loop_sensor_init(int loop, mlx90614_loop_sensor_t *sensor, uint8_t addr);
+
+/**
+ * @brief     loop sensor deinit
+ * @param[in] loop loop handle
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mlx90614_loop_sensor_deinit(int loop, mlx90614_loop_sensor_t *sensor);
+
+/**
+ * @brief     start periodic sampling
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @param[in] period_ms sampling period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      sampling of a busy or sleeping sensor begins when it becomes idle
+ */
+uint8_t mlx90614_loop_sensor_start(mlx90614_loop_sensor_t *sensor, uint32_t period_ms);
+
+/**
+ * @brief     stop periodic sampling
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      none
+ */
+uint8_t mlx90614_loop_sensor_stop(mlx90614_loop_sensor_t *sensor);
+
+/**
+ * @brief     put the sensor to sleep
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sleep failed
+ *            - 4 sensor or bus is busy
+ * @note      none
+ */
+uint8_t mlx90614_loop_sensor_sleep(mlx90614_loop_sensor_t *sensor);
+
+/**
+ * @brief     wake the sensor up without blocking
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wake failed
+ *            - 4 sensor or bus is busy
+ * @note      done_callback is called with MLX90614_LOOP_OP_WAKE when the data is valid, only one wake
+ *            pulse runs at a time because ending it releases sda for the whole bus
+ */
+uint8_t mlx90614_loop_sensor_wake(mlx90614_loop_sensor_t *sensor);
+
+/**
+ * @brief     write an eeprom register without blocking
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @param[in] reg eeprom register address
+ * @param[in] data written data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 4 sensor or bus is busy
+ * @note      done_callback is called with MLX90614_LOOP_OP_EEPROM after the read back check
+ */
+uint8_t mlx90614_loop_sensor_write_eeprom(mlx90614_loop_sensor_t *sensor, uint8_t reg, uint16_t data);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      raspberrypi4b_driver_mlx90614_registry.h
+ * @brief     raspberrypi4b driver mlx90614 registry header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MLX90614_REGISTRY_H
+#define RASPBERRYPI4B_DRIVER_MLX90614_REGISTRY_H
+
+#include "driver_mlx90614_registry.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup mlx90614_registry_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 registry file default definition
+ */
+#define MLX90614_REGISTRY_FILE_DEFAULT_CAPACITY        16        /**< default entry number of a new file */
+
+/**
+ * @brief mlx90614 registry file structure definition
+ */
+typedef struct mlx90614_registry_file_s
+{
+    int fd;                                /**< file handle */
+    uint8_t *map;                          /**< mapped file */
+    size_t size;                           /**< mapped size */
+    mlx90614_registry_t registry;          /**< registry on the mapped file */
+} mlx90614_registry_file_t;
+
+/**
+ * @brief     open and map a registry file
+ * @param[in] *file pointer to an mlx90614 registry file structure
+ * @param[in] *path pointer to a file path
+ * @param[in] capacity entry number of a new file, 0 means the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      an existing file keeps its size, a broken file is formatted,
+ *            entries are written straight into the shared mapping
+ */
+uint8_t mlx90614_registry_file_open(mlx90614_registry_file_t *file, const char *path, uint32_t capacity);
+
+/**
+ * @brief     sync and unmap a registry file
+ * @param[in] *file pointer to an mlx90614 registry file structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_registry_file_close(mlx90614_registry_file_t *file);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
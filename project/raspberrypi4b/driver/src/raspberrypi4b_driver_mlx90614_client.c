@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      raspberrypi4b_driver_mlx90614_client.c
+ * @brief     raspberrypi4b driver mlx90614 client source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_mlx90614_client.h"
+
+/**
+ * @brief     open the client
+ * @param[in] *client pointer to an mlx90614 client structure
+ * @param[in] *name pointer to a shm object name, NULL means the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t mlx90614_client_open(mlx90614_client_t *client, const char *name)
+{
+    if (shm_ring_open(&client->ring, (name != NULL) ? name : MLX90614_CLIENT_DEFAULT_NAME) != 0)
+    {
+        return 1;
+    }
+    
+    /* check the record layout */
+    if (client->ring.header->record_size != sizeof(mlx90614_sample_t))
+    {
+        (void)shm_ring_close(&client->ring);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     close the client
+ * @param[in] *client pointer to an mlx90614 client structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_client_close(mlx90614_client_t *client)
+{
+    return shm_ring_close(&client->ring);
+}
+
+/**
+ * @brief      read the next sample
+ * @param[in]  *client pointer to an mlx90614 client structure
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new sample
+ * @note       none
+ */
+uint8_t mlx90614_client_read(mlx90614_client_t *client, mlx90614_sample_t *sample)
+{
+    return shm_ring_read(&client->ring, sample);
+}
+
+/**
+ * @brief      get the next sample in the shared memory without copying
+ * @param[in]  *client pointer to an mlx90614 client structure
+ * @param[out] **sample pointer to a sample address buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new sample
+ * @note       the sample must be checked with mlx90614_client_release after use
+ */
+uint8_t mlx90614_client_peek(mlx90614_client_t *client, const mlx90614_sample_t **sample)
+{
+    return shm_ring_peek(&client->ring, (const void **)sample);
+}
+
+/**
+ * @brief     release the sample got by mlx90614_client_peek
+ * @param[in] *client pointer to an mlx90614 client structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sample was overwritten while in use and must be dropped
+ * @note      none
+ */
+uint8_t mlx90614_client_release(mlx90614_client_t *client)
+{
+    return shm_ring_release(&client->ring);
+}
+
+/**
+ * @brief     get the number of lost samples
+ * @param[in] *client pointer to an mlx90614 client structure
+ * @return    samples overwritten before this client read them
+ * @note      none
+ */
+uint64_t mlx90614_client_lost(mlx90614_client_t *client)
+{
+    return client->ring.lost;
+}
+
+/**
+ * @brief     open the latest value table
+ * @param[in] *latest pointer to an mlx90614 latest structure
+ * @param[in] *name pointer to the daemon shm object name, NULL means the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the table object is named name + MLX90614_LATEST_SUFFIX
+ */
+uint8_t mlx90614_latest_open(mlx90614_latest_t *latest, const char *name)
+{
+    char buf[64];
+    
+    (void)snprintf(buf, sizeof(buf), "%s%s", (name != NULL) ? name : MLX90614_CLIENT_DEFAULT_NAME,
+                   MLX90614_LATEST_SUFFIX);
+    if (shm_table_open(&latest->table, buf) != 0)
+    {
+        return 1;
+    }
+    
+    /* check the record layout */
+    if (latest->table.header->record_size != sizeof(mlx90614_sample_t))
+    {
+        (void)shm_table_close(&latest->table);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     close the latest value table
+ * @param[in] *latest pointer to an mlx90614 latest structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_latest_close(mlx90614_latest_t *latest)
+{
+    return shm_table_close(&latest->table);
+}
+
+/**
+ * @brief      find the slot of a sensor
+ * @param[in]  *latest pointer to an mlx90614 latest structure
+ * @param[in]  id 64 bits chip id
+ * @param[out] *index pointer to a slot index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sensor not found
+ * @note       look the slot up once and keep the index
+ */
+uint8_t mlx90614_latest_find(mlx90614_latest_t *latest, uint64_t id, uint32_t *index)
+{
+    return shm_table_find(&latest->table, id, index);
+}
+
+/**
+ * @brief      read the latest sample of a slot
+ * @param[in]  *latest pointer to an mlx90614 latest structure
+ * @param[in]  index slot index
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       no syscall, torn reads are retried
+ */
+uint8_t mlx90614_latest_read(mlx90614_latest_t *latest, uint32_t index, mlx90614_sample_t *sample)
+{
+    if (shm_table_read(&latest->table, index, sample) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
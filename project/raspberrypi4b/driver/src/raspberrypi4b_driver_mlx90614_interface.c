@@ -47,6 +47,7 @@
  * @brief iic device handle definition
  */
 static int gs_fd;                           /**< iic handle */
+static uint32_t gs_ref = 0;                 /**< iic handle reference count */
 
 /**
  * @brief  interface iic bus init
@@ -57,7 +58,20 @@ static int gs_fd;                           /**< iic handle */
  */
 uint8_t mlx90614_interface_iic_init(void)
 {
-    return iic_init(IIC_DEVICE_NAME, &gs_fd);
+    /* the bus is shared by all handles */
+    if (gs_ref != 0)
+    {
+        gs_ref++;
+        
+        return 0;
+    }
+    if (iic_init(IIC_DEVICE_NAME, &gs_fd) != 0)
+    {
+        return 1;
+    }
+    gs_ref = 1;
+    
+    return 0;
 }
 
 /**
@@ -69,7 +83,20 @@ uint8_t mlx90614_interface_iic_init(void)
  */
 uint8_t mlx90614_interface_iic_deinit(void)
 {
-    return iic_deinit(gs_fd);
+    /* close the bus with the last handle */
+    if (gs_ref > 1)
+    {
+        gs_ref--;
+        
+        return 0;
+    }
+    if (iic_deinit(gs_fd) != 0)
+    {
+        return 1;
+    }
+    gs_ref = 0;
+    
+    return 0;
 }
 
 /**
@@ -0,0 +1,572 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      raspberrypi4b_driver_mlx90614_log.c
+ * @brief     driver mlx90614 log source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_mlx90614_log.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+/**
+ * @brief mlx90614 log max record size definition
+ */
+#define MLX90614_LOG_MAX_RECORD_SIZE        16        /**< 10 bytes time delta and 3 bytes for each raw delta */
+
+/**
+ * @brief     encode a varint
+ * @param[in] *p pointer to a buffer
+ * @param[in] v value
+ * @return    pointer after the encoded bytes
+ * @note      none
+ */
+static inline uint8_t *a_mlx90614_log_put_varint(uint8_t *p, uint64_t v)
+{
+    while (v >= 0x80)
+    {
+        *p++ = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    *p++ = (uint8_t)v;
+    
+    return p;
+}
+
+/**
+ * @brief      decode a varint
+ * @param[in]  *p pointer to a buffer
+ * @param[in]  *end pointer to the end of the buffer
+ * @param[out] *v pointer to a value buffer
+ * @return     pointer after the decoded bytes, NULL when broken
+ * @note       none
+ */
+static inline const uint8_t *a_mlx90614_log_get_varint(const uint8_t *p, const uint8_t *end, uint64_t *v)
+{
+    uint64_t r = 0;
+    uint32_t shift = 0;
+    
+    while (p < end)
+    {
+        uint8_t b = *p++;
+        
+        r |= (uint64_t)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0)
+        {
+            *v = r;
+            
+            return p;
+        }
+        shift += 7;
+        if (shift > 63)
+        {
+            break;
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     zigzag encode a raw data delta
+ * @param[in] now current raw data
+ * @param[in] last last raw data
+ * @return    encoded delta
+ * @note      none
+ */
+static inline uint32_t a_mlx90614_log_zigzag(uint16_t now, uint16_t last)
+{
+    int32_t d = (int32_t)now - (int32_t)last;
+    
+    return ((uint32_t)d << 1) ^ (uint32_t)(d >> 31);
+}
+
+/**
+ * @brief     zigzag decode a raw data delta
+ * @param[in] v encoded delta
+ * @param[in] last last raw data
+ * @return    raw data
+ * @note      none
+ */
+static inline uint16_t a_mlx90614_log_unzigzag(uint64_t v, uint16_t last)
+{
+    int32_t d = (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+    
+    return (uint16_t)((int32_t)last + d);
+}
+
+/**
+ * @brief     reset the current block
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @param[in] id 64 bits chip id
+ * @param[in] config1 config1 register value
+ * @note      none
+ */
+static void a_mlx90614_log_block_reset(mlx90614_log_writer_t *writer, uint64_t id, uint16_t config1)
+{
+    memset(writer->b.buf, 0, MLX90614_LOG_BLOCK_SIZE);
+    writer->b.header.magic = MLX90614_LOG_BLOCK_MAGIC;
+    writer->b.header.id = id;
+    writer->b.header.config1 = config1;
+    writer->last_ambient = 0;
+    writer->last_object = 0;
+    writer->dirty = 0;
+}
+
+/**
+ * @brief     write the current block and start the next one
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_mlx90614_log_block_next(mlx90614_log_writer_t *writer)
+{
+    if (writer->b.header.count == 0)
+    {
+        return 0;
+    }
+    if (mlx90614_log_writer_flush(writer) != 0)
+    {
+        return 1;
+    }
+    writer->block++;
+    a_mlx90614_log_block_reset(writer, writer->b.header.id, writer->b.header.config1);
+    
+    return 0;
+}
+
+/**
+ * @brief     open a log file for appending
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @param[in] *path pointer to a file path
+ * @param[in] id 64 bits chip id
+ * @param[in] config1 config1 register value
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      new records always start a new block after the existing ones
+ */
+uint8_t mlx90614_log_writer_open(mlx90614_log_writer_t *writer, const char *path, uint64_t id, uint16_t config1)
+{
+    struct stat st;
+    uint32_t header[MLX90614_LOG_HEADER_SIZE / 4];
+    
+    memset(writer, 0, sizeof(mlx90614_log_writer_t));
+    writer->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (writer->fd < 0)
+    {
+        perror("mlx90614: open failed.\n");
+        
+        return 1;
+    }
+    if (fstat(writer->fd, &st) < 0)
+    {
+        goto failed;
+    }
+    
+    if (st.st_size == 0)
+    {
+        /* new file */
+        memset(header, 0, sizeof(header));
+        header[0] = MLX90614_LOG_MAGIC;
+        header[1] = MLX90614_LOG_VERSION;
+        header[2] = MLX90614_LOG_BLOCK_SIZE;
+        if (pwrite(writer->fd, header, sizeof(header), 0) != (ssize_t)sizeof(header))
+        {
+            goto failed;
+        }
+        writer->block = 0;
+    }
+    else
+    {
+        /* existing file, append after the last block */
+        if ((pread(writer->fd, header, sizeof(header), 0) != (ssize_t)sizeof(header)) ||
+            (header[0] != MLX90614_LOG_MAGIC) || (header[1] != MLX90614_LOG_VERSION) ||
+            (header[2] != MLX90614_LOG_BLOCK_SIZE))
+        {
+            goto failed;
+        }
+        writer->block = ((uint64_t)st.st_size - MLX90614_LOG_HEADER_SIZE + MLX90614_LOG_BLOCK_SIZE - 1) /
+                        MLX90614_LOG_BLOCK_SIZE;
+    }
+    a_mlx90614_log_block_reset(writer, id, config1);
+    
+    return 0;
+    
+    failed:
+    (void)close(writer->fd);
+    writer->fd = -1;
+    
+    return 1;
+}
+
+/**
+ * @brief     close a log file
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_log_writer_close(mlx90614_log_writer_t *writer)
+{
+    uint8_t res;
+    
+    res = mlx90614_log_writer_flush(writer);
+    if (close(writer->fd) < 0)
+    {
+        res = 1;
+    }
+    writer->fd = -1;
+    
+    return res;
+}
+
+/**
+ * @brief     change the sensor or config1 fingerprint of the following records
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @param[in] id 64 bits chip id
+ * @param[in] config1 config1 register value
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a change starts a new block
+ */
+uint8_t mlx90614_log_writer_set_stream(mlx90614_log_writer_t *writer, uint64_t id, uint16_t config1)
+{
+    if ((writer->b.header.id == id) && (writer->b.header.config1 == config1))
+    {
+        return 0;
+    }
+    if (a_mlx90614_log_block_next(writer) != 0)
+    {
+        return 1;
+    }
+    writer->b.header.id = id;
+    writer->b.header.config1 = config1;
+    
+    return 0;
+}
+
+/**
+ * @brief     append a record
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @param[in] timestamp_us timestamp in us
+ * @param[in] ambient_raw ambient raw data
+ * @param[in] object_raw object raw data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      only touches the file when a block is full
+ */
+uint8_t mlx90614_log_writer_append(mlx90614_log_writer_t *writer, uint64_t timestamp_us,
+                                   uint16_t ambient_raw, uint16_t object_raw)
+{
+    mlx90614_log_block_t *h = &writer->b.header;
+    uint8_t *p;
+    
+    /* deltas are unsigned, a clock step back starts a new block */
+    if ((h->count != 0) &&
+        ((h->used > MLX90614_LOG_BLOCK_PAYLOAD - MLX90614_LOG_MAX_RECORD_SIZE) || (timestamp_us < writer->last_us)))
+    {
+        if (a_mlx90614_log_block_next(writer) != 0)
+        {
+            return 1;
+        }
+    }
+    if (h->count == 0)
+    {
+        h->first_us = timestamp_us;
+        writer->last_us = timestamp_us;
+    }
+    
+    /* encode */
+    p = writer->b.buf + MLX90614_LOG_BLOCK_HEADER_SIZE + h->used;
+    p = a_mlx90614_log_put_varint(p, timestamp_us - writer->last_us);
+    p = a_mlx90614_log_put_varint(p, a_mlx90614_log_zigzag(ambient_raw, writer->last_ambient));
+    p = a_mlx90614_log_put_varint(p, a_mlx90614_log_zigzag(object_raw, writer->last_object));
+    h->used = (uint16_t)(p - (writer->b.buf + MLX90614_LOG_BLOCK_HEADER_SIZE));
+    h->count++;
+    h->last_us = timestamp_us;
+    writer->last_us = timestamp_us;
+    writer->last_ambient = ambient_raw;
+    writer->last_object = object_raw;
+    writer->dirty = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief     write the current partial block to the file
+ * @param[in] *writer pointer to an mlx90614 log writer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      the block is rewritten in place until it is full
+ */
+uint8_t mlx90614_log_writer_flush(mlx90614_log_writer_t *writer)
+{
+    off_t offset;
+    
+    if (writer->dirty == 0)
+    {
+        return 0;
+    }
+    offset = (off_t)(MLX90614_LOG_HEADER_SIZE + writer->block * MLX90614_LOG_BLOCK_SIZE);
+    if (pwrite(writer->fd, writer->b.buf, MLX90614_LOG_BLOCK_SIZE, offset) != MLX90614_LOG_BLOCK_SIZE)
+    {
+        perror("mlx90614: write failed.\n");
+        
+        return 1;
+    }
+    writer->dirty = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     map a log file
+ * @param[in] *reader pointer to an mlx90614 log reader structure
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t mlx90614_log_reader_open(mlx90614_log_reader_t *reader, const char *path)
+{
+    int fd;
+    struct stat st;
+    void *addr;
+    const uint32_t *header;
+    
+    memset(reader, 0, sizeof(mlx90614_log_reader_t));
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        perror("mlx90614: open failed.\n");
+        
+        return 1;
+    }
+    if ((fstat(fd, &st) < 0) || ((size_t)st.st_size < MLX90614_LOG_HEADER_SIZE))
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED)
+    {
+        perror("mlx90614: mmap failed.\n");
+        
+        return 1;
+    }
+    
+    /* check the header */
+    header = (const uint32_t *)addr;
+    if ((header[0] != MLX90614_LOG_MAGIC) || (header[1] != MLX90614_LOG_VERSION) ||
+        (header[2] != MLX90614_LOG_BLOCK_SIZE))
+    {
+        (void)munmap(addr, (size_t)st.st_size);
+        
+        return 1;
+    }
+    (void)madvise(addr, (size_t)st.st_size, MADV_SEQUENTIAL);
+    reader->map = (const uint8_t *)addr;
+    reader->size = (size_t)st.st_size;
+    reader->blocks = (reader->size - MLX90614_LOG_HEADER_SIZE) / MLX90614_LOG_BLOCK_SIZE;
+    
+    return 0;
+}
+
+/**
+ * @brief     unmap a log file
+ * @param[in] *reader pointer to an mlx90614 log reader structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_log_reader_close(mlx90614_log_reader_t *reader)
+{
+    uint8_t res = 0;
+    
+    if (reader->map != NULL)
+    {
+        if (munmap((void *)reader->map, reader->size) < 0)
+        {
+            res = 1;
+        }
+        reader->map = NULL;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief      get a block header
+ * @param[in]  *reader pointer to an mlx90614 log reader structure
+ * @param[in]  index block index
+ * @param[out] *block pointer to a block header buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index is invalid
+ *             - 4 block is broken
+ * @note       none
+ */
+uint8_t mlx90614_log_reader_block(mlx90614_log_reader_t *reader, uint64_t index, mlx90614_log_block_t *block)
+{
+    if (index >= reader->blocks)
+    {
+        return 1;
+    }
+    memcpy(block, reader->map + MLX90614_LOG_HEADER_SIZE + index * MLX90614_LOG_BLOCK_SIZE,
+           sizeof(mlx90614_log_block_t));
+    if ((block->magic != MLX90614_LOG_BLOCK_MAGIC) || (block->used > MLX90614_LOG_BLOCK_PAYLOAD))
+    {
+        return 4;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      find the first block holding records at or after a time
+ * @param[in]  *reader pointer to an mlx90614 log reader structure
+ * @param[in]  timestamp_us timestamp in us
+ * @param[out] *index pointer to a block index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no such block
+ * @note       binary search on the block headers, blocks must be in time order
+ */
+uint8_t mlx90614_log_reader_seek(mlx90614_log_reader_t *reader, uint64_t timestamp_us, uint64_t *index)
+{
+    uint64_t lo = 0;
+    uint64_t hi = reader->blocks;
+    mlx90614_log_block_t block;
+    
+    while (lo < hi)
+    {
+        uint64_t mid = lo + (hi - lo) / 2;
+        
+        /* a broken block is treated as older, it is skipped by the caller */
+        if ((mlx90614_log_reader_block(reader, mid, &block) != 0) || (block.last_us < timestamp_us))
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if (lo >= reader->blocks)
+    {
+        return 1;
+    }
+    *index = lo;
+    
+    return 0;
+}
+
+/**
+ * @brief         decode all records of a block
+ * @param[in]     *reader pointer to an mlx90614 log reader structure
+ * @param[in]     index block index
+ * @param[out]    *record pointer to a record buffer
+ * @param[in,out] *len pointer to a record buffer length
+ * @return        status code
+ *                - 0 success
+ *                - 1 index is invalid
+ *                - 4 block is broken
+ *                - 5 buffer is too small
+ * @note          MLX90614_LOG_BLOCK_MAX_RECORD records always fit
+ */
+uint8_t mlx90614_log_reader_decode(mlx90614_log_reader_t *reader, uint64_t index,
+                                   mlx90614_log_record_t *record, uint16_t *len)
+{
+    uint8_t res;
+    uint16_t i;
+    mlx90614_log_block_t block;
+    const uint8_t *p;
+    const uint8_t *end;
+    uint64_t t;
+    uint16_t ambient = 0;
+    uint16_t object = 0;
+    
+    res = mlx90614_log_reader_block(reader, index, &block);
+    if (res != 0)
+    {
+        return res;
+    }
+    if (block.count > *len)
+    {
+        return 5;
+    }
+    
+    /* decode */
+    p = reader->map + MLX90614_LOG_HEADER_SIZE + index * MLX90614_LOG_BLOCK_SIZE + MLX90614_LOG_BLOCK_HEADER_SIZE;
+    end = p + block.used;
+    t = block.first_us;
+    for (i = 0; i < block.count; i++)
+    {
+        uint64_t v;
+        
+        if ((p = a_mlx90614_log_get_varint(p, end, &v)) == NULL)
+        {
+            return 4;
+        }
+        t += v;
+        if ((p = a_mlx90614_log_get_varint(p, end, &v)) == NULL)
+        {
+            return 4;
+        }
+        ambient = a_mlx90614_log_unzigzag(v, ambient);
+        if ((p = a_mlx90614_log_get_varint(p, end, &v)) == NULL)
+        {
+            return 4;
+        }
+        object = a_mlx90614_log_unzigzag(v, object);
+        record[i].timestamp_us = t;
+        record[i].ambient_raw = ambient;
+        record[i].object_raw = object;
+        memset(record[i].reserved, 0, sizeof(record[i].reserved));
+    }
+    *len = block.count;
+    
+    return 0;
+}
@@ -0,0 +1,400 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      raspberrypi4b_driver_mlx90614_loop.c
+ * @brief     raspberrypi4b driver mlx90614 loop source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_mlx90614_loop.h"
+
+static uint8_t gs_wake_pulse;        /**< a wake pulse holds the shared bus */
+
+/**
+ * @brief     resume sampling or go idle
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @note      none
+ */
+static void a_mlx90614_loop_resume(mlx90614_loop_sensor_t *sensor)
+{
+    if (sensor->period_ms != 0)
+    {
+        sensor->state = MLX90614_LOOP_STATE_SAMPLE;
+        (void)loop_timer_start(&sensor->timer, sensor->period_ms, sensor->period_ms);
+    }
+    else
+    {
+        sensor->state = MLX90614_LOOP_STATE_IDLE;
+        (void)loop_timer_stop(&sensor->timer);
+    }
+}
+
+/**
+ * @brief     finish an operation
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @param[in] op finished operation
+ * @param[in] res operation result
+ * @note      none
+ */
+static void a_mlx90614_loop_done(mlx90614_loop_sensor_t *sensor, mlx90614_loop_op_t op, uint8_t res)
+{
+    a_mlx90614_loop_resume(sensor);
+    if (sensor->done_callback != NULL)
+    {
+        sensor->done_callback(sensor, op, res);
+    }
+}
+
+/**
+ * @brief     timer expiration handler
+ * @param[in] *timer pointer to a loop timer structure
+ * @note      none
+ */
+static void a_mlx90614_loop_timer_handler(loop_timer_t *timer)
+{
+    mlx90614_loop_sensor_t *sensor = (mlx90614_loop_sensor_t *)timer->arg;
+    
+    /* sda is held low by a wake pulse, keep off the bus */
+    if ((gs_wake_pulse != 0) &&
+        ((sensor->state == MLX90614_LOOP_STATE_SAMPLE) ||
+         (sensor->state == MLX90614_LOOP_STATE_ERASE) ||
+         (sensor->state == MLX90614_LOOP_STATE_PROGRAM)))
+    {
+        (void)loop_timer_start(&sensor->timer, MLX90614_LOOP_BUS_RETRY_MS,
+                               (sensor->state == MLX90614_LOOP_STATE_SAMPLE) ? sensor->period_ms : 0);
+        
+        return;
+    }
+    
+    switch (sensor->state)
+    {
+        case MLX90614_LOOP_STATE_SAMPLE :
+        {
+            uint8_t res;
+            uint16_t ambient_raw = 0;
+            uint16_t object_raw = 0;
+            mlx90614_temperature_t celsius;
+            
+            /* two single smbus transactions, no delay */
+            res = mlx90614_read_ambient(&sensor->handle, &ambient_raw, &celsius);
+            if (res == 0)
+            {
+                res = mlx90614_read_object1(&sensor->handle, &object_raw, &celsius);
+            }
+            if (sensor->sample_callback != NULL)
+            {
+                sensor->sample_callback(sensor, res, ambient_raw, object_raw);
+            }
+            
+            break;
+        }
+        case MLX90614_LOOP_STATE_WAKE :
+        {
+            /* end the sda low pulse */
+            gs_wake_pulse = 0;
+            if (mlx90614_exit_sleep_mode_stop(&sensor->handle) != 0)
+            {
+                a_mlx90614_loop_done(sensor, MLX90614_LOOP_OP_WAKE, 1);
+                
+                break;
+            }
+            sensor->state = MLX90614_LOOP_STATE_SETTLE;
+            (void)loop_timer_start(&sensor->timer, MLX90614_WAKE_SETTLE_MS, 0);
+            
+            break;
+        }
+        case MLX90614_LOOP_STATE_SETTLE :
+        {
+            a_mlx90614_loop_done(sensor, MLX90614_LOOP_OP_WAKE, 0);
+            
+            break;
+        }
+        case MLX90614_LOOP_STATE_ERASE :
+        {
+            /* the cell is erased, write the data */
+            if (mlx90614_eeprom_program(&sensor->handle, sensor->eeprom_reg, sensor->eeprom_data) != 0)
+            {
+                a_mlx90614_loop_done(sensor, MLX90614_LOOP_OP_EEPROM, 1);
+                
+                break;
+            }
+            sensor->state = MLX90614_LOOP_STATE_PROGRAM;
+            (void)loop_timer_start(&sensor->timer, MLX90614_EEPROM_WRITE_MS, 0);
+            
+            break;
+        }
+        case MLX90614_LOOP_STATE_PROGRAM :
+        {
+            uint16_t check;
+            
+            /* read back */
+            if (mlx90614_get_reg(&sensor->handle, sensor->eeprom_reg, &check) != 0)
+            {
+                a_mlx90614_loop_done(sensor, MLX90614_LOOP_OP_EEPROM, 1);
+                
+                break;
+            }
+            a_mlx90614_loop_done(sensor, MLX90614_LOOP_OP_EEPROM, (check == sensor->eeprom_data) ? 0 : 1);
+            
+            break;
+        }
+        default :
+        {
+            /* stale expiration */
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     check if an operation is in progress
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @return    1 if busy, 0 if not
+ * @note      none
+ */
+static uint8_t a_mlx90614_loop_busy(mlx90614_loop_sensor_t *sensor)
+{
+    return (uint8_t)((sensor->state == MLX90614_LOOP_STATE_WAKE) ||
+                     (sensor->state == MLX90614_LOOP_STATE_SETTLE) ||
+                     (sensor->state == MLX90614_LOOP_STATE_ERASE) ||
+                     (sensor->state == MLX90614_LOOP_STATE_PROGRAM));
+}
+
+/**
+ * @brief     loop sensor init
+ * @param[in] loop loop handle
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @param[in] addr iic address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      callbacks and user data can be set after this call
+ */
+uint8_t mlx90614_loop_sensor_init(int loop, mlx90614_loop_sensor_t *sensor, uint8_t addr)
+{
+    /* link interface function */
+    memset(sensor, 0, sizeof(mlx90614_loop_sensor_t));
+    DRIVER_MLX90614_LINK_INIT(&sensor->handle, mlx90614_handle_t);
+    DRIVER_MLX90614_LINK_IIC_INIT(&sensor->handle, mlx90614_interface_iic_init);
+    DRIVER_MLX90614_LINK_IIC_DEINIT(&sensor->handle, mlx90614_interface_iic_deinit);
+    DRIVER_MLX90614_LINK_IIC_READ(&sensor->handle, mlx90614_interface_iic_read);
+    DRIVER_MLX90614_LINK_IIC_WRITE(&sensor->handle, mlx90614_interface_iic_write);
+    DRIVER_MLX90614_LINK_SCL_WRITE(&sensor->handle, mlx90614_interface_scl_write);
+    DRIVER_MLX90614_LINK_SDA_WRITE(&sensor->handle, mlx90614_interface_sda_write);
+    DRIVER_MLX90614_LINK_DELAY_MS(&sensor->handle, mlx90614_interface_delay_ms);
+    DRIVER_MLX90614_LINK_DEBUG_PRINT(&sensor->handle, mlx90614_interface_debug_print);
+    
+    /* set address */
+    if (mlx90614_set_addr(&sensor->handle, addr) != 0)
+    {
+        return 1;
+    }
+    
+    /* mlx90614 init */
+    if (mlx90614_init(&sensor->handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* add the deadline timer */
+    if (loop_timer_add(loop, &sensor->timer, a_mlx90614_loop_timer_handler, sensor) != 0)
+    {
+        (void)mlx90614_deinit(&sensor->handle);
+        
+        return 1;
+    }
+    sensor->state = MLX90614_LOOP_STATE_IDLE;
+    
+    return 0;
+}
+
+/**
+ * @brief     loop sensor deinit
+ * @param[in] loop loop handle
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mlx90614_loop_sensor_deinit(int loop, mlx90614_loop_sensor_t *sensor)
+{
+    uint8_t res = 0;
+    
+    if (sensor->state == MLX90614_LOOP_STATE_WAKE)
+    {
+        /* release the bus */
+        gs_wake_pulse = 0;
+        (void)mlx90614_exit_sleep_mode_stop(&sensor->handle);
+    }
+    if (loop_timer_remove(loop, &sensor->timer) != 0)
+    {
+        res = 1;
+    }
+    if (mlx90614_deinit(&sensor->handle) != 0)
+    {
+        res = 1;
+    }
+    sensor->state = MLX90614_LOOP_STATE_IDLE;
+    
+    return res;
+}
+
+/**
+ * @brief     start periodic sampling
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @param[in] period_ms sampling period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      sampling of a busy or sleeping sensor begins when it becomes idle
+ */
+uint8_t mlx90614_loop_sensor_start(mlx90614_loop_sensor_t *sensor, uint32_t period_ms)
+{
+    if (period_ms == 0)
+    {
+        return 1;
+    }
+    
+    sensor->period_ms = period_ms;
+    if ((sensor->state == MLX90614_LOOP_STATE_IDLE) || (sensor->state == MLX90614_LOOP_STATE_SAMPLE))
+    {
+        sensor->state = MLX90614_LOOP_STATE_SAMPLE;
+        
+        return loop_timer_start(&sensor->timer, period_ms, period_ms);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     stop periodic sampling
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      none
+ */
+uint8_t mlx90614_loop_sensor_stop(mlx90614_loop_sensor_t *sensor)
+{
+    sensor->period_ms = 0;
+    if (sensor->state == MLX90614_LOOP_STATE_SAMPLE)
+    {
+        sensor->state = MLX90614_LOOP_STATE_IDLE;
+        
+        return loop_timer_stop(&sensor->timer);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     put the sensor to sleep
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 sleep failed
+ *            - 4 sensor or bus is busy
+ * @note      none
+ */
+uint8_t mlx90614_loop_sensor_sleep(mlx90614_loop_sensor_t *sensor)
+{
+    if ((a_mlx90614_loop_busy(sensor) != 0) || (gs_wake_pulse != 0))
+    {
+        return 4;
+    }
+    
+    if (mlx90614_enter_sleep_mode(&sensor->handle) != 0)
+    {
+        return 1;
+    }
+    sensor->state = MLX90614_LOOP_STATE_SLEEP;
+    
+    return loop_timer_stop(&sensor->timer);
+}
+
+/**
+ * @brief     wake the sensor up without blocking
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wake failed
+ *            - 4 sensor or bus is busy
+ * @note      done_callback is called with MLX90614_LOOP_OP_WAKE when the data is valid, only one wake
+ *            pulse runs at a time because ending it releases sda for the whole bus
+ */
+uint8_t mlx90614_loop_sensor_wake(mlx90614_loop_sensor_t *sensor)
+{
+    if ((a_mlx90614_loop_busy(sensor) != 0) || (gs_wake_pulse != 0))
+    {
+        return 4;
+    }
+    
+    if (mlx90614_exit_sleep_mode_start(&sensor->handle) != 0)
+    {
+        return 1;
+    }
+    gs_wake_pulse = 1;
+    sensor->state = MLX90614_LOOP_STATE_WAKE;
+    
+    return loop_timer_start(&sensor->timer, MLX90614_WAKE_PULSE_MS, 0);
+}
+
+/**
+ * @brief     write an eeprom register without blocking
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @param[in] reg eeprom register address
+ * @param[in] data written data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 4 sensor or bus is busy
+ * @note      done_callback is called with MLX90614_LOOP_OP_EEPROM after the read back check
+ */
+uint8_t mlx90614_loop_sensor_write_eeprom(mlx90614_loop_sensor_t *sensor, uint8_t reg, uint16_t data)
+{
+    if ((a_mlx90614_loop_busy(sensor) != 0) || (sensor->state == MLX90614_LOOP_STATE_SLEEP) ||
+        (gs_wake_pulse != 0))
+    {
+        return 4;
+    }
+    
+    if (mlx90614_eeprom_erase(&sensor->handle, reg) != 0)
+    {
+        return 1;
+    }
+    sensor->eeprom_reg = reg;
+    sensor->eeprom_data = data;
+    sensor->state = MLX90614_LOOP_STATE_ERASE;
+    
+    return loop_timer_start(&sensor->timer, MLX90614_EEPROM_WRITE_MS, 0);
+}
@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      raspberrypi4b_driver_mlx90614_registry.c
+ * @brief     raspberrypi4b driver mlx90614 registry source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_mlx90614_registry.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+/**
+ * @brief     open and map a registry file
+ * @param[in] *file pointer to an mlx90614 registry file structure
+ * @param[in] *path pointer to a file path
+ * @param[in] capacity entry number of a new file, 0 means the default
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      an existing file keeps its size, a broken file is formatted,
+ *            entries are written straight into the shared mapping
+ */
+uint8_t mlx90614_registry_file_open(mlx90614_registry_file_t *file, const char *path, uint32_t capacity)
+{
+    struct stat st;
+    void *addr;
+    uint8_t res;
+    
+    file->map = NULL;
+    file->size = 0;
+    file->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (file->fd < 0)
+    {
+        perror("mlx90614: open failed.\n");
+        
+        return 1;
+    }
+    if (fstat(file->fd, &st) < 0)
+    {
+        goto failed;
+    }
+    
+    /* size a new or truncated file */
+    if (capacity == 0)
+    {
+        capacity = MLX90614_REGISTRY_FILE_DEFAULT_CAPACITY;
+    }
+    if ((size_t)st.st_size < MLX90614_REGISTRY_SIZE(1))
+    {
+        if (ftruncate(file->fd, (off_t)MLX90614_REGISTRY_SIZE(capacity)) < 0)
+        {
+            goto failed;
+        }
+        file->size = MLX90614_REGISTRY_SIZE(capacity);
+    }
+    else
+    {
+        file->size = (size_t)st.st_size;
+    }
+    
+    addr = mmap(NULL, file->size, PROT_READ | PROT_WRITE, MAP_SHARED, file->fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        perror("mlx90614: mmap failed.\n");
+        
+        goto failed;
+    }
+    file->map = (uint8_t *)addr;
+    
+    /* writes land in the page cache, no write function needed */
+    res = mlx90614_registry_init(&file->registry, file->map, (uint32_t)file->size, NULL);
+    if ((res != 0) && (res != 5))
+    {
+        (void)munmap(file->map, file->size);
+        file->map = NULL;
+        
+        goto failed;
+    }
+    
+    return 0;
+    
+    failed:
+    (void)close(file->fd);
+    file->fd = -1;
+    
+    return 1;
+}
+
+/**
+ * @brief     sync and unmap a registry file
+ * @param[in] *file pointer to an mlx90614 registry file structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mlx90614_registry_file_close(mlx90614_registry_file_t *file)
+{
+    uint8_t res;
+    
+    res = 0;
+    if (file->map != NULL)
+    {
+        if (msync(file->map, file->size, MS_SYNC) < 0)
+        {
+            res = 1;
+        }
+        if (munmap(file->map, file->size) < 0)
+        {
+            res = 1;
+        }
+        file->map = NULL;
+    }
+    if (close(file->fd) < 0)
+    {
+        res = 1;
+    }
+    file->fd = -1;
+    
+    return res;
+}
@@ -0,0 +1,131 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      gpio.h
+ * @brief     gpio header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef GPIO_H
+#define GPIO_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup gpio gpio function
+ * @brief    gpio function modules
+ * @{
+ */
+
+/**
+ * @brief gpio edge enumeration definition
+ */
+typedef enum
+{
+    GPIO_EDGE_RISING  = 0x01,        /**< rising edge */
+    GPIO_EDGE_FALLING = 0x02,        /**< falling edge */
+    GPIO_EDGE_BOTH    = 0x03,        /**< both edges */
+} gpio_edge_t;
+
+/**
+ * @brief gpio event structure definition
+ */
+typedef struct gpio_event_s
+{
+    uint64_t timestamp_ns;        /**< kernel monotonic timestamp in ns */
+    uint8_t level;                /**< level after the edge */
+} gpio_event_t;
+
+/**
+ * @brief      gpio edge init
+ * @param[in]  *name pointer to a gpio chip device name buffer
+ * @param[in]  line gpio line offset
+ * @param[in]  edge detected edges
+ * @param[out] *fd pointer to a gpio handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the handle is pollable, so it can be watched by an epoll loop
+ */
+uint8_t gpio_edge_init(char *name, uint32_t line, gpio_edge_t edge, int *fd);
+
+/**
+ * @brief     gpio edge deinit
+ * @param[in] fd gpio handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t gpio_edge_deinit(int fd);
+
+/**
+ * @brief      gpio edge read the current level
+ * @param[in]  fd gpio handle
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t gpio_edge_read(int fd, uint8_t *level);
+
+/**
+ * @brief      gpio edge wait for the next edge
+ * @param[in]  fd gpio handle
+ * @param[in]  timeout_ms timeout in ms, -1 waits forever
+ * @param[out] *event pointer to a gpio event buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ *             - 4 timeout
+ * @note       the thread sleeps in the kernel until the edge, no bus is polled
+ */
+uint8_t gpio_edge_wait(int fd, int32_t timeout_ms, gpio_event_t *event);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      loop.h
+ * @brief     loop header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef LOOP_H
+#define LOOP_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup loop loop function
+ * @brief    loop function modules
+ * @{
+ */
+
+/**
+ * @brief loop timer structure definition
+ */
+typedef struct loop_timer_s
+{
+    int fd;                                             /**< timerfd handle */
+    void (*callback)(struct loop_timer_s *timer);       /**< expiration callback */
+    void *arg;                                          /**< user argument */
+} loop_timer_t;
+
+/**
+ * @brief      loop init
+ * @param[out] *fd pointer to a loop handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       none
+ */
+uint8_t loop_init(int *fd);
+
+/**
+ * @brief     loop deinit
+ * @param[in] fd loop handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t loop_deinit(int fd);
+
+/**
+ * @brief     add a timer to the loop
+ * @param[in] fd loop handle
+ * @param[in] *timer pointer to a loop timer structure
+ * @param[in] *callback pointer to an expiration callback
+ * @param[in] *arg pointer to a user argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the timer is created disarmed
+ */
+uint8_t loop_timer_add(int fd, loop_timer_t *timer, void (*callback)(loop_timer_t *timer), void *arg);
+
+/**
+ * @brief     remove a timer from the loop
+ * @param[in] fd loop handle
+ * @param[in] *timer pointer to a loop timer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 remove failed
+ * @note      none
+ */
+uint8_t loop_timer_remove(int fd, loop_timer_t *timer);
+
+/**
+ * @brief     arm a timer
+ * @param[in] *timer pointer to a loop timer structure
+ * @param[in] ms first expiration in ms
+ * @param[in] interval_ms period in ms, 0 means one shot
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      ms = 0 expires as soon as the loop runs
+ */
+uint8_t loop_timer_start(loop_timer_t *timer, uint32_t ms, uint32_t interval_ms);
+
+/**
+ * @brief     disarm a timer
+ * @param[in] *timer pointer to a loop timer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      none
+ */
+uint8_t loop_timer_stop(loop_timer_t *timer);
+
+/**
+ * @brief     dispatch the expired timers once
+ * @param[in] fd loop handle
+ * @param[in] timeout_ms wait timeout in ms, -1 means forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+uint8_t loop_run_once(int fd, int timeout_ms);
+
+/**
+ * @brief     dispatch the expired timers until stopped
+ * @param[in] fd loop handle
+ * @param[in] *stop pointer to a stop flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the flag is checked after every dispatch round
+ */
+uint8_t loop_run(int fd, volatile uint8_t *stop);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      shm_ring.h
+ * @brief     shm ring header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SHM_RING_H
+#define SHM_RING_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup shm_ring shm ring function
+ * @brief    shm ring function modules
+ * @{
+ */
+
+/**
+ * @brief shm ring magic definition
+ */
+#define SHM_RING_MAGIC          0x474E4952U        /**< "RING" */
+#define SHM_RING_VERSION        1                  /**< layout version */
+
+/**
+ * @brief shm ring header structure definition
+ * @note  head is written by the single writer only, readers keep their own cursor
+ */
+typedef struct shm_ring_header_s
+{
+    uint32_t magic;                                 /**< magic number */
+    uint32_t version;                               /**< layout version */
+    uint32_t capacity;                              /**< slot number, power of two */
+    uint32_t record_size;                           /**< record size in bytes */
+    uint32_t slot_size;                             /**< slot stride in bytes */
+    uint32_t reserved[11];                          /**< reserved */
+    volatile uint64_t head __attribute__((aligned(64)));        /**< next sequence to be written */
+} shm_ring_header_t;
+
+/**
+ * @brief shm ring structure definition
+ */
+typedef struct shm_ring_s
+{
+    shm_ring_header_t *header;        /**< mapped header */
+    uint8_t *slots;                   /**< mapped slots */
+    size_t size;                      /**< mapped size */
+    uint64_t cursor;                  /**< reader cursor */
+    uint64_t lost;                    /**< records overwritten before this reader got them */
+    char name[64];                    /**< shm object name */
+    uint8_t writer;                   /**< writer flag */
+} shm_ring_t;
+
+/**
+ * @brief     create a ring as the writer
+ * @param[in] *ring pointer to a shm ring structure
+ * @param[in] *name pointer to a shm object name
+ * @param[in] capacity slot number, must be a power of two
+ * @param[in] record_size record size in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      an existing object with the same name is replaced
+ */
+uint8_t shm_ring_create(shm_ring_t *ring, const char *name, uint32_t capacity, uint32_t record_size);
+
+/**
+ * @brief     open a ring as a reader
+ * @param[in] *ring pointer to a shm ring structure
+ * @param[in] *name pointer to a shm object name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the reader starts at the current head
+ */
+uint8_t shm_ring_open(shm_ring_t *ring, const char *name);
+
+/**
+ * @brief     close a ring
+ * @param[in] *ring pointer to a shm ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also unlinks the shm object
+ */
+uint8_t shm_ring_close(shm_ring_t *ring);
+
+/**
+ * @brief     publish a record
+ * @param[in] *ring pointer to a shm ring structure
+ * @param[in] *record pointer to a record buffer
+ * @note      never blocks, the oldest record is overwritten
+ */
+void shm_ring_write(shm_ring_t *ring, const void *record);
+
+/**
+ * @brief      copy the next record
+ * @param[in]  *ring pointer to a shm ring structure
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new record
+ * @note       records overwritten before they are read are counted in ring->lost
+ */
+uint8_t shm_ring_read(shm_ring_t *ring, void *record);
+
+/**
+ * @brief      get the next record in place
+ * @param[in]  *ring pointer to a shm ring structure
+ * @param[out] **record pointer to a record address buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new record
+ * @note       the record must be checked with shm_ring_release after use
+ */
+uint8_t shm_ring_peek(shm_ring_t *ring, const void **record);
+
+/**
+ * @brief     release the record got by shm_ring_peek
+ * @param[in] *ring pointer to a shm ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 record was overwritten while in use
+ * @note      the cursor advances in both cases
+ */
+uint8_t shm_ring_release(shm_ring_t *ring);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      shm_table.h
+ * @brief     shm table header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SHM_TABLE_H
+#define SHM_TABLE_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup shm_table shm table function
+ * @brief    shm table function modules
+ * @{
+ */
+
+/**
+ * @brief shm table definition
+ */
+#define SHM_TABLE_MAGIC            0x4C424154U        /**< "TABL" */
+#define SHM_TABLE_VERSION          1                  /**< layout version */
+#define SHM_TABLE_SLOT_SIZE        64                 /**< one cache line per slot */
+#define SHM_TABLE_MAX_RECORD       48                 /**< max record size in bytes */
+
+/**
+ * @brief shm table header structure definition
+ */
+typedef struct shm_table_header_s
+{
+    uint32_t magic;                 /**< magic number */
+    uint32_t version;               /**< layout version */
+    uint32_t capacity;              /**< slot number */
+    uint32_t record_size;           /**< record size in bytes */
+    volatile uint32_t count;        /**< used slot number */
+    uint32_t reserved[11];          /**< reserved */
+} shm_table_header_t;
+
+/**
+ * @brief shm table slot structure definition
+ * @note  seq is odd while the writer updates the slot
+ */
+typedef struct shm_table_slot_s
+{
+    volatile uint64_t seq;                          /**< sequence lock */
+    volatile uint64_t key;                          /**< slot key */
+    uint8_t data[SHM_TABLE_MAX_RECORD];             /**< record */
+} __attribute__((aligned(SHM_TABLE_SLOT_SIZE))) shm_table_slot_t;
+
+/**
+ * @brief shm table structure definition
+ */
+typedef struct shm_table_s
+{
+    shm_table_header_t *header;        /**< mapped header */
+    shm_table_slot_t *slots;           /**< mapped slots */
+    size_t size;                       /**< mapped size */
+    char name[64];                     /**< shm object name */
+    uint8_t writer;                    /**< writer flag */
+} shm_table_t;
+
+/**
+ * @brief     create a table as the writer
+ * @param[in] *table pointer to a shm table structure
+ * @param[in] *name pointer to a shm object name
+ * @param[in] capacity slot number
+ * @param[in] record_size record size in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      an existing object with the same name is replaced
+ */
+uint8_t shm_table_create(shm_table_t *table, const char *name, uint32_t capacity, uint32_t record_size);
+
+/**
+ * @brief     open a table as a reader
+ * @param[in] *table pointer to a shm table structure
+ * @param[in] *name pointer to a shm object name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t shm_table_open(shm_table_t *table, const char *name);
+
+/**
+ * @brief     close a table
+ * @param[in] *table pointer to a shm table structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also unlinks the shm object
+ */
+uint8_t shm_table_close(shm_table_t *table);
+
+/**
+ * @brief     update a slot
+ * @param[in] *table pointer to a shm table structure
+ * @param[in] index slot index
+ * @param[in] key slot key
+ * @param[in] *record pointer to a record buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 index is invalid
+ * @note      never blocks, slots up to index become visible to readers
+ */
+uint8_t shm_table_update(shm_table_t *table, uint32_t index, uint64_t key, const void *record);
+
+/**
+ * @brief      find the slot of a key
+ * @param[in]  *table pointer to a shm table structure
+ * @param[in]  key slot key
+ * @param[out] *index pointer to a slot index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 key not found
+ * @note       the index stays valid while the writer runs, look it up once
+ */
+uint8_t shm_table_find(shm_table_t *table, uint64_t key, uint32_t *index);
+
+/**
+ * @brief      read a slot
+ * @param[in]  *table pointer to a shm table structure
+ * @param[in]  index slot index
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index is invalid
+ *             - 4 writer kept the slot locked
+ * @note       torn reads are retried
+ */
+uint8_t shm_table_read(shm_table_t *table, uint32_t index, void *record);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      gpio.c
+ * @brief     gpio source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "gpio.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+
+/**
+ * @brief      gpio edge init
+ * @param[in]  *name pointer to a gpio chip device name buffer
+ * @param[in]  line gpio line offset
+ * @param[in]  edge detected edges
+ * @param[out] *fd pointer to a gpio handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the handle is pollable, so it can be watched by an epoll loop
+ */
+uint8_t gpio_edge_init(char *name, uint32_t line, gpio_edge_t edge, int *fd)
+{
+    int chip;
+    struct gpio_v2_line_request req;
+    
+    chip = open(name, O_RDWR | O_CLOEXEC);                                   /* open the chip */
+    if (chip < 0)                                                            /* check the result */
+    {
+        perror("gpio: open failed.\n");                                      /* open failed */
+        
+        return 1;                                                            /* return error */
+    }
+    
+    memset(&req, 0, sizeof(req));                                            /* clear the request */
+    req.offsets[0] = line;                                                   /* set the line */
+    req.num_lines = 1;                                                       /* one line */
+    req.config.flags = GPIO_V2_LINE_FLAG_INPUT;                              /* set input */
+    if ((edge & GPIO_EDGE_RISING) != 0)                                      /* check rising */
+    {
+        req.config.flags |= GPIO_V2_LINE_FLAG_EDGE_RISING;                   /* set rising */
+    }
+    if ((edge & GPIO_EDGE_FALLING) != 0)                                     /* check falling */
+    {
+        req.config.flags |= GPIO_V2_LINE_FLAG_EDGE_FALLING;                  /* set falling */
+    }
+    strncpy(req.consumer, "libdriver", GPIO_MAX_NAME_SIZE - 1);              /* set the consumer */
+    if (ioctl(chip, GPIO_V2_GET_LINE_IOCTL, &req) < 0)                       /* request the line */
+    {
+        perror("gpio: request line failed.\n");                              /* request line failed */
+        (void)close(chip);                                                   /* close the chip */
+        
+        return 1;                                                            /* return error */
+    }
+    (void)close(chip);                                                       /* the line fd holds the line */
+    *fd = req.fd;                                                            /* save the handle */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     gpio edge deinit
+ * @param[in] fd gpio handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t gpio_edge_deinit(int fd)
+{
+    if (close(fd) < 0)                                   /* close the line */
+    {
+        perror("gpio: close failed.\n");                 /* close failed */
+        
+        return 1;                                        /* return error */
+    }
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief      gpio edge read the current level
+ * @param[in]  fd gpio handle
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t gpio_edge_read(int fd, uint8_t *level)
+{
+    struct gpio_v2_line_values values;
+    
+    memset(&values, 0, sizeof(values));                                    /* clear the values */
+    values.mask = 1;                                                        /* the first line */
+    if (ioctl(fd, GPIO_V2_LINE_GET_VALUES_IOCTL, &values) < 0)              /* get the values */
+    {
+        perror("gpio: get values failed.\n");                               /* get values failed */
+        
+        return 1;                                                           /* return error */
+    }
+    *level = (uint8_t)(values.bits & 1);                                    /* get the level */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      gpio edge wait for the next edge
+ * @param[in]  fd gpio handle
+ * @param[in]  timeout_ms timeout in ms, -1 waits forever
+ * @param[out] *event pointer to a gpio event buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ *             - 4 timeout
+ * @note       the thread sleeps in the kernel until the edge, no bus is polled
+ */
+uint8_t gpio_edge_wait(int fd, int32_t timeout_ms, gpio_event_t *event)
+{
+    int res;
+    struct pollfd pfd;
+    struct gpio_v2_line_event e;
+    
+    pfd.fd = fd;                                                               /* set the fd */
+    pfd.events = POLLIN;                                                       /* wait for input */
+    pfd.revents = 0;                                                           /* clear the events */
+    do
+    {
+        res = poll(&pfd, 1, timeout_ms);                                       /* wait for the edge */
+    } while ((res < 0) && (errno == EINTR));                                   /* restart on signal */
+    if (res < 0)                                                               /* check the result */
+    {
+        perror("gpio: poll failed.\n");                                        /* poll failed */
+        
+        return 1;                                                              /* return error */
+    }
+    if (res == 0)                                                              /* check timeout */
+    {
+        return 4;                                                              /* return timeout */
+    }
+    if (read(fd, &e, sizeof(e)) != (ssize_t)sizeof(e))                         /* read the event */
+    {
+        perror("gpio: read event failed.\n");                                  /* read event failed */
+        
+        return 1;                                                              /* return error */
+    }
+    event->timestamp_ns = e.timestamp_ns;                                      /* save the timestamp */
+    event->level = (e.id == GPIO_V2_LINE_EVENT_RISING_EDGE) ? 1 : 0;           /* save the level */
+    
+    return 0;                                                                  /* success return 0 */
+}
@@ -0,0 +1,299 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      loop.c
+ * @brief     loop source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "loop.h"
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <errno.h>
+
+/**
+ * @brief loop max events definition
+ */
+#define LOOP_MAX_EVENTS        64        /**< max events per dispatch round */
+
+/**
+ * @brief      loop init
+ * @param[out] *fd pointer to a loop handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       none
+ */
+uint8_t loop_init(int *fd)
+{
+    /* create the epoll instance */
+    *fd = epoll_create1(EPOLL_CLOEXEC);
+    
+    /* check the fd */
+    if ((*fd) < 0)
+    {
+        perror("loop: epoll create failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     loop deinit
+ * @param[in] fd loop handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t loop_deinit(int fd)
+{
+    /* close the epoll instance */
+    if (close(fd) < 0)
+    {
+        perror("loop: close failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     add a timer to the loop
+ * @param[in] fd loop handle
+ * @param[in] *timer pointer to a loop timer structure
+ * @param[in] *callback pointer to an expiration callback
+ * @param[in] *arg pointer to a user argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the timer is created disarmed
+ */
+uint8_t loop_timer_add(int fd, loop_timer_t *timer, void (*callback)(loop_timer_t *timer), void *arg)
+{
+    struct epoll_event event;
+    
+    /* create the timer */
+    timer->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (timer->fd < 0)
+    {
+        perror("loop: timerfd create failed.\n");
+        
+        return 1;
+    }
+    timer->callback = callback;
+    timer->arg = arg;
+    
+    /* watch the timer */
+    memset(&event, 0, sizeof(struct epoll_event));
+    event.events = EPOLLIN;
+    event.data.ptr = timer;
+    if (epoll_ctl(fd, EPOLL_CTL_ADD, timer->fd, &event) < 0)
+    {
+        perror("loop: epoll ctl failed.\n");
+        (void)close(timer->fd);
+        timer->fd = -1;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     remove a timer from the loop
+ * @param[in] fd loop handle
+ * @param[in] *timer pointer to a loop timer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 remove failed
+ * @note      none
+ */
+uint8_t loop_timer_remove(int fd, loop_timer_t *timer)
+{
+    uint8_t res = 0;
+    
+    /* unwatch the timer */
+    if (epoll_ctl(fd, EPOLL_CTL_DEL, timer->fd, NULL) < 0)
+    {
+        perror("loop: epoll ctl failed.\n");
+        res = 1;
+    }
+    
+    /* close the timer */
+    if (close(timer->fd) < 0)
+    {
+        perror("loop: close failed.\n");
+        res = 1;
+    }
+    timer->fd = -1;
+    
+    return res;
+}
+
+/**
+ * @brief     arm a timer
+ * @param[in] *timer pointer to a loop timer structure
+ * @param[in] ms first expiration in ms
+ * @param[in] interval_ms period in ms, 0 means one shot
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      ms = 0 expires as soon as the loop runs
+ */
+uint8_t loop_timer_start(loop_timer_t *timer, uint32_t ms, uint32_t interval_ms)
+{
+    struct itimerspec spec;
+    
+    /* a zero it_value disarms the timer, so round up to 1 ns */
+    memset(&spec, 0, sizeof(struct itimerspec));
+    spec.it_value.tv_sec = ms / 1000;
+    spec.it_value.tv_nsec = (long)(ms % 1000) * 1000000L;
+    if (ms == 0)
+    {
+        spec.it_value.tv_nsec = 1;
+    }
+    spec.it_interval.tv_sec = interval_ms / 1000;
+    spec.it_interval.tv_nsec = (long)(interval_ms % 1000) * 1000000L;
+    
+    /* arm the timer */
+    if (timerfd_settime(timer->fd, 0, &spec, NULL) < 0)
+    {
+        perror("loop: timerfd settime failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     disarm a timer
+ * @param[in] *timer pointer to a loop timer structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      none
+ */
+uint8_t loop_timer_stop(loop_timer_t *timer)
+{
+    struct itimerspec spec;
+    uint64_t expirations;
+    
+    /* disarm the timer */
+    memset(&spec, 0, sizeof(struct itimerspec));
+    if (timerfd_settime(timer->fd, 0, &spec, NULL) < 0)
+    {
+        perror("loop: timerfd settime failed.\n");
+        
+        return 1;
+    }
+    
+    /* drop a pending expiration */
+    (void)read(timer->fd, &expirations, sizeof(uint64_t));
+    
+    return 0;
+}
+
+/**
+ * @brief     dispatch the expired timers once
+ * @param[in] fd loop handle
+ * @param[in] timeout_ms wait timeout in ms, -1 means forever
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+uint8_t loop_run_once(int fd, int timeout_ms)
+{
+    int i;
+    int n;
+    struct epoll_event events[LOOP_MAX_EVENTS];
+    
+    /* wait for the timers */
+    n = epoll_wait(fd, events, LOOP_MAX_EVENTS, timeout_ms);
+    if (n < 0)
+    {
+        if (errno == EINTR)
+        {
+            return 0;
+        }
+        perror("loop: epoll wait failed.\n");
+        
+        return 1;
+    }
+    
+    /* dispatch */
+    for (i = 0; i < n; i++)
+    {
+        uint64_t expirations;
+        loop_timer_t *timer = (loop_timer_t *)events[i].data.ptr;
+        
+        /* a callback earlier in this round may have disarmed the timer */
+        if (read(timer->fd, &expirations, sizeof(uint64_t)) != (ssize_t)sizeof(uint64_t))
+        {
+            continue;
+        }
+        timer->callback(timer);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     dispatch the expired timers until stopped
+ * @param[in] fd loop handle
+ * @param[in] *stop pointer to a stop flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the flag is checked after every dispatch round
+ */
+uint8_t loop_run(int fd, volatile uint8_t *stop)
+{
+    while ((*stop) == 0)
+    {
+        if (loop_run_once(fd, -1) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
@@ -0,0 +1,351 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      shm_ring.c
+ * @brief     shm ring source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "shm_ring.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+/**
+ * @brief shm ring slot layout definition
+ * @note  a slot holds the sequence word followed by the record, the word is
+ *        2 * n + 1 while record n is being written and 2 * n + 2 when it is complete
+ */
+#define SHM_RING_SLOT_SEQ(ring, n)     ((volatile uint64_t *)((ring)->slots + \
+                                        (size_t)((n) & ((ring)->header->capacity - 1)) * (ring)->header->slot_size))
+#define SHM_RING_SLOT_DATA(ring, n)    ((uint8_t *)SHM_RING_SLOT_SEQ(ring, n) + sizeof(uint64_t))
+
+/**
+ * @brief     map a shm object
+ * @param[in] *ring pointer to a shm ring structure
+ * @param[in] fd shm object handle
+ * @param[in] prot mapping protection
+ * @return    status code
+ *            - 0 success
+ *            - 1 map failed
+ * @note      none
+ */
+static uint8_t a_shm_ring_map(shm_ring_t *ring, int fd, int prot)
+{
+    void *addr;
+    
+    addr = mmap(NULL, ring->size, prot, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        perror("shm ring: mmap failed.\n");
+        
+        return 1;
+    }
+    ring->header = (shm_ring_header_t *)addr;
+    ring->slots = (uint8_t *)addr + sizeof(shm_ring_header_t);
+    
+    return 0;
+}
+
+/**
+ * @brief     create a ring as the writer
+ * @param[in] *ring pointer to a shm ring structure
+ * @param[in] *name pointer to a shm object name
+ * @param[in] capacity slot number, must be a power of two
+ * @param[in] record_size record size in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      an existing object with the same name is replaced
+ */
+uint8_t shm_ring_create(shm_ring_t *ring, const char *name, uint32_t capacity, uint32_t record_size)
+{
+    int fd;
+    uint32_t slot_size;
+    
+    /* check the params */
+    if ((capacity == 0) || ((capacity & (capacity - 1)) != 0) || (record_size == 0))
+    {
+        return 1;
+    }
+    
+    /* 8 bytes aligned slot */
+    slot_size = (uint32_t)((sizeof(uint64_t) + record_size + 7U) & ~7U);
+    memset(ring, 0, sizeof(shm_ring_t));
+    strncpy(ring->name, name, sizeof(ring->name) - 1);
+    ring->size = sizeof(shm_ring_header_t) + (size_t)capacity * slot_size;
+    ring->writer = 1;
+    
+    /* create the object */
+    (void)shm_unlink(name);
+    fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        perror("shm ring: shm open failed.\n");
+        
+        return 1;
+    }
+    if (ftruncate(fd, (off_t)ring->size) < 0)
+    {
+        perror("shm ring: ftruncate failed.\n");
+        (void)close(fd);
+        (void)shm_unlink(name);
+        
+        return 1;
+    }
+    if (a_shm_ring_map(ring, fd, PROT_READ | PROT_WRITE) != 0)
+    {
+        (void)close(fd);
+        (void)shm_unlink(name);
+        
+        return 1;
+    }
+    (void)close(fd);
+    
+    /* the object is zero filled, publish the layout last */
+    ring->header->version = SHM_RING_VERSION;
+    ring->header->capacity = capacity;
+    ring->header->record_size = record_size;
+    ring->header->slot_size = slot_size;
+    __atomic_store_n(&ring->header->head, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->header->magic, SHM_RING_MAGIC, __ATOMIC_RELEASE);
+    
+    return 0;
+}
+
+/**
+ * @brief     open a ring as a reader
+ * @param[in] *ring pointer to a shm ring structure
+ * @param[in] *name pointer to a shm object name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the reader starts at the current head
+ */
+uint8_t shm_ring_open(shm_ring_t *ring, const char *name)
+{
+    int fd;
+    struct stat st;
+    
+    memset(ring, 0, sizeof(shm_ring_t));
+    strncpy(ring->name, name, sizeof(ring->name) - 1);
+    
+    /* readers map the object read only and can never disturb the writer */
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        perror("shm ring: shm open failed.\n");
+        
+        return 1;
+    }
+    if ((fstat(fd, &st) < 0) || ((size_t)st.st_size < sizeof(shm_ring_header_t)))
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    ring->size = (size_t)st.st_size;
+    if (a_shm_ring_map(ring, fd, PROT_READ) != 0)
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    (void)close(fd);
+    
+    /* check the layout */
+    if ((__atomic_load_n(&ring->header->magic, __ATOMIC_ACQUIRE) != SHM_RING_MAGIC) ||
+        (ring->header->version != SHM_RING_VERSION) ||
+        (ring->size < sizeof(shm_ring_header_t) + (size_t)ring->header->capacity * ring->header->slot_size))
+    {
+        (void)munmap(ring->header, ring->size);
+        ring->header = NULL;
+        
+        return 1;
+    }
+    ring->cursor = __atomic_load_n(&ring->header->head, __ATOMIC_ACQUIRE);
+    
+    return 0;
+}
+
+/**
+ * @brief     close a ring
+ * @param[in] *ring pointer to a shm ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also unlinks the shm object
+ */
+uint8_t shm_ring_close(shm_ring_t *ring)
+{
+    uint8_t res = 0;
+    
+    if (ring->header != NULL)
+    {
+        if (munmap(ring->header, ring->size) < 0)
+        {
+            res = 1;
+        }
+        ring->header = NULL;
+    }
+    if (ring->writer != 0)
+    {
+        if (shm_unlink(ring->name) < 0)
+        {
+            res = 1;
+        }
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     publish a record
+ * @param[in] *ring pointer to a shm ring structure
+ * @param[in] *record pointer to a record buffer
+ * @note      never blocks, the oldest record is overwritten
+ */
+void shm_ring_write(shm_ring_t *ring, const void *record)
+{
+    uint64_t n = ring->header->head;
+    volatile uint64_t *seq = SHM_RING_SLOT_SEQ(ring, n);
+    
+    /* mark the slot as being written before touching the data */
+    __atomic_store_n(seq, 2 * n + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(SHM_RING_SLOT_DATA(ring, n), record, ring->header->record_size);
+    __atomic_store_n(seq, 2 * n + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&ring->header->head, n + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief     move the reader cursor to the oldest valid record
+ * @param[in] *ring pointer to a shm ring structure
+ * @param[in] head current head
+ * @note      none
+ */
+static void a_shm_ring_resync(shm_ring_t *ring, uint64_t head)
+{
+    /* keep one slot of margin for the record being written */
+    uint64_t oldest = (head > ring->header->capacity - 1) ? (head - ring->header->capacity + 1) : 0;
+    
+    if (ring->cursor < oldest)
+    {
+        ring->lost += oldest - ring->cursor;
+        ring->cursor = oldest;
+    }
+}
+
+/**
+ * @brief      get the next record in place
+ * @param[in]  *ring pointer to a shm ring structure
+ * @param[out] **record pointer to a record address buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new record
+ * @note       the record must be checked with shm_ring_release after use
+ */
+uint8_t shm_ring_peek(shm_ring_t *ring, const void **record)
+{
+    while (1)
+    {
+        uint64_t head = __atomic_load_n(&ring->header->head, __ATOMIC_ACQUIRE);
+        uint64_t s;
+        
+        if (ring->cursor >= head)
+        {
+            return 1;
+        }
+        a_shm_ring_resync(ring, head);
+        s = __atomic_load_n(SHM_RING_SLOT_SEQ(ring, ring->cursor), __ATOMIC_ACQUIRE);
+        if (s == 2 * ring->cursor + 2)
+        {
+            *record = SHM_RING_SLOT_DATA(ring, ring->cursor);
+            
+            return 0;
+        }
+        
+        /* the writer lapped this reader, skip ahead */
+        ring->lost++;
+        ring->cursor++;
+    }
+}
+
+/**
+ * @brief     release the record got by shm_ring_peek
+ * @param[in] *ring pointer to a shm ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 record was overwritten while in use
+ * @note      the cursor advances in both cases
+ */
+uint8_t shm_ring_release(shm_ring_t *ring)
+{
+    uint64_t s;
+    
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    s = __atomic_load_n(SHM_RING_SLOT_SEQ(ring, ring->cursor), __ATOMIC_RELAXED);
+    ring->cursor++;
+    if (s != 2 * (ring->cursor - 1) + 2)
+    {
+        ring->lost++;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      copy the next record
+ * @param[in]  *ring pointer to a shm ring structure
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no new record
+ * @note       records overwritten before they are read are counted in ring->lost
+ */
+uint8_t shm_ring_read(shm_ring_t *ring, void *record)
+{
+    const void *ptr;
+    
+    while (shm_ring_peek(ring, &ptr) == 0)
+    {
+        memcpy(record, ptr, ring->header->record_size);
+        if (shm_ring_release(ring) == 0)
+        {
+            return 0;
+        }
+    }
+    
+    return 1;
+}
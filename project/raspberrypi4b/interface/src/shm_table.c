@@ -0,0 +1,331 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      shm_table.c
+ * @brief     shm table source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "shm_table.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+/**
+ * @brief shm table max retry definition
+ */
+#define SHM_TABLE_MAX_RETRY        1000        /**< max torn read retry times */
+
+/**
+ * @brief     map a shm object
+ * @param[in] *table pointer to a shm table structure
+ * @param[in] fd shm object handle
+ * @param[in] prot mapping protection
+ * @return    status code
+ *            - 0 success
+ *            - 1 map failed
+ * @note      none
+ */
+static uint8_t a_shm_table_map(shm_table_t *table, int fd, int prot)
+{
+    void *addr;
+    
+    addr = mmap(NULL, table->size, prot, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        perror("shm table: mmap failed.\n");
+        
+        return 1;
+    }
+    table->header = (shm_table_header_t *)addr;
+    table->slots = (shm_table_slot_t *)((uint8_t *)addr + sizeof(shm_table_header_t));
+    
+    return 0;
+}
+
+/**
+ * @brief     create a table as the writer
+ * @param[in] *table pointer to a shm table structure
+ * @param[in] *name pointer to a shm object name
+ * @param[in] capacity slot number
+ * @param[in] record_size record size in bytes
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      an existing object with the same name is replaced
+ */
+uint8_t shm_table_create(shm_table_t *table, const char *name, uint32_t capacity, uint32_t record_size)
+{
+    int fd;
+    
+    /* check the params */
+    if ((capacity == 0) || (record_size == 0) || (record_size > SHM_TABLE_MAX_RECORD))
+    {
+        return 1;
+    }
+    
+    memset(table, 0, sizeof(shm_table_t));
+    strncpy(table->name, name, sizeof(table->name) - 1);
+    table->size = sizeof(shm_table_header_t) + (size_t)capacity * sizeof(shm_table_slot_t);
+    table->writer = 1;
+    
+    /* create the object */
+    (void)shm_unlink(name);
+    fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        perror("shm table: shm open failed.\n");
+        
+        return 1;
+    }
+    if (ftruncate(fd, (off_t)table->size) < 0)
+    {
+        perror("shm table: ftruncate failed.\n");
+        (void)close(fd);
+        (void)shm_unlink(name);
+        
+        return 1;
+    }
+    if (a_shm_table_map(table, fd, PROT_READ | PROT_WRITE) != 0)
+    {
+        (void)close(fd);
+        (void)shm_unlink(name);
+        
+        return 1;
+    }
+    (void)close(fd);
+    
+    /* the object is zero filled, publish the layout last */
+    table->header->version = SHM_TABLE_VERSION;
+    table->header->capacity = capacity;
+    table->header->record_size = record_size;
+    __atomic_store_n(&table->header->count, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&table->header->magic, SHM_TABLE_MAGIC, __ATOMIC_RELEASE);
+    
+    return 0;
+}
+
+/**
+ * @brief     open a table as a reader
+ * @param[in] *table pointer to a shm table structure
+ * @param[in] *name pointer to a shm object name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t shm_table_open(shm_table_t *table, const char *name)
+{
+    int fd;
+    struct stat st;
+    
+    memset(table, 0, sizeof(shm_table_t));
+    strncpy(table->name, name, sizeof(table->name) - 1);
+    
+    /* readers map the object read only */
+    fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        perror("shm table: shm open failed.\n");
+        
+        return 1;
+    }
+    if ((fstat(fd, &st) < 0) || ((size_t)st.st_size < sizeof(shm_table_header_t)))
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    table->size = (size_t)st.st_size;
+    if (a_shm_table_map(table, fd, PROT_READ) != 0)
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    (void)close(fd);
+    
+    /* check the layout */
+    if ((__atomic_load_n(&table->header->magic, __ATOMIC_ACQUIRE) != SHM_TABLE_MAGIC) ||
+        (table->header->version != SHM_TABLE_VERSION) ||
+        (table->size < sizeof(shm_table_header_t) + (size_t)table->header->capacity * sizeof(shm_table_slot_t)))
+    {
+        (void)munmap(table->header, table->size);
+        table->header = NULL;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     close a table
+ * @param[in] *table pointer to a shm table structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also unlinks the shm object
+ */
+uint8_t shm_table_close(shm_table_t *table)
+{
+    uint8_t res = 0;
+    
+    if (table->header != NULL)
+    {
+        if (munmap(table->header, table->size) < 0)
+        {
+            res = 1;
+        }
+        table->header = NULL;
+    }
+    if (table->writer != 0)
+    {
+        if (shm_unlink(table->name) < 0)
+        {
+            res = 1;
+        }
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     update a slot
+ * @param[in] *table pointer to a shm table structure
+ * @param[in] index slot index
+ * @param[in] key slot key
+ * @param[in] *record pointer to a record buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 index is invalid
+ * @note      never blocks, slots up to index become visible to readers
+ */
+uint8_t shm_table_update(shm_table_t *table, uint32_t index, uint64_t key, const void *record)
+{
+    shm_table_slot_t *slot;
+    uint64_t seq;
+    
+    if (index >= table->header->capacity)
+    {
+        return 1;
+    }
+    
+    /* odd sequence while writing */
+    slot = &table->slots[index];
+    seq = slot->seq;
+    __atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&slot->key, key, __ATOMIC_RELAXED);
+    memcpy(slot->data, record, table->header->record_size);
+    __atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+    
+    /* make the slot visible */
+    if (index >= table->header->count)
+    {
+        __atomic_store_n(&table->header->count, index + 1, __ATOMIC_RELEASE);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      find the slot of a key
+ * @param[in]  *table pointer to a shm table structure
+ * @param[in]  key slot key
+ * @param[out] *index pointer to a slot index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 key not found
+ * @note       the index stays valid while the writer runs, look it up once
+ */
+uint8_t shm_table_find(shm_table_t *table, uint64_t key, uint32_t *index)
+{
+    uint32_t i;
+    uint32_t count = __atomic_load_n(&table->header->count, __ATOMIC_ACQUIRE);
+    
+    for (i = 0; i < count; i++)
+    {
+        if (__atomic_load_n(&table->slots[i].key, __ATOMIC_ACQUIRE) == key)
+        {
+            *index = i;
+            
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief      read a slot
+ * @param[in]  *table pointer to a shm table structure
+ * @param[in]  index slot index
+ * @param[out] *record pointer to a record buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index is invalid
+ *             - 4 writer kept the slot locked
+ * @note       torn reads are retried
+ */
+uint8_t shm_table_read(shm_table_t *table, uint32_t index, void *record)
+{
+    uint32_t retry;
+    shm_table_slot_t *slot;
+    
+    if (index >= __atomic_load_n(&table->header->count, __ATOMIC_ACQUIRE))
+    {
+        return 1;
+    }
+    
+    slot = &table->slots[index];
+    for (retry = 0; retry < SHM_TABLE_MAX_RETRY; retry++)
+    {
+        uint64_t s1;
+        uint64_t s2;
+        
+        s1 = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        if ((s1 & 1) != 0)
+        {
+            continue;
+        }
+        memcpy(record, slot->data, table->header->record_size);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        s2 = __atomic_load_n(&slot->seq, __ATOMIC_RELAXED);
+        if (s1 == s2)
+        {
+            return 0;
+        }
+    }
+    
+    return 4;
+}
@@ -38,8 +38,88 @@
 #include "driver_mlx90614_advance.h"
 #include "driver_mlx90614_register_test.h"
 #include "driver_mlx90614_read_test.h"
+#include "driver_mlx90614_convert_test.h"
+#include "driver_mlx90614_pwm_test.h"
+#include "driver_mlx90614_emissivity_test.h"
+#include "driver_mlx90614_filter_test.h"
+#include "driver_mlx90614_adaptive_test.h"
+#include "driver_mlx90614_detector_test.h"
+#include "driver_mlx90614_aggregate_test.h"
+#include "driver_mlx90614_duty_test.h"
+#include "raspberrypi4b_driver_mlx90614_loop.h"
+#include "raspberrypi4b_driver_mlx90614_log.h"
+#include "raspberrypi4b_driver_mlx90614_registry.h"
+#include "gpio.h"
 #include <getopt.h>
 #include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief main temperature definition
+ * @note  the fixed point build reports 1 / MLX90614_FIXED_POINT celsius
+ */
+#ifdef MLX90614_FIXED_POINT
+#define MLX90614_MAIN_CELSIUS(t)            ((float)(t) / (float)MLX90614_FIXED_POINT)        /**< temperature to print */
+#define MLX90614_MAIN_TEMPERATURE(c)        ((mlx90614_temperature_t)((c) * MLX90614_FIXED_POINT + \
+                                            (((c) < 0) ? -0.5f : 0.5f)))                      /**< rounded celsius to temperature */
+#else
+#define MLX90614_MAIN_CELSIUS(t)            (t)                                                 /**< temperature to print */
+#define MLX90614_MAIN_TEMPERATURE(c)        (c)                                                 /**< celsius to temperature */
+#endif
+
+static volatile uint8_t gs_loop_stop;        /**< loop stop flag */
+static uint32_t gs_loop_times;               /**< loop sample times */
+static uint32_t gs_loop_count;               /**< loop sample count */
+static mlx90614_log_writer_t gs_log;         /**< sample log writer */
+static uint8_t gs_log_enable;                /**< sample log enable flag */
+
+/**
+ * @brief     loop sample callback
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @param[in] res read result
+ * @param[in] ambient_raw ambient raw data
+ * @param[in] object_raw object raw data
+ * @note      none
+ */
+static void a_loop_sample_callback(mlx90614_loop_sensor_t *sensor, uint8_t res,
+                                   uint16_t ambient_raw, uint16_t object_raw)
+{
+    (void)sensor;
+    
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: read failed.\n");
+        gs_loop_stop = 1;
+        
+        return;
+    }
+    
+    /* log the raw data */
+    if (gs_log_enable != 0)
+    {
+        struct timespec ts;
+        
+        (void)clock_gettime(CLOCK_REALTIME, &ts);
+        if (mlx90614_log_writer_append(&gs_log, (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000,
+                                       ambient_raw, object_raw) != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614: log failed.\n");
+            gs_loop_stop = 1;
+            
+            return;
+        }
+    }
+    
+    /* output */
+    gs_loop_count++;
+    mlx90614_interface_debug_print("mlx90614: %d/%d.\n", gs_loop_count, gs_loop_times);
+    mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n",
+                                   (float)ambient_raw * 0.02f - 273.15f, (float)object_raw * 0.02f - 273.15f);
+    if (gs_loop_count >= gs_loop_times)
+    {
+        gs_loop_stop = 1;
+    }
+}
 
 /**
  * @brief     mlx90614 full function
@@ -64,10 +144,18 @@ uint8_t mlx90614(uint8_t argc, char **argv)
         {"example", required_argument, NULL, 'e'},
         {"test", required_argument, NULL, 't'},
         {"times", required_argument, NULL, 1},
+        {"file", required_argument, NULL, 2},
+        {"threshold", required_argument, NULL, 3},
+        {"hysteresis", required_argument, NULL, 4},
+        {"gpio", required_argument, NULL, 5},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
+    char *file = NULL;
+    float threshold = 40.0f;
+    float hysteresis = 1.0f;
+    uint32_t gpio = 17;
     
     /* if no params */
     if (argc == 1)
@@ -147,6 +235,42 @@ uint8_t mlx90614(uint8_t argc, char **argv)
                 break;
             } 
             
+            /* log file */
+            case 2 :
+            {
+                /* set the file */
+                file = optarg;
+                
+                break;
+            }
+            
+            /* relay threshold */
+            case 3 :
+            {
+                /* set the threshold */
+                threshold = (float)atof(optarg);
+                
+                break;
+            }
+            
+            /* relay hysteresis */
+            case 4 :
+            {
+                /* set the hysteresis */
+                hysteresis = (float)atof(optarg);
+                
+                break;
+            }
+            
+            /* relay gpio */
+            case 5 :
+            {
+                /* set the gpio */
+                gpio = atol(optarg);
+                
+                break;
+            }
+            
             /* the end */
             case -1 :
             {
@@ -186,12 +310,109 @@ uint8_t mlx90614(uint8_t argc, char **argv)
             return 0;
         }
     }
+    else if (strcmp("t_convert", type) == 0)
+    {
+        /* run convert test */
+        if (mlx90614_convert_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_pwm", type) == 0)
+    {
+        /* run pwm test */
+        if (mlx90614_pwm_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_emissivity", type) == 0)
+    {
+        /* run emissivity test */
+        if (mlx90614_emissivity_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_filter", type) == 0)
+    {
+        /* run filter test */
+        if (mlx90614_filter_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_adaptive", type) == 0)
+    {
+        /* run adaptive test */
+        if (mlx90614_adaptive_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_detector", type) == 0)
+    {
+        /* run detector test */
+        if (mlx90614_detector_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_aggregate", type) == 0)
+    {
+        /* run aggregate test */
+        if (mlx90614_aggregate_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_duty", type) == 0)
+    {
+        /* run duty test */
+        if (mlx90614_duty_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
         uint32_t i;
-        float ambient;
-        float object;
+        mlx90614_temperature_t ambient;
+        mlx90614_temperature_t object;
+        mlx90614_start_path_t path;
         
         /* basic init */
         res = mlx90614_basic_init();
@@ -200,11 +421,17 @@ uint8_t mlx90614(uint8_t argc, char **argv)
             return 1;
         }
         
+        /* output the start path */
+        (void)mlx90614_basic_get_start_path(&path);
+        mlx90614_interface_debug_print("mlx90614: start path is %s.\n",
+                                       (path == MLX90614_START_PATH_FAST) ? "fast" :
+                                       (path == MLX90614_START_PATH_SMBUS) ? "pwm to smbus" : "exit sleep");
+        
         /* loop */
         for (i = 0; i < times; i++)
         {
             /* read data */
-            res = mlx90614_basic_read((float *)&ambient, (float *)&object);
+            res = mlx90614_basic_read((mlx90614_temperature_t *)&ambient, (mlx90614_temperature_t *)&object);
             if (res)
             {
                 mlx90614_basic_deinit();
@@ -214,7 +441,8 @@ uint8_t mlx90614(uint8_t argc, char **argv)
             
             /* output */
             mlx90614_interface_debug_print("mlx90614: %d/%d.\n", i + 1, times);
-            mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+            mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n",
+                                           MLX90614_MAIN_CELSIUS(ambient), MLX90614_MAIN_CELSIUS(object));
             
             /* delay 1000 ms */
             mlx90614_interface_delay_ms(1000);
@@ -225,12 +453,149 @@ uint8_t mlx90614(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_loop", type) == 0)
+    {
+        int loop;
+        mlx90614_loop_sensor_t sensor;
+        
+        /* loop init */
+        if (loop_init(&loop) != 0)
+        {
+            return 1;
+        }
+        
+        /* sensor init */
+        if (mlx90614_loop_sensor_init(loop, &sensor, MLX90614_ADDRESS_DEFAULT) != 0)
+        {
+            (void)loop_deinit(loop);
+            
+            return 1;
+        }
+        sensor.sample_callback = a_loop_sample_callback;
+        
+        /* open the log */
+        gs_log_enable = 0;
+        if (file != NULL)
+        {
+            uint16_t id[4];
+            uint16_t config1;
+            
+            if ((mlx90614_get_id(&sensor.handle, id) != 0) ||
+                (mlx90614_get_reg(&sensor.handle, 0x25, &config1) != 0) ||
+                (mlx90614_log_writer_open(&gs_log, file,
+                                          ((uint64_t)id[3] << 48) | ((uint64_t)id[2] << 32) |
+                                          ((uint64_t)id[1] << 16) | id[0], config1) != 0))
+            {
+                (void)mlx90614_loop_sensor_deinit(loop, &sensor);
+                (void)loop_deinit(loop);
+                
+                return 1;
+            }
+            gs_log_enable = 1;
+        }
+        
+        /* sample every 1000 ms */
+        gs_loop_stop = 0;
+        gs_loop_count = 0;
+        gs_loop_times = times;
+        if (mlx90614_loop_sensor_start(&sensor, 1000) != 0)
+        {
+            if (gs_log_enable != 0)
+            {
+                (void)mlx90614_log_writer_close(&gs_log);
+            }
+            (void)mlx90614_loop_sensor_deinit(loop, &sensor);
+            (void)loop_deinit(loop);
+            
+            return 1;
+        }
+        
+        /* run */
+        if (loop_run(loop, &gs_loop_stop) != 0)
+        {
+            if (gs_log_enable != 0)
+            {
+                (void)mlx90614_log_writer_close(&gs_log);
+            }
+            (void)mlx90614_loop_sensor_deinit(loop, &sensor);
+            (void)loop_deinit(loop);
+            
+            return 1;
+        }
+        
+        /* deinit */
+        if (gs_log_enable != 0)
+        {
+            if (mlx90614_log_writer_close(&gs_log) != 0)
+            {
+                (void)mlx90614_loop_sensor_deinit(loop, &sensor);
+                (void)loop_deinit(loop);
+                
+                return 1;
+            }
+        }
+        (void)mlx90614_loop_sensor_deinit(loop, &sensor);
+        (void)loop_deinit(loop);
+        
+        return (gs_loop_count >= gs_loop_times) ? 0 : 1;
+    }
+    else if (strcmp("e_dump", type) == 0)
+    {
+        static mlx90614_log_record_t record[MLX90614_LOG_BLOCK_MAX_RECORD];
+        mlx90614_log_reader_t reader;
+        mlx90614_log_block_t block;
+        uint64_t i;
+        uint16_t j;
+        uint16_t len;
+        
+        /* check the file */
+        if (file == NULL)
+        {
+            return 5;
+        }
+        
+        /* map the log */
+        if (mlx90614_log_reader_open(&reader, file) != 0)
+        {
+            return 1;
+        }
+        
+        /* decode block by block */
+        for (i = 0; i < reader.blocks; i++)
+        {
+            if (mlx90614_log_reader_block(&reader, i, &block) != 0)
+            {
+                continue;
+            }
+            len = MLX90614_LOG_BLOCK_MAX_RECORD;
+            if (mlx90614_log_reader_decode(&reader, i, record, &len) != 0)
+            {
+                mlx90614_interface_debug_print("mlx90614: block %d is broken.\n", (int)i);
+                
+                continue;
+            }
+            mlx90614_interface_debug_print("mlx90614: block %d id 0x%016llX config1 0x%04X.\n", (int)i,
+                                           (unsigned long long)block.id, block.config1);
+            for (j = 0; j < len; j++)
+            {
+                mlx90614_interface_debug_print("%llu.%06llu,%0.2f,%0.2f\n",
+                                               (unsigned long long)(record[j].timestamp_us / 1000000),
+                                               (unsigned long long)(record[j].timestamp_us % 1000000),
+                                               (float)record[j].ambient_raw * 0.02f - 273.15f,
+                                               (float)record[j].object_raw * 0.02f - 273.15f);
+            }
+        }
+        (void)mlx90614_log_reader_close(&reader);
+        
+        return 0;
+    }
     else if (strcmp("e_advance-read", type) == 0)
     {
         uint8_t res;
         uint32_t i;
-        float ambient;
-        float object;
+        mlx90614_temperature_t ambient;
+        mlx90614_temperature_t object;
+        mlx90614_start_path_t path;
         
         /* advance init */
         res = mlx90614_advance_init();
@@ -238,15 +603,27 @@ uint8_t mlx90614(uint8_t argc, char **argv)
         {
             return 1;
         }
+        
+        /* output the start path */
+        (void)mlx90614_advance_get_start_path(&path);
+        mlx90614_interface_debug_print("mlx90614: start path is %s.\n",
+                                       (path == MLX90614_START_PATH_FAST) ? "fast" :
+                                       (path == MLX90614_START_PATH_SMBUS) ? "pwm to smbus" : "exit sleep");
             
-        /* delay 2000 ms */
-        mlx90614_interface_delay_ms(2000);
+        /* wait for the settled data */
+        res = mlx90614_advance_wait_ready();
+        if (res)
+        {
+            mlx90614_advance_deinit();
+            
+            return 1;
+        }
         
         /* loop */
         for (i = 0; i < times; i++)
         {
             /* read data */
-            res = mlx90614_advance_read((float *)&ambient, (float *)&object);
+            res = mlx90614_advance_read((mlx90614_temperature_t *)&ambient, (mlx90614_temperature_t *)&object);
             if (res)
             {
                 mlx90614_advance_deinit();
@@ -256,7 +633,8 @@ uint8_t mlx90614(uint8_t argc, char **argv)
             
             /* output */
             mlx90614_interface_debug_print("mlx90614: %d/%d.\n", i + 1, times);
-            mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+            mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n",
+                                           MLX90614_MAIN_CELSIUS(ambient), MLX90614_MAIN_CELSIUS(object));
             
             /* delay 1000 ms */
             mlx90614_interface_delay_ms(1000);
@@ -358,6 +736,272 @@ uint8_t mlx90614(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_advance-relay", type) == 0)
+    {
+        uint8_t res;
+        
+        /* advance init */
+        res = mlx90614_advance_init();
+        if (res)
+        {
+            return 1;
+        }
+        
+        /* set thermal relay */
+        res = mlx90614_advance_set_thermal_relay(MLX90614_MAIN_TEMPERATURE(threshold), MLX90614_MAIN_TEMPERATURE(hysteresis));
+        if (res)
+        {
+            mlx90614_advance_deinit();
+            
+            return 1;
+        }
+        
+        /* output */
+        mlx90614_interface_debug_print("mlx90614: set thermal relay threshold %0.2fC hysteresis %0.2fC.\n", threshold, hysteresis);
+        mlx90614_interface_debug_print("mlx90614: power cycle the chip to start the thermal relay.\n");
+        
+        /* advance deinit */
+        (void)mlx90614_advance_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_advance-warm", type) == 0)
+    {
+        uint8_t res;
+        mlx90614_bool_t warm;
+        mlx90614_registry_file_t registry;
+        mlx90614_registry_entry_t entry;
+        
+        /* check the file */
+        if (file == NULL)
+        {
+            return 5;
+        }
+        
+        /* map the registry */
+        res = mlx90614_registry_file_open(&registry, file, 0);
+        if (res)
+        {
+            return 1;
+        }
+        
+        /* advance init with the registry */
+        res = mlx90614_advance_init_with_registry(&registry.registry, &warm);
+        if (res)
+        {
+            (void)mlx90614_registry_file_close(&registry);
+            
+            return 1;
+        }
+        
+        /* output */
+        mlx90614_interface_debug_print("mlx90614: %s start.\n", (warm == MLX90614_BOOL_TRUE) ? "warm" : "cold");
+        if (mlx90614_registry_find_addr(&registry.registry, MLX90614_ADDRESS_DEFAULT, &entry) == 0)
+        {
+            mlx90614_interface_debug_print("mlx90614: id 0x%016llX config1 0x%04X emissivity 0x%04X sequence %u.\n",
+                                           (unsigned long long)entry.id, entry.config1, entry.emissivity,
+                                           (unsigned int)entry.sequence);
+        }
+        
+        /* advance deinit */
+        (void)mlx90614_advance_deinit();
+        (void)mlx90614_registry_file_close(&registry);
+        
+        return 0;
+    }
+    else if (strcmp("e_advance-dump", type) == 0)
+    {
+        uint8_t res;
+        FILE *fp;
+        mlx90614_eeprom_image_t image;
+        
+        /* check the file */
+        if (file == NULL)
+        {
+            return 5;
+        }
+        
+        /* advance init */
+        res = mlx90614_advance_init();
+        if (res)
+        {
+            return 1;
+        }
+        
+        /* dump eeprom */
+        res = mlx90614_advance_eeprom_dump(&image);
+        (void)mlx90614_advance_deinit();
+        if (res)
+        {
+            return 1;
+        }
+        
+        /* save the image */
+        fp = fopen(file, "wb");
+        if (fp == NULL)
+        {
+            perror("mlx90614: open failed.\n");
+            
+            return 1;
+        }
+        if (fwrite(&image, sizeof(image), 1, fp) != 1)
+        {
+            (void)fclose(fp);
+            
+            return 1;
+        }
+        (void)fclose(fp);
+        
+        /* output */
+        mlx90614_interface_debug_print("mlx90614: dump eeprom of id 0x%016llX.\n", (unsigned long long)image.id);
+        
+        return 0;
+    }
+    else if (strcmp("e_advance-restore", type) == 0)
+    {
+        uint8_t res;
+        uint8_t written;
+        FILE *fp;
+        mlx90614_eeprom_image_t image;
+        
+        /* check the file */
+        if (file == NULL)
+        {
+            return 5;
+        }
+        
+        /* load the image */
+        fp = fopen(file, "rb");
+        if (fp == NULL)
+        {
+            perror("mlx90614: open failed.\n");
+            
+            return 1;
+        }
+        if (fread(&image, sizeof(image), 1, fp) != 1)
+        {
+            (void)fclose(fp);
+            
+            return 1;
+        }
+        (void)fclose(fp);
+        if (mlx90614_eeprom_image_check(&image) != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614: eeprom image is invalid.\n");
+            
+            return 1;
+        }
+        
+        /* advance init */
+        res = mlx90614_advance_init();
+        if (res)
+        {
+            return 1;
+        }
+        
+        /* restore eeprom */
+        res = mlx90614_advance_eeprom_restore(&image, &written);
+        (void)mlx90614_advance_deinit();
+        if (res)
+        {
+            return 1;
+        }
+        
+        /* output */
+        mlx90614_interface_debug_print("mlx90614: restore eeprom of id 0x%016llX, %d cells written.\n",
+                                       (unsigned long long)image.id, written);
+        
+        return 0;
+    }
+    else if (strcmp("e_advance-duty", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        mlx90614_duty_stats_t stats;
+        const struct
+        {
+            mlx90614_fir_length_t fir_length;
+            mlx90614_iir_t iir;
+            const char *name;
+        } setting[] =
+        {
+            {MLX90614_FIR_LENGTH_128, MLX90614_IIR_A1_1_B1_0, "fir 128 iir a1 1 b1 0"},
+            {MLX90614_FIR_LENGTH_256, MLX90614_IIR_A1_1_B1_0, "fir 256 iir a1 1 b1 0"},
+            {MLX90614_FIR_LENGTH_512, MLX90614_IIR_A1_1_B1_0, "fir 512 iir a1 1 b1 0"},
+            {MLX90614_FIR_LENGTH_1024, MLX90614_IIR_A1_0P5_B1_0P5, "fir 1024 iir a1 0.5 b1 0.5"},
+            {MLX90614_ADVANCE_DEFAULT_FIR_LENGTH, MLX90614_ADVANCE_DEFAULT_IIR, "default"},
+        };
+        
+        /* compare the filter settings, the default one runs last and is kept */
+        for (i = 0; i < sizeof(setting) / sizeof(setting[0]); i++)
+        {
+            /* run the duty cycle */
+            res = mlx90614_advance_duty(setting[i].fir_length, setting[i].iir, 1000, times, &stats);
+            if (res)
+            {
+                return 1;
+            }
+            
+            /* output */
+            mlx90614_interface_debug_print("mlx90614: %s.\n", setting[i].name);
+            mlx90614_interface_debug_print("mlx90614: samples %d failures %d latency %dms min %dms max %dms polls %d.%02d.\n",
+                                           stats.samples, stats.failures, stats.latency_ms, stats.latency_min_ms,
+                                           stats.latency_max_ms, stats.polls_per_sample_x100 / 100,
+                                           stats.polls_per_sample_x100 % 100);
+            mlx90614_interface_debug_print("mlx90614: duty %d ppm average %d nA energy %d uJ per sample.\n",
+                                           stats.duty_ppm, stats.average_na, stats.energy_per_sample_uj);
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_relay", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        int fd;
+        uint8_t level;
+        gpio_event_t event;
+        
+        /* gpio init */
+        res = gpio_edge_init("/dev/gpiochip0", gpio, GPIO_EDGE_BOTH, &fd);
+        if (res)
+        {
+            return 1;
+        }
+        
+        /* read the current level */
+        res = gpio_edge_read(fd, &level);
+        if (res)
+        {
+            (void)gpio_edge_deinit(fd);
+            
+            return 1;
+        }
+        mlx90614_interface_debug_print("mlx90614: relay is %s.\n", level ? "on" : "off");
+        
+        /* wait for the edges */
+        for (i = 0; i < times; i++)
+        {
+            res = gpio_edge_wait(fd, -1, &event);
+            if (res)
+            {
+                (void)gpio_edge_deinit(fd);
+                
+                return 1;
+            }
+            
+            /* output */
+            mlx90614_interface_debug_print("mlx90614: %d/%d.\n", i + 1, times);
+            mlx90614_interface_debug_print("mlx90614: relay is %s at %lld.%09llds.\n", event.level ? "on" : "off",
+                                           (long long)(event.timestamp_ns / 1000000000ULL),
+                                           (long long)(event.timestamp_ns % 1000000000ULL));
+        }
+        
+        /* gpio deinit */
+        (void)gpio_edge_deinit(fd);
+        
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -367,20 +1011,45 @@ uint8_t mlx90614(uint8_t argc, char **argv)
         mlx90614_interface_debug_print("  mlx90614 (-p | --port)\n");
         mlx90614_interface_debug_print("  mlx90614 (-t reg | --test=reg)\n");
         mlx90614_interface_debug_print("  mlx90614 (-t read | --test=read) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-t convert | --test=convert) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-t pwm | --test=pwm) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-t emissivity | --test=emissivity) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-t filter | --test=filter) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-t adaptive | --test=adaptive) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-t detector | --test=detector) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-t aggregate | --test=aggregate) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-t duty | --test=duty) [--times=<num>]\n");
         mlx90614_interface_debug_print("  mlx90614 (-e read | --example=read) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-e loop | --example=loop) [--times=<num>] [--file=<path>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-e dump | --example=dump) --file=<path>\n");
         mlx90614_interface_debug_print("  mlx90614 (-e advance-read | --example=advance-read) [--times=<num>]\n");
         mlx90614_interface_debug_print("  mlx90614 (-e advance-id | --example=advance-id)\n");
         mlx90614_interface_debug_print("  mlx90614 (-e advance-sleep | --example=advance-sleep)\n");
         mlx90614_interface_debug_print("  mlx90614 (-e advance-wake | --example=advance-wake)\n");
+        mlx90614_interface_debug_print("  mlx90614 (-e advance-relay | --example=advance-relay) [--threshold=<degC>] [--hysteresis=<degC>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-e advance-warm | --example=advance-warm) --file=<path>\n");
+        mlx90614_interface_debug_print("  mlx90614 (-e advance-dump | --example=advance-dump) --file=<path>\n");
+        mlx90614_interface_debug_print("  mlx90614 (-e advance-restore | --example=advance-restore) --file=<path>\n");
+        mlx90614_interface_debug_print("  mlx90614 (-e advance-duty | --example=advance-duty) [--times=<num>]\n");
+        mlx90614_interface_debug_print("  mlx90614 (-e relay | --example=relay) [--gpio=<bcm>] [--times=<num>]\n");
         mlx90614_interface_debug_print("\n");
         mlx90614_interface_debug_print("Options:\n");
-        mlx90614_interface_debug_print("  -e <read | advance-read | advance-id | advance-sleep | advance-wake>, --example=\n");
-        mlx90614_interface_debug_print("     <read | advance-read | advance-id | advance-sleep | advance-wake>\n");
+        mlx90614_interface_debug_print("  -e <read | loop | dump | advance-read | advance-id | advance-sleep | advance-wake | advance-relay | advance-warm |\n");
+        mlx90614_interface_debug_print("      advance-dump | advance-restore | advance-duty | relay>,\n");
+        mlx90614_interface_debug_print("     --example=<read | loop | dump | advance-read | advance-id | advance-sleep | advance-wake | advance-relay | advance-warm |\n");
+        mlx90614_interface_debug_print("                advance-dump | advance-restore | advance-duty | relay>\n");
         mlx90614_interface_debug_print("                       Run the driver example.\n");
+        mlx90614_interface_debug_print("      --file=<path>    Set the binary sample log, device registry or eeprom image file.\n");
+        mlx90614_interface_debug_print("      --gpio=<bcm>     Set the gpio connected to the relay output.([default: 17])\n");
+        mlx90614_interface_debug_print("      --hysteresis=<degC>\n");
+        mlx90614_interface_debug_print("                       Set the thermal relay hysteresis.([default: 1.0])\n");
         mlx90614_interface_debug_print("  -h, --help           Show the help.\n");
         mlx90614_interface_debug_print("  -i, --information    Show the chip information.\n");
         mlx90614_interface_debug_print("  -p, --port           Display the pin connections of the current board.\n");
-        mlx90614_interface_debug_print("  -t <reg | read>, --test=<reg | read>\n");
+        mlx90614_interface_debug_print("      --threshold=<degC>\n");
+        mlx90614_interface_debug_print("                       Set the thermal relay threshold.([default: 40.0])\n");
+        mlx90614_interface_debug_print("  -t <reg | read | convert | pwm | emissivity | filter | adaptive | detector | aggregate | duty>,\n");
+        mlx90614_interface_debug_print("     --test=<reg | read | convert | pwm | emissivity | filter | adaptive | detector | aggregate | duty>\n");
         mlx90614_interface_debug_print("                       Run the driver test.\n");
         mlx90614_interface_debug_print("      --times=<num>    Set the running times.([default: 3])\n");
         
@@ -409,6 +1078,7 @@ uint8_t mlx90614(uint8_t argc, char **argv)
         /* print pin connection */
         mlx90614_interface_debug_print("mlx90614: SCL connected to GPIO3(BCM).\n");
         mlx90614_interface_debug_print("mlx90614: SDA connected to GPIO2(BCM).\n");
+        mlx90614_interface_debug_print("mlx90614: PWM connected to GPIO17(BCM) in the thermal relay mode.\n");
         
         return 0;
     }
@@ -0,0 +1,288 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      mlx90614d.c
+ * @brief     mlx90614 acquisition daemon source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_mlx90614_loop.h"
+#include "raspberrypi4b_driver_mlx90614_client.h"
+#include <getopt.h>
+#include <signal.h>
+#include <time.h>
+
+/**
+ * @brief daemon max sensor definition
+ */
+#define MLX90614D_MAX_SENSOR        128        /**< max sensor number */
+
+static mlx90614_loop_sensor_t gs_sensor[MLX90614D_MAX_SENSOR];        /**< sensor handles */
+static uint64_t gs_id[MLX90614D_MAX_SENSOR];                          /**< sensor ids */
+static shm_ring_t gs_ring;                                            /**< sample ring */
+static shm_table_t gs_table;                                          /**< latest value table */
+static volatile uint8_t gs_stop;                                      /**< stop flag */
+
+/**
+ * @brief     signal handler
+ * @param[in] signum signal number
+ * @note      none
+ */
+static void a_mlx90614d_signal_handler(int signum)
+{
+    (void)signum;
+    
+    gs_stop = 1;
+}
+
+/**
+ * @brief     sample callback
+ * @param[in] *sensor pointer to an mlx90614 loop sensor structure
+ * @param[in] res read result
+ * @param[in] ambient_raw ambient raw data
+ * @param[in] object_raw object raw data
+ * @note      none
+ */
+static void a_mlx90614d_sample_callback(mlx90614_loop_sensor_t *sensor, uint8_t res,
+                                        uint16_t ambient_raw, uint16_t object_raw)
+{
+    struct timespec ts;
+    mlx90614_sample_t sample;
+    
+    /* fill the sample */
+    (void)clock_gettime(CLOCK_REALTIME, &ts);
+    memset(&sample, 0, sizeof(mlx90614_sample_t));
+    sample.timestamp_ns = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    sample.id = *(uint64_t *)sensor->user;
+    sample.ambient_raw = ambient_raw;
+    sample.object_raw = object_raw;
+    sample.addr = sensor->handle.iic_addr;
+    sample.status = res;
+    
+    /* publish */
+    shm_ring_write(&gs_ring, &sample);
+    (void)shm_table_update(&gs_table, (uint32_t)(sensor - gs_sensor), sample.id, &sample);
+}
+
+/**
+ * @brief     print the help
+ * @note      none
+ */
+static void a_mlx90614d_help(void)
+{
+    mlx90614_interface_debug_print("Usage:\n");
+    mlx90614_interface_debug_print("  mlx90614d [-a <addr> | --addr=<addr>]... [-p <ms> | --period=<ms>]\n");
+    mlx90614_interface_debug_print("            [-n <name> | --name=<name>] [-c <num> | --capacity=<num>]\n");
+    mlx90614_interface_debug_print("  mlx90614d (-h | --help)\n");
+    mlx90614_interface_debug_print("\n");
+    mlx90614_interface_debug_print("Options:\n");
+    mlx90614_interface_debug_print("  -a <addr>, --addr=<addr>        Add a sensor iic address, repeatable.([default: 0xB4])\n");
+    mlx90614_interface_debug_print("  -c <num>, --capacity=<num>      Set the ring slot number, a power of two.([default: 4096])\n");
+    mlx90614_interface_debug_print("  -h, --help                      Show the help.\n");
+    mlx90614_interface_debug_print("  -n <name>, --name=<name>        Set the shared memory name.([default: %s])\n", MLX90614_CLIENT_DEFAULT_NAME);
+    mlx90614_interface_debug_print("  -p <ms>, --period=<ms>          Set the sampling period.([default: 1000])\n");
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int loop;
+    int longindex = 0;
+    const char short_options[] = "ha:p:n:c:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"addr", required_argument, NULL, 'a'},
+        {"period", required_argument, NULL, 'p'},
+        {"name", required_argument, NULL, 'n'},
+        {"capacity", required_argument, NULL, 'c'},
+        {NULL, 0, NULL, 0},
+    };
+    uint8_t addr[MLX90614D_MAX_SENSOR];
+    uint32_t num = 0;
+    uint32_t period = 1000;
+    uint32_t capacity = 4096;
+    const char *name = MLX90614_CLIENT_DEFAULT_NAME;
+    char latest[64];
+    uint32_t i;
+    uint32_t inited = 0;
+    struct sigaction sa;
+    uint8_t res = 0;
+    
+    /* parse */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'a' :
+            {
+                if (num >= MLX90614D_MAX_SENSOR)
+                {
+                    return 5;
+                }
+                addr[num++] = (uint8_t)strtoul(optarg, NULL, 0);
+                
+                break;
+            }
+            case 'p' :
+            {
+                period = (uint32_t)strtoul(optarg, NULL, 0);
+                
+                break;
+            }
+            case 'n' :
+            {
+                name = optarg;
+                
+                break;
+            }
+            case 'c' :
+            {
+                capacity = (uint32_t)strtoul(optarg, NULL, 0);
+                
+                break;
+            }
+            case 'h' :
+            {
+                a_mlx90614d_help();
+                
+                return 0;
+            }
+            default :
+            {
+                a_mlx90614d_help();
+                
+                return 5;
+            }
+        }
+    }
+    if (num == 0)
+    {
+        addr[num++] = MLX90614_ADDRESS_DEFAULT;
+    }
+    if (period == 0)
+    {
+        return 5;
+    }
+    
+    /* stop on sigint and sigterm */
+    memset(&sa, 0, sizeof(struct sigaction));
+    sa.sa_handler = a_mlx90614d_signal_handler;
+    (void)sigaction(SIGINT, &sa, NULL);
+    (void)sigaction(SIGTERM, &sa, NULL);
+    
+    /* create the ring */
+    if (shm_ring_create(&gs_ring, name, capacity, sizeof(mlx90614_sample_t)) != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614d: create ring failed.\n");
+        
+        return 1;
+    }
+    
+    /* create the latest value table */
+    (void)snprintf(latest, sizeof(latest), "%s%s", name, MLX90614_LATEST_SUFFIX);
+    if (shm_table_create(&gs_table, latest, num, sizeof(mlx90614_sample_t)) != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614d: create table failed.\n");
+        (void)shm_ring_close(&gs_ring);
+        
+        return 1;
+    }
+    
+    /* loop init */
+    if (loop_init(&loop) != 0)
+    {
+        (void)shm_table_close(&gs_table);
+        (void)shm_ring_close(&gs_ring);
+        
+        return 1;
+    }
+    
+    /* sensor init */
+    for (i = 0; i < num; i++)
+    {
+        uint16_t id[4];
+        
+        if (mlx90614_loop_sensor_init(loop, &gs_sensor[i], addr[i]) != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614d: sensor 0x%02X init failed.\n", addr[i]);
+            res = 1;
+            
+            break;
+        }
+        inited++;
+        if (mlx90614_get_id(&gs_sensor[i].handle, id) != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614d: sensor 0x%02X get id failed.\n", addr[i]);
+            res = 1;
+            
+            break;
+        }
+        gs_id[i] = ((uint64_t)id[3] << 48) | ((uint64_t)id[2] << 32) | ((uint64_t)id[1] << 16) | id[0];
+        gs_sensor[i].user = &gs_id[i];
+        gs_sensor[i].sample_callback = a_mlx90614d_sample_callback;
+        if (mlx90614_loop_sensor_start(&gs_sensor[i], period) != 0)
+        {
+            res = 1;
+            
+            break;
+        }
+    }
+    
+    /* run */
+    if (res == 0)
+    {
+        mlx90614_interface_debug_print("mlx90614d: publish %d sensors to %s.\n", num, name);
+        res = loop_run(loop, &gs_stop);
+    }
+    
+    /* deinit */
+    for (i = 0; i < inited; i++)
+    {
+        (void)mlx90614_loop_sensor_deinit(loop, &gs_sensor[i]);
+    }
+    (void)loop_deinit(loop);
+    (void)shm_table_close(&gs_table);
+    (void)shm_ring_close(&gs_ring);
+    
+    return res;
+}
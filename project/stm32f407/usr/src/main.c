@@ -45,6 +45,16 @@
 #include "getopt.h"
 #include <stdlib.h>
 
+/**
+ * @brief main temperature definition
+ * @note  the fixed point build reports 1 / MLX90614_FIXED_POINT celsius
+ */
+#ifdef MLX90614_FIXED_POINT
+#define MLX90614_MAIN_CELSIUS(t)        ((float)(t) / (float)MLX90614_FIXED_POINT)        /**< temperature to print */
+#else
+#define MLX90614_MAIN_CELSIUS(t)        (t)                                                 /**< temperature to print */
+#endif
+
 /**
  * @brief global var definition
  */
@@ -200,8 +210,8 @@ uint8_t mlx90614(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i;
-        float ambient;
-        float object;
+        mlx90614_temperature_t ambient;
+        mlx90614_temperature_t object;
         
         /* basic init */
         res = mlx90614_basic_init();
@@ -214,7 +224,7 @@ uint8_t mlx90614(uint8_t argc, char **argv)
         for (i = 0; i < times; i++)
         {
             /* read data */
-            res = mlx90614_basic_read((float *)&ambient, (float *)&object);
+            res = mlx90614_basic_read((mlx90614_temperature_t *)&ambient, (mlx90614_temperature_t *)&object);
             if (res)
             {
                 mlx90614_basic_deinit();
@@ -224,7 +234,8 @@ uint8_t mlx90614(uint8_t argc, char **argv)
             
             /* output */
             mlx90614_interface_debug_print("mlx90614: %d/%d.\n", i + 1, times);
-            mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+            mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n",
+                                           MLX90614_MAIN_CELSIUS(ambient), MLX90614_MAIN_CELSIUS(object));
             
             /* delay 1000 ms */
             mlx90614_interface_delay_ms(1000);
@@ -239,8 +250,8 @@ uint8_t mlx90614(uint8_t argc, char **argv)
     {
         uint8_t res;
         uint32_t i;
-        float ambient;
-        float object;
+        mlx90614_temperature_t ambient;
+        mlx90614_temperature_t object;
         
         /* advance init */
         res = mlx90614_advance_init();
@@ -256,7 +267,7 @@ uint8_t mlx90614(uint8_t argc, char **argv)
         for (i = 0; i < times; i++)
         {
             /* read data */
-            res = mlx90614_advance_read((float *)&ambient, (float *)&object);
+            res = mlx90614_advance_read((mlx90614_temperature_t *)&ambient, (mlx90614_temperature_t *)&object);
             if (res)
             {
                 mlx90614_advance_deinit();
@@ -266,7 +277,8 @@ uint8_t mlx90614(uint8_t argc, char **argv)
             
             /* output */
             mlx90614_interface_debug_print("mlx90614: %d/%d.\n", i + 1, times);
-            mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+            mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n",
+                                           MLX90614_MAIN_CELSIUS(ambient), MLX90614_MAIN_CELSIUS(object));
             
             /* delay 1000 ms */
             mlx90614_interface_delay_ms(1000);
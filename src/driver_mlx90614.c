@@ -35,7 +35,9 @@
  */
 
 #include "driver_mlx90614.h"
+#ifndef MLX90614_FIXED_POINT
 #include <math.h>
+#endif
 
 /**
  * @brief chip information definition
@@ -117,9 +119,9 @@ static uint8_t a_mlx90614_calculate_crc(uint8_t *addr, uint8_t len)
  * @return     status code
  *             - 0 success
  *             - 1 read failed
- * @note       none
+ * @note       always reads the chip, a coalesced eeprom cell returns the programmed value
  */
-static uint8_t a_mlx90614_read(mlx90614_handle_t *handle, uint8_t command, uint16_t *data)
+static uint8_t a_mlx90614_read_bus(mlx90614_handle_t *handle, uint8_t command, uint16_t *data)
 {
     uint8_t pec;
     uint8_t arr[5];
@@ -153,13 +155,41 @@ static uint8_t a_mlx90614_read(mlx90614_handle_t *handle, uint8_t command, uint1
         }
         
         *data = (uint16_t)(((uint16_t)buf[1] << 8) | buf[0]);                      /* get data */
+        if (command == MLX90614_REG_EEPROM_CONFIG1)                                /* config1 */
+        {
+            handle->config1 = *data;                                               /* refresh the cache */
+            handle->config1_valid = 1;                                             /* set valid */
+        }
       
         return 0;                                                                  /* success return 0 */
     }
 }
 
 /**
- * @brief     write the data to the bus
+ * @brief      read the data
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  command sent command
+ * @param[out] *data pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a coalesced eeprom cell returns its pending value
+ */
+static uint8_t a_mlx90614_read(mlx90614_handle_t *handle, uint8_t command, uint16_t *data)
+{
+    if (((command & 0xE0) == 0x20) &&
+        ((handle->eeprom_pending & (1UL << (command & 0x1F))) != 0))               /* coalesced eeprom cell */
+    {
+        *data = handle->eeprom_pending_data[command & 0x1F];                       /* get the pending data */
+        
+        return 0;                                                                  /* success return 0 */
+    }
+    
+    return a_mlx90614_read_bus(handle, command, data);                             /* read the bus */
+}
+
+/**
+ * @brief     write a word to the bus
  * @param[in] *handle pointer to an mlx90614 handle structure
  * @param[in] command sent command
  * @param[in] data sent data
@@ -168,69 +198,186 @@ static uint8_t a_mlx90614_read(mlx90614_handle_t *handle, uint8_t command, uint1
  *            - 1 write failed
  * @note      none
  */
-static uint8_t a_mlx90614_write(mlx90614_handle_t *handle, uint8_t command, uint16_t data)
+static uint8_t a_mlx90614_write_word(mlx90614_handle_t *handle, uint8_t command, uint16_t data)
 {
-    uint8_t data_l;
-    uint8_t data_h;
     uint8_t arr[4];
     uint8_t buf[3];
-    uint8_t pec;
     
-    if ((command & 0x20) != 0)                                                         /* if eeprom */
-    {
-        data_l = 0x00;                                                                 /* get lsb */
-        data_h = 0x00;                                                                 /* get msb */
-        arr[0] = handle->iic_addr;                                                     /* set address */
-        arr[1] = command;                                                              /* set command */
-        arr[2] = data_l;                                                               /* set lsb */
-        arr[3] = data_h;                                                               /* set msb */
-        pec = a_mlx90614_calculate_crc((uint8_t *)arr, 4);                             /* calculate pec */
-        buf[0] = data_l;                                                               /* set lsb */
-        buf[1] = data_h;                                                               /* set msb */
-        buf[2] = pec;                                                                  /* set pec */
-        if (handle->iic_write(handle->iic_addr, command, (uint8_t *)buf, 3) != 0)      /* write command */
-        {
-            return 1;                                                                  /* return error */
-        }
-        handle->delay_ms(10);                                                          /* delay 10 ms */
-        data_l = (uint8_t)(data & 0xFF);                                               /* get lsb */
-        data_h = (uint8_t)((data & 0xFF00U) >> 8);                                     /* get msb */
-        arr[0] = handle->iic_addr;                                                     /* set address */
-        arr[1] = command;                                                              /* set command */
-        arr[2] = data_l;                                                               /* set lsb */
-        arr[3] = data_h;                                                               /* set msb */
-        pec = a_mlx90614_calculate_crc((uint8_t *)arr, 4);                             /* calculate pec */
-        buf[0] = data_l;                                                               /* set lsb */
-        buf[1] = data_h;                                                               /* set msb */
-        buf[2] = pec;                                                                  /* set pec */
-        if (handle->iic_write(handle->iic_addr, command, (uint8_t *)buf, 3) != 0)      /* write data */
+    arr[0] = handle->iic_addr;                                                     /* set address */
+    arr[1] = command;                                                              /* set command */
+    arr[2] = (uint8_t)(data & 0xFF);                                               /* set lsb */
+    arr[3] = (uint8_t)((data & 0xFF00U) >> 8);                                     /* set msb */
+    buf[0] = arr[2];                                                               /* set lsb */
+    buf[1] = arr[3];                                                               /* set msb */
+    buf[2] = a_mlx90614_calculate_crc((uint8_t *)arr, 4);                          /* set pec */
+    if (command == MLX90614_REG_EEPROM_CONFIG1)                                    /* config1 changes */
+    {
+        handle->config1_valid = 0;                                                 /* drop the cache */
+    }
+    if (handle->iic_write(handle->iic_addr, command, (uint8_t *)buf, 3) != 0)      /* write data */
+    {
+        return 1;                                                                  /* return error */
+    }
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     check the eeprom write budget
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @return    1 if one more write fits the budget else 0
+ * @note      restarts the window when it is over
+ */
+static uint8_t a_mlx90614_eeprom_admit(mlx90614_handle_t *handle)
+{
+    uint32_t now;
+    
+    if (handle->eeprom_budget == 0)                                                    /* no limit */
+    {
+        return 1;                                                                      /* admit */
+    }
+    if (handle->get_time_ms != NULL)                                                   /* check the clock */
+    {
+        now = handle->get_time_ms();                                                   /* get the time */
+        if ((now - handle->eeprom_window_start) >= handle->eeprom_window_ms)           /* window is over */
         {
-            return 1;                                                                  /* return error */
+            handle->eeprom_window_start = now;                                         /* restart the window */
+            handle->eeprom_window_writes = 0;                                          /* clear the writes */
         }
-        handle->delay_ms(10);                                                          /* delay 10 ms */
-        
-        return 0;                                                                      /* success return 0 */
     }
-    else                                                                               /* ram */
+    
+    return (uint8_t)(handle->eeprom_window_writes < handle->eeprom_budget);            /* check the budget */
+}
+
+/**
+ * @brief     count an eeprom write
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] command eeprom command
+ * @note      a direct write replaces the coalesced value of the cell
+ */
+static void a_mlx90614_eeprom_count(mlx90614_handle_t *handle, uint8_t command)
+{
+    handle->eeprom_writes[command & 0x1F]++;                                           /* count the cell */
+    handle->eeprom_window_writes++;                                                    /* count the window */
+    handle->eeprom_pending &= ~(1UL << (command & 0x1F));                              /* drop the pending data */
+}
+
+/**
+ * @brief     count the coalesced eeprom cells
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @return    pending cell number
+ * @note      none
+ */
+static uint8_t a_mlx90614_eeprom_pending(mlx90614_handle_t *handle)
+{
+    uint8_t n;
+    uint32_t pending;
+    
+    n = 0;                                                                             /* init 0 */
+    pending = handle->eeprom_pending;                                                  /* copy the pending cells */
+    while (pending != 0)                                                               /* all pending cells */
     {
-        data_l = (uint8_t)(data & 0xFF);                                               /* get lsb */
-        data_h = (uint8_t)((data & 0xFF00U) >> 8);                                     /* get msb */
-        arr[0] = handle->iic_addr;                                                     /* set address */
-        arr[1] = command;                                                              /* set command */
-        arr[2] = data_l;                                                               /* set lsb */
-        arr[3] = data_h;                                                               /* set msb */
-        pec = a_mlx90614_calculate_crc((uint8_t *)arr, 4);                             /* calculate pec */
-        buf[0] = data_l;                                                               /* set lsb */
-        buf[1] = data_h;                                                               /* set msb */
-        buf[2] = pec;                                                                  /* set pec */
-        
-        if (handle->iic_write(handle->iic_addr, command, (uint8_t *)buf, 3) != 0)      /* write data */
+        pending &= pending - 1;                                                        /* clear the lowest cell */
+        n++;                                                                           /* count the cell */
+    }
+    
+    return n;                                                                          /* return the number */
+}
+
+/**
+ * @brief     erase and write an eeprom cell
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] command eeprom command
+ * @param[in] data sent data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_mlx90614_eeprom_cycle(mlx90614_handle_t *handle, uint8_t command, uint16_t data)
+{
+    a_mlx90614_eeprom_count(handle, command);                                          /* count the write */
+    if (a_mlx90614_write_word(handle, command, 0x0000) != 0)                           /* erase the cell */
+    {
+        return 1;                                                                      /* return error */
+    }
+    handle->delay_ms(MLX90614_EEPROM_WRITE_MS);                                        /* delay 10 ms */
+    if (a_mlx90614_write_word(handle, command, data) != 0)                             /* write data */
+    {
+        return 1;                                                                      /* return error */
+    }
+    handle->delay_ms(MLX90614_EEPROM_WRITE_MS);                                        /* delay 10 ms */
+    if (command == MLX90614_REG_EEPROM_CONFIG1)                                        /* config1 */
+    {
+        handle->config1 = data;                                                        /* refresh the cache */
+        handle->config1_valid = 1;                                                     /* set valid */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     write the data to the bus
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] command sent command
+ * @param[in] data sent data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      an eeprom write beyond the budget is rejected or coalesced by the budget policy
+ */
+static uint8_t a_mlx90614_write(mlx90614_handle_t *handle, uint8_t command, uint16_t data)
+{
+    if ((command & 0x20) != 0)                                                               /* if eeprom */
+    {
+        if (a_mlx90614_eeprom_admit(handle) == 0)                                            /* check the budget */
         {
-            return 1;                                                                  /* return error */
+            if (handle->eeprom_policy == MLX90614_EEPROM_POLICY_COALESCE)                    /* coalesce */
+            {
+                handle->eeprom_pending |= 1UL << (command & 0x1F);                           /* mark the cell */
+                handle->eeprom_pending_data[command & 0x1F] = data;                          /* keep the last data */
+                handle->eeprom_coalesced++;                                                  /* count the coalesced write */
+                
+                return 0;                                                                    /* success return 0 */
+            }
+            handle->eeprom_rejected++;                                                       /* count the rejected write */
+            MLX90614_LOG_WARNING(handle, MLX90614_EVENT_EEPROM_BUDGET_EXCEEDED, command);    /* eeprom budget is exceeded */
+            
+            return 1;                                                                        /* return error */
         }
         
-        return 0;                                                                      /* success return 0 */
+        return a_mlx90614_eeprom_cycle(handle, command, data);                               /* erase and write */
+    }
+    else                                                                                     /* ram */
+    {
+        return a_mlx90614_write_word(handle, command, data);                                 /* write data */
+    }
+}
+
+/**
+ * @brief     update an eeprom cell only if it differs
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] command eeprom command
+ * @param[in] data sent data
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ * @note      none
+ */
+static uint8_t a_mlx90614_update(mlx90614_handle_t *handle, uint8_t command, uint16_t data)
+{
+    uint16_t prev;
+    
+    if (a_mlx90614_read(handle, command, &prev) != 0)        /* read the cell */
+    {
+        return 1;                                            /* return error */
+    }
+    if (prev == data)                                        /* check the cell */
+    {
+        return 0;                                            /* nothing to write */
     }
+    
+    return a_mlx90614_write(handle, command, data);          /* write data */
 }
 
 /**
@@ -240,7 +387,7 @@ static uint8_t a_mlx90614_write(mlx90614_handle_t *handle, uint8_t command, uint
  * @return    status code
  *            - 0 success
  *            - 2 handle is NULL
- * @note      none
+ * @note      the cached config1 belongs to the previous chip and is dropped
  */
 uint8_t mlx90614_set_addr(mlx90614_handle_t *handle, uint8_t addr)
 {
@@ -250,6 +397,7 @@ uint8_t mlx90614_set_addr(mlx90614_handle_t *handle, uint8_t addr)
     }
     
     handle->iic_addr = addr;        /* set addr */
+    handle->config1_valid = 0;      /* config1 is not cached */
   
     return 0;                       /* success return 0 */
 }
@@ -304,7 +452,7 @@ uint8_t mlx90614_write_addr(mlx90614_handle_t *handle, uint8_t addr)
     res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ADDRESS, (uint16_t *)&prev);       /* read eeprom address */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read eeprom address failed.\n");                  /* read eeprom address failed */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_EEPROM_ADDRESS_FAILED, 0);        /* read eeprom address failed */
         
         return 1;                                                                        /* return error */
     }
@@ -312,7 +460,7 @@ uint8_t mlx90614_write_addr(mlx90614_handle_t *handle, uint8_t addr)
     res = a_mlx90614_write(handle, MLX90614_REG_EEPROM_ADDRESS, prev);                   /* write eeprom address */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: write eeprom address failed.\n");                 /* write eeprom address failed */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_EEPROM_ADDRESS_FAILED, 0);       /* write eeprom address failed */
         
         return 1;                                                                        /* return error */
     }
@@ -350,7 +498,7 @@ uint8_t mlx90614_read_addr(mlx90614_handle_t *handle, uint8_t *addr)
     res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ADDRESS, (uint16_t *)&prev);       /* read eeprom address */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read eeprom address failed.\n");                  /* read eeprom address failed */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_EEPROM_ADDRESS_FAILED, 0);        /* read eeprom address failed */
         
         return 1;                                                                        /* return error */
     }
@@ -369,33 +517,12 @@ uint8_t mlx90614_read_addr(mlx90614_handle_t *handle, uint8_t *addr)
  *            - 1 set fir length failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_fir_length(mlx90614_handle_t *handle, mlx90614_fir_length_t len)
 {
-    uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
-    if (res != 0)                                                                        /* check result */
-    {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    prev &= ~(0x07 << 8);                                                                /* clear config */
-    prev |= len << 8;                                                                    /* set length */
-    
-    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t )prev);       /* write config */
+    return mlx90614_set_field(handle, MLX90614_FIELD_FIR_LENGTH, (uint16_t)len);         /* set field */
 }
 
 /**
@@ -412,27 +539,15 @@ uint8_t mlx90614_set_fir_length(mlx90614_handle_t *handle, mlx90614_fir_length_t
 uint8_t mlx90614_get_fir_length(mlx90614_handle_t *handle, mlx90614_fir_length_t *len)
 {
     uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
+    uint16_t value;
     
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
+    res = mlx90614_get_field(handle, MLX90614_FIELD_FIR_LENGTH, &value);                 /* get field */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
+        return res;                                                                      /* return error */
     }
-    prev &= (0x07 << 8);                                                                 /* get config */
-    *len = (mlx90614_fir_length_t)(0x07 & (prev >> 8));                                  /* get length */
-  
+    *len = (mlx90614_fir_length_t)value;                                                 /* set param */
+    
     return 0;                                                                            /* success return 0 */
 }
 
@@ -445,33 +560,12 @@ uint8_t mlx90614_get_fir_length(mlx90614_handle_t *handle, mlx90614_fir_length_t
  *            - 1 set fir failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_iir(mlx90614_handle_t *handle, mlx90614_iir_t iir)
 {
-    uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
-    if (res != 0)                                                                        /* check result */
-    {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    prev &= ~0x07;                                                                       /* clear config */
-    prev |= iir;                                                                         /* set param */
-    
-    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t )prev);       /* write config */
+    return mlx90614_set_field(handle, MLX90614_FIELD_IIR, (uint16_t)iir);                /* set field */
 }
 
 /**
@@ -488,26 +582,14 @@ uint8_t mlx90614_set_iir(mlx90614_handle_t *handle, mlx90614_iir_t iir)
 uint8_t mlx90614_get_iir(mlx90614_handle_t *handle, mlx90614_iir_t *iir)
 {
     uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
+    uint16_t value;
     
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
+    res = mlx90614_get_field(handle, MLX90614_FIELD_IIR, &value);                        /* get field */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
+        return res;                                                                      /* return error */
     }
-    prev &= 0x07;                                                                        /* get config */
-    *iir = (mlx90614_iir_t)(0x07 & prev);                                                /* get param */
+    *iir = (mlx90614_iir_t)value;                                                        /* set param */
     
     return 0;                                                                            /* success return 0 */
 }
@@ -521,33 +603,12 @@ uint8_t mlx90614_get_iir(mlx90614_handle_t *handle, mlx90614_iir_t *iir)
  *            - 1 set mode failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_mode(mlx90614_handle_t *handle, mlx90614_mode_t mode)
 {
-    uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
-    if (res != 0)                                                                        /* check result */
-    {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    prev &= ~(0x03 << 4);                                                                /* clear config */
-    prev |= mode << 4;                                                                   /* set param */
-    
-    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t )prev);       /* write config */
+    return mlx90614_set_field(handle, MLX90614_FIELD_MODE, (uint16_t)mode);              /* set field */
 }
 
 /**
@@ -564,27 +625,15 @@ uint8_t mlx90614_set_mode(mlx90614_handle_t *handle, mlx90614_mode_t mode)
 uint8_t mlx90614_get_mode(mlx90614_handle_t *handle, mlx90614_mode_t *mode)
 {
     uint8_t res;
-    uint16_t prev;
+    uint16_t value;
     
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-  
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
+    res = mlx90614_get_field(handle, MLX90614_FIELD_MODE, &value);                       /* get field */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
+        return res;                                                                      /* return error */
     }
-    prev &= (0x03 << 4);                                                                 /* clear config */
-    *mode = (mlx90614_mode_t)(0x03 & (prev >> 4));                                       /* get mode */
-  
+    *mode = (mlx90614_mode_t)value;                                                      /* set param */
+    
     return 0;                                                                            /* success return 0 */
 }
 
@@ -597,33 +646,12 @@ uint8_t mlx90614_get_mode(mlx90614_handle_t *handle, mlx90614_mode_t *mode)
  *            - 1 set ir sensor failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_ir_sensor(mlx90614_handle_t *handle, mlx90614_ir_sensor_t sensor)
 {
-    uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
-    if (res != 0)                                                                        /* check result */
-    {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    prev &= ~(0x01 << 6);                                                                /* clear config */
-    prev |= sensor << 6;                                                                 /* set param */
-   
-    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t )prev);       /* write config */
+    return mlx90614_set_field(handle, MLX90614_FIELD_IR_SENSOR, (uint16_t)sensor);       /* set field */
 }
 
 /**
@@ -640,26 +668,14 @@ uint8_t mlx90614_set_ir_sensor(mlx90614_handle_t *handle, mlx90614_ir_sensor_t s
 uint8_t mlx90614_get_ir_sensor(mlx90614_handle_t *handle, mlx90614_ir_sensor_t *sensor)
 {
     uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
+    uint16_t value;
     
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
+    res = mlx90614_get_field(handle, MLX90614_FIELD_IR_SENSOR, &value);                  /* get field */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* return error */
-        
-        return 1;
+        return res;                                                                      /* return error */
     }
-    prev &= (0x01 << 6);                                                                 /* get config */
-    *sensor = (mlx90614_ir_sensor_t)(0x01 & (prev >> 6));                                /* ge sensor */
+    *sensor = (mlx90614_ir_sensor_t)value;                                               /* set param */
     
     return 0;                                                                            /* success return 0 */
 }
@@ -673,33 +689,12 @@ uint8_t mlx90614_get_ir_sensor(mlx90614_handle_t *handle, mlx90614_ir_sensor_t *
  *            - 1 set ks failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_ks(mlx90614_handle_t *handle, mlx90614_ks_t ks)
 {
-    uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
-    if (res != 0)                                                                        /* check result */
-    {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    prev &= ~(0x01 << 7);                                                                /* clear config */
-    prev |= ks << 7;                                                                     /* set param */
-    
-    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t )prev);       /* write config */
+    return mlx90614_set_field(handle, MLX90614_FIELD_KS, (uint16_t)ks);                  /* set field */
 }
 
 /**
@@ -716,26 +711,14 @@ uint8_t mlx90614_set_ks(mlx90614_handle_t *handle, mlx90614_ks_t ks)
 uint8_t mlx90614_get_ks(mlx90614_handle_t *handle, mlx90614_ks_t *ks)
 {
     uint8_t res;
-    uint16_t prev;
+    uint16_t value;
     
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-  
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
+    res = mlx90614_get_field(handle, MLX90614_FIELD_KS, &value);                         /* get field */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
+        return res;                                                                      /* return error */
     }
-    prev &= (0x01 << 7);                                                                 /* get config */
-    *ks = (mlx90614_ks_t)(0x01 & (prev >> 7));                                           /* get ks */
+    *ks = (mlx90614_ks_t)value;                                                          /* set param */
     
     return 0;                                                                            /* success return 0 */
 }
@@ -749,33 +732,12 @@ uint8_t mlx90614_get_ks(mlx90614_handle_t *handle, mlx90614_ks_t *ks)
  *            - 1 set kt2 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_kt2(mlx90614_handle_t *handle, mlx90614_kt2_t kt2)
 {
-    uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
-    if (res != 0)                                                                        /* check result */
-    {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed. */
-        
-        return 1;                                                                        /* return error */
-    }
-    prev &= ~(0x01 << 14);                                                               /* clear config */
-    prev |= kt2 << 14;                                                                   /* set param */
-    
-    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t )prev);       /* write config */
+    return mlx90614_set_field(handle, MLX90614_FIELD_KT2, (uint16_t)kt2);                /* set field */
 }
 
 /**
@@ -792,26 +754,14 @@ uint8_t mlx90614_set_kt2(mlx90614_handle_t *handle, mlx90614_kt2_t kt2)
 uint8_t mlx90614_get_kt2(mlx90614_handle_t *handle, mlx90614_kt2_t *kt2)
 {
     uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
+    uint16_t value;
     
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
+    res = mlx90614_get_field(handle, MLX90614_FIELD_KT2, &value);                        /* get field */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
+        return res;                                                                      /* return error */
     }
-    prev &= (0x01 << 14);                                                                /* get config */
-    *kt2 = (mlx90614_kt2_t)(0x01 & (prev >> 14));                                        /* get kt2 */
+    *kt2 = (mlx90614_kt2_t)value;                                                        /* set param */
     
     return 0;                                                                            /* success return 0 */
 }
@@ -825,33 +775,12 @@ uint8_t mlx90614_get_kt2(mlx90614_handle_t *handle, mlx90614_kt2_t *kt2)
  *            - 1 set gain failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_gain(mlx90614_handle_t *handle, mlx90614_gain_t gain)
 {
-    uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
-    if (res != 0)                                                                        /* check result */
-    {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    prev &= ~(0x07 << 11);                                                               /* clear config */
-    prev |= gain << 11;                                                                  /* set param */
-    
-    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t )prev);       /* write config */
+    return mlx90614_set_field(handle, MLX90614_FIELD_GAIN, (uint16_t)gain);              /* set field */
 }
 
 /**
@@ -868,26 +797,14 @@ uint8_t mlx90614_set_gain(mlx90614_handle_t *handle, mlx90614_gain_t gain)
 uint8_t mlx90614_get_gain(mlx90614_handle_t *handle, mlx90614_gain_t *gain)
 {
     uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
+    uint16_t value;
     
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
+    res = mlx90614_get_field(handle, MLX90614_FIELD_GAIN, &value);                       /* get field */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
+        return res;                                                                      /* return error */
     }
-    prev &= 0x07 << 11;                                                                  /* get config */
-    *gain = (mlx90614_gain_t)(0x07 & (prev >> 11));                                      /* get param */
+    *gain = (mlx90614_gain_t)value;                                                      /* set param */
     
     return 0;                                                                            /* success return 0 */
 }
@@ -901,33 +818,12 @@ uint8_t mlx90614_get_gain(mlx90614_handle_t *handle, mlx90614_gain_t *gain)
  *            - 1 set sensor test failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_sensor_test(mlx90614_handle_t *handle, mlx90614_bool_t enable)
 {
-    uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
-    if (res != 0)                                                                        /* check result */
-    {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    prev &= ~(0x01 << 15);                                                               /* clear config */
-    prev |= enable << 15;                                                                /* set param */
-    
-    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t )prev);       /* write config */
+    return mlx90614_set_field(handle, MLX90614_FIELD_SENSOR_TEST, (uint16_t)enable);     /* set field */
 }
 
 /**
@@ -944,26 +840,14 @@ uint8_t mlx90614_set_sensor_test(mlx90614_handle_t *handle, mlx90614_bool_t enab
 uint8_t mlx90614_get_sensor_test(mlx90614_handle_t *handle, mlx90614_bool_t *enable)
 {
     uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
+    uint16_t value;
     
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
+    res = mlx90614_get_field(handle, MLX90614_FIELD_SENSOR_TEST, &value);                /* get field */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
+        return res;                                                                      /* return error */
     }
-    prev &= 0x01 << 15;                                                                  /* get config */
-    *enable = (mlx90614_bool_t)(0x01 & (prev >> 15));                                    /* set param */
+    *enable = (mlx90614_bool_t)value;                                                    /* set param */
     
     return 0;                                                                            /* success return 0 */
 }
@@ -977,33 +861,12 @@ uint8_t mlx90614_get_sensor_test(mlx90614_handle_t *handle, mlx90614_bool_t *ena
  *            - 1 set repeat sensor test failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_repeat_sensor_test(mlx90614_handle_t *handle, mlx90614_bool_t enable)
 {
-    uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
-    if (res != 0)                                                                        /* check result */
-    {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
-    }
-    prev &= ~(0x01 << 3);                                                                /* clear config */
-    prev |= enable << 3;                                                                 /* set param */
-    
-    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t )prev);       /* write config */
+    return mlx90614_set_field(handle, MLX90614_FIELD_REPEAT_SENSOR_TEST, (uint16_t)enable); /* set field */
 }
 
 /**
@@ -1020,27 +883,15 @@ uint8_t mlx90614_set_repeat_sensor_test(mlx90614_handle_t *handle, mlx90614_bool
 uint8_t mlx90614_get_repeat_sensor_test(mlx90614_handle_t *handle, mlx90614_bool_t *enable)
 {
     uint8_t res;
-    uint16_t prev;
-    
-    if (handle == NULL)                                                                  /* check handle */
-    {
-        return 2;                                                                        /* return error */
-    }
-    if (handle->inited != 1)                                                             /* check handle initialization */
-    {
-        return 3;                                                                        /* return error */
-    }
+    uint16_t value;
     
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, (uint16_t *)&prev);       /* read config */
+    res = mlx90614_get_field(handle, MLX90614_FIELD_REPEAT_SENSOR_TEST, &value);         /* get field */
     if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mlx90614: read config failed.\n");                          /* read config failed */
-        
-        return 1;                                                                        /* return error */
+        return res;                                                                      /* return error */
     }
-    prev &= 0x01 << 3;                                                                   /* get config */
-    *enable = (mlx90614_bool_t)(0x01 & (prev >> 3));                                     /* set param */
-   
+    *enable = (mlx90614_bool_t)value;                                                    /* set param */
+    
     return 0;                                                                            /* success return 0 */
 }
 
@@ -1105,28 +956,39 @@ uint8_t mlx90614_get_emissivity_correction_coefficient(mlx90614_handle_t *handle
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  *             - 4 s is over 1.0
- * @note       none
+ * @note       s is in 1 / MLX90614_EMISSIVITY_SCALE with MLX90614_FIXED_POINT
  */
-uint8_t mlx90614_emissivity_correction_coefficient_convert_to_register(mlx90614_handle_t *handle, double s, uint16_t *reg)
+uint8_t mlx90614_emissivity_correction_coefficient_convert_to_register(mlx90614_handle_t *handle, mlx90614_emissivity_t s, uint16_t *reg)
 {
-    if (handle == NULL)                                           /* check handle */
+    if (handle == NULL)                                                                                 /* check handle */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                                            /* check handle initialization */
     {
-        return 2;                                                 /* return error */
+        return 3;                                                                                       /* return error */
     }
-    if (handle->inited != 1)                                      /* check handle initialization */
+#ifdef MLX90614_FIXED_POINT
+    if (s > MLX90614_EMISSIVITY_SCALE)                                                                  /* check s */
     {
-        return 3;                                                 /* return error */
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_EMISSIVITY_OVER_1, 0);                              /* return error */
+        
+        return 4;                                                                                       /* return error */
     }
-    if (s > 1.0)                                                  /* check s */
+    
+    *reg = (uint16_t)((65535U * s + MLX90614_EMISSIVITY_SCALE / 2) / MLX90614_EMISSIVITY_SCALE);        /* set reg */
+#else
+    if (s > 1.0)                                                                                        /* check s */
     {
-        handle->debug_print("mlx90614: s is over 1.0.\n");        /* return error */
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_EMISSIVITY_OVER_1, 0);                              /* return error */
         
-        return 4;                                                 /* return error */
+        return 4;                                                                                       /* return error */
     }
     
-    *reg = (uint16_t)(round((double)65535 * s));                  /* set reg */
+    *reg = (uint16_t)(round((double)65535 * s));                                                        /* set reg */
+#endif
     
-    return 0;                                                     /* success return 0 */
+    return 0;                                                                                           /* success return 0 */
 }
 
 /**
@@ -1139,9 +1001,9 @@ uint8_t mlx90614_emissivity_correction_coefficient_convert_to_register(mlx90614_
  *             - 1 emissivity correction coefficient convert to data failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       s is in 1 / MLX90614_EMISSIVITY_SCALE with MLX90614_FIXED_POINT
  */
-uint8_t mlx90614_emissivity_correction_coefficient_convert_to_data(mlx90614_handle_t *handle, uint16_t reg, double *s)
+uint8_t mlx90614_emissivity_correction_coefficient_convert_to_data(mlx90614_handle_t *handle, uint16_t reg, mlx90614_emissivity_t *s)
 {
     if (handle == NULL)                      /* check handle */
     {
@@ -1152,7 +1014,11 @@ uint8_t mlx90614_emissivity_correction_coefficient_convert_to_data(mlx90614_hand
          return 3;                           /* return error */
     }
     
+#ifdef MLX90614_FIXED_POINT
+    *s = ((uint32_t)reg * MLX90614_EMISSIVITY_SCALE + 32767U) / 65535U;        /* convert reg */
+#else
     *s = (double) reg / 65535;               /* convert reg */
+#endif
     
     return 0;                                /* success return 0 */
 }
@@ -1185,14 +1051,14 @@ uint8_t mlx90614_read_raw_ir_channel(mlx90614_handle_t *handle, uint16_t *channe
     res = a_mlx90614_read(handle, MLX90614_REG_RAM_RAW_DATA_IR_CHANNEL_1, (uint16_t *)channel_1);       /* read data */
     if (res != 0)                                                                                       /* check result */
     {
-        handle->debug_print("mlx90614: read raw channel 1 failed.\n");                                  /* read raw channel 1 failed */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_RAW_CHANNEL_1_FAILED, 0);                        /* read raw channel 1 failed */
         
         return 1;                                                                                       /* return error */
     }
     res = a_mlx90614_read(handle, MLX90614_REG_RAM_RAW_DATA_IR_CHANNEL_2, (uint16_t *)channel_2);       /* read data */
     if (res != 0)                                                                                       /* check result */
     {
-        handle->debug_print("mlx90614: read raw channel 2 failed.\n");                                  /* read raw channel 2 failed */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_RAW_CHANNEL_2_FAILED, 0);                        /* read raw channel 2 failed */
         
         return 1;                                                                                       /* return error */
     }
@@ -1212,7 +1078,7 @@ uint8_t mlx90614_read_raw_ir_channel(mlx90614_handle_t *handle, uint16_t *channe
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mlx90614_read_ambient(mlx90614_handle_t *handle, uint16_t *raw, float *celsius)
+uint8_t mlx90614_read_ambient(mlx90614_handle_t *handle, uint16_t *raw, mlx90614_temperature_t *celsius)
 {
     uint8_t res;
     
@@ -1228,327 +1094,2213 @@ uint8_t mlx90614_read_ambient(mlx90614_handle_t *handle, uint16_t *raw, float *c
     res = a_mlx90614_read(handle, MLX90614_REG_RAM_TA, (uint16_t *)raw);       /* read data */
     if (res != 0)                                                              /* check result */
     {
-        handle->debug_print("mlx90614: read raw ta failed.\n");                /* read raw ta failed */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_RAW_TA_FAILED, 0);      /* read raw ta failed */
         
         return 1;                                                              /* return error */
     }
+#ifdef MLX90614_FIXED_POINT
+    *celsius = (int32_t)(*raw) * (MLX90614_FIXED_POINT / 50) - 27315 * (MLX90614_FIXED_POINT / 100);        /* get celsius */
+#else
     *celsius = (float)(*raw) * 0.02f - 273.15f;                                /* get celsius */
+#endif
+    if (handle->sample_hook != NULL)                                           /* check the sample hook */
+    {
+        handle->sample_hook(handle->sample_hook_arg, MLX90614_REG_RAM_TA, *celsius);        /* run the sample hook */
+    }
     
     return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief      read the object1
+ * @brief mlx90614 live zones of every mode
+ */
+static const uint8_t gs_zone_live[4] =
+{
+    MLX90614_ZONE_TA | MLX90614_ZONE_TOBJ1,           /* MLX90614_MODE_TA_TOBJ1 */
+    MLX90614_ZONE_TA | MLX90614_ZONE_TOBJ2,           /* MLX90614_MODE_TA_TOBJ2 */
+    MLX90614_ZONE_TOBJ2,                              /* MLX90614_MODE_TOBJ2 */
+    MLX90614_ZONE_TOBJ1 | MLX90614_ZONE_TOBJ2,        /* MLX90614_MODE_TOBJ1_TOBJ2 */
+};
+
+/**
+ * @brief      get the live zones from the config1 cache
  * @param[in]  *handle pointer to an mlx90614 handle structure
- * @param[out] *raw pointer to a raw data buffer
- * @param[out] *celsius pointer to a celsius data buffer
+ * @param[out] *live pointer to a live zone buffer
  * @return     status code
  *             - 0 success
- *             - 1 read object1 failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- *             - 4 flag error
- * @note       none
+ *             - 1 get live zones failed
+ * @note       reads config1 only when the cache is not valid
  */
-uint8_t mlx90614_read_object1(mlx90614_handle_t *handle, uint16_t *raw, float *celsius)
+static uint8_t a_mlx90614_live_zones(mlx90614_handle_t *handle, uint8_t *live)
 {
-    uint8_t res;
+    uint16_t config1;
+    uint8_t zones;
     
-    if (handle == NULL)                                                           /* check handle */
-    {
-         return 2;                                                                /* return error */
-    }
-    if (handle->inited != 1)                                                      /* check handle initialization */
+    config1 = handle->config1;                                                        /* get the cache */
+    if (handle->config1_valid == 0)                                                   /* not cached */
     {
-         return 3;                                                                /* return error */
+        if (a_mlx90614_read(handle, MLX90614_REG_EEPROM_CONFIG1, &config1) != 0)      /* read config1 and cache it */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_FIELD_FAILED, MLX90614_REG_EEPROM_CONFIG1);        /* read field failed */
+            
+            return 1;                                                                 /* return error */
+        }
     }
     
-    res = a_mlx90614_read(handle, MLX90614_REG_RAM_TOBJ1, (uint16_t *)raw);       /* read data */
-    if (res != 0)                                                                 /* check result */
+    zones = gs_zone_live[(config1 >> 4) & 0x03];                                      /* zones of the mode */
+    if (((config1 >> 6) & 0x01) == MLX90614_IR_SENSOR_SINGLE)                         /* single ir sensor */
     {
-        handle->debug_print("mlx90614: read ram tobj1 failed.\n");                /* read ram tobj1 failed. */
-        
-        return 1;                                                                 /* return error */
-    }
-    if (((*raw) & 0x8000U) != 0)                                                  /* check result */
-    {
-        handle->debug_print("mlx90614: flag error.\n");                           /* flag error */
-        
-        return 4;                                                                 /* return error */
+        if ((zones & MLX90614_ZONE_TOBJ2) != 0)                                       /* no tobj2 */
+        {
+            zones = (uint8_t)((zones & ~MLX90614_ZONE_TOBJ2) | MLX90614_ZONE_TOBJ1);  /* read tobj1 instead */
+        }
     }
-    *celsius = (float)(*raw) * 0.02f - 273.15f;                                   /* get celsius */
+    *live = zones;                                                                    /* set the zones */
     
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                         /* success return 0 */
 }
 
 /**
- * @brief      read the object2
+ * @brief      convert an object or ambient raw data
+ * @param[in]  raw raw data
+ * @return     temperature
+ * @note       none
+ */
+static inline mlx90614_temperature_t a_mlx90614_zone_celsius(uint16_t raw)
+{
+#ifdef MLX90614_FIXED_POINT
+    return (int32_t)raw * (MLX90614_FIXED_POINT / 50) - 27315 * (MLX90614_FIXED_POINT / 100);        /* get celsius */
+#else
+    return (float)raw * 0.02f - 273.15f;                                              /* get celsius */
+#endif
+}
+
+/**
+ * @brief      get the live zones of the cached mode
  * @param[in]  *handle pointer to an mlx90614 handle structure
- * @param[out] *raw pointer to a raw data buffer
- * @param[out] *celsius pointer to a celsius data buffer
+ * @param[out] *live pointer to a live zone buffer, MLX90614_ZONE_TA - TOBJ2
  * @return     status code
  *             - 0 success
- *             - 1 read object2 failed
+ *             - 1 get live zones failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- *             - 4 flag error
- * @note       none
+ * @note       config1 is read once and cached, the driver refreshes the cache on every config1 write,
+ *             a single ir sensor chip has no tobj2, so its tobj2 modes read tobj1
  */
-uint8_t mlx90614_read_object2(mlx90614_handle_t *handle, uint16_t *raw, float *celsius)
+uint8_t mlx90614_get_live_zones(mlx90614_handle_t *handle, uint8_t *live)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                                           /* check handle */
-    {
-         return 2;                                                                /* return error */
-    }
-    if (handle->inited != 1)                                                      /* check handle initialization */
-    {
-         return 3;                                                                /* return error */
-    }
-    
-    res = a_mlx90614_read(handle, MLX90614_REG_RAM_TOBJ2, (uint16_t *)raw);       /* read data */
-    if (res != 0)                                                                 /* check result */
+    if (handle == NULL)                                                               /* check handle */
     {
-        handle->debug_print("mlx90614: read ram tobj2 failed.\n");                /* read ram tobj2 failed. */
-        
-        return 1;                                                                 /* return error */
+        return 2;                                                                     /* return error */
     }
-    if (((*raw) & 0x8000U) != 0)                                                  /* check result */
+    if (handle->inited != 1)                                                          /* check handle initialization */
     {
-        handle->debug_print("mlx90614: flag error.\n");                           /* flag error */
-        
-        return 4;                                                                 /* return error */
+        return 3;                                                                     /* return error */
     }
-    *celsius = (float)(*raw) * 0.02f - 273.15f;                                   /* get celsius */
     
-    return 0;                                                                     /* success return 0 */
+    return a_mlx90614_live_zones(handle, live);                                       /* get the live zones */
 }
 
 /**
- * @brief      get the chip id
+ * @brief      read the live zones of the cached mode
  * @param[in]  *handle pointer to an mlx90614 handle structure
- * @param[out] *id pointer to an id buffer
+ * @param[out] *zone pointer to a zone structure
+ * @param[in]  fuse MLX90614_BOOL_TRUE to get the fused estimate, the difference and the gradient
  * @return     status code
  *             - 0 success
- *             - 1 get id failed
+ *             - 1 read zones failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 4 every live object zone has the error flag
+ * @note       only the registers the mode updates are read, a zone with the error flag is left out of valid
  */
-uint8_t mlx90614_get_id(mlx90614_handle_t *handle, uint16_t id[4])
+uint8_t mlx90614_read_zones(mlx90614_handle_t *handle, mlx90614_zone_t *zone, mlx90614_bool_t fuse)
 {
-    uint8_t res;
+    uint8_t live;
     
-    if (handle == NULL)                                                                      /* check handle */
+    if (handle == NULL)                                                               /* check handle */
     {
-         return 2;                                                                           /* return error */
+        return 2;                                                                     /* return error */
     }
-    if (handle->inited != 1)                                                                 /* check handle initialization */
+    if (handle->inited != 1)                                                          /* check handle initialization */
     {
-         return 3;                                                                           /* return error */
+        return 3;                                                                     /* return error */
     }
     
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ID1_NUMBER, (uint16_t *)&id[0]);       /* read data */
-    if (res != 0)                                                                            /* check result */
+    if (a_mlx90614_live_zones(handle, &live) != 0)                                    /* get the live zones */
     {
-        handle->debug_print("mlx90614: read id1 failed.\n");                                 /* read id1 failed */
-        
-        return 1;                                                                            /* return error */
+        return 1;                                                                     /* return error */
     }
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ID2_NUMBER, (uint16_t *)&id[1]);       /* read data */
-    if (res != 0)                                                                            /* check result */
+    memset(zone, 0, sizeof(mlx90614_zone_t));                                         /* clear the zone */
+    zone->live = live;                                                                /* set the live zones */
+    if ((live & MLX90614_ZONE_TA) != 0)                                               /* ambient */
     {
-        handle->debug_print("mlx90614: read id2 failed.\n");                                 /* read id2 failed */
-        
-        return 1;                                                                            /* return error */
+        if (a_mlx90614_read(handle, MLX90614_REG_RAM_TA, &zone->ambient_raw) != 0)    /* read data */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_RAW_TA_FAILED, 0);         /* read raw ta failed */
+            
+            return 1;                                                                 /* return error */
+        }
+        zone->ambient = a_mlx90614_zone_celsius(zone->ambient_raw);                   /* get celsius */
+        zone->valid |= MLX90614_ZONE_TA;                                              /* set valid */
+        if (handle->sample_hook != NULL)                                              /* check the sample hook */
+        {
+            handle->sample_hook(handle->sample_hook_arg, MLX90614_REG_RAM_TA, zone->ambient);        /* run the sample hook */
+        }
     }
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ID3_NUMBER, (uint16_t *)&id[2]);       /* read data */
-    if (res != 0)                                                                            /* check result */
+    if ((live & MLX90614_ZONE_TOBJ1) != 0)                                            /* object1 */
     {
-        handle->debug_print("mlx90614: read id3 failed.\n");                                 /* read id3 failed */
-        
-        return 1;                                                                            /* return error */
+        if (a_mlx90614_read(handle, MLX90614_REG_RAM_TOBJ1, &zone->object1_raw) != 0)        /* read data */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_RAM_TOBJ1_FAILED, 0);      /* read ram tobj1 failed */
+            
+            return 1;                                                                 /* return error */
+        }
+        if ((zone->object1_raw & 0x8000U) == 0)                                       /* check the flag */
+        {
+            zone->object1 = a_mlx90614_zone_celsius(zone->object1_raw);               /* get celsius */
+            zone->valid |= MLX90614_ZONE_TOBJ1;                                       /* set valid */
+            if (handle->sample_hook != NULL)                                          /* check the sample hook */
+            {
+                handle->sample_hook(handle->sample_hook_arg, MLX90614_REG_RAM_TOBJ1, zone->object1);        /* run the sample hook */
+            }
+        }
     }
-    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ID4_NUMBER, (uint16_t *)&id[3]);       /* read data */
-    if (res != 0)                                                                            /* check result */
+    if ((live & MLX90614_ZONE_TOBJ2) != 0)                                            /* object2 */
     {
-        handle->debug_print("mlx90614: read id4 failed.\n");                                 /* read id4 failed */
-        
+        if (a_mlx90614_read(handle, MLX90614_REG_RAM_TOBJ2, &zone->object2_raw) != 0)        /* read data */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_RAM_TOBJ2_FAILED, 0);      /* read ram tobj2 failed */
+            
+            return 1;                                                                 /* return error */
+        }
+        if ((zone->object2_raw & 0x8000U) == 0)                                       /* check the flag */
+        {
+            zone->object2 = a_mlx90614_zone_celsius(zone->object2_raw);               /* get celsius */
+            zone->valid |= MLX90614_ZONE_TOBJ2;                                       /* set valid */
+            if (handle->sample_hook != NULL)                                          /* check the sample hook */
+            {
+                handle->sample_hook(handle->sample_hook_arg, MLX90614_REG_RAM_TOBJ2, zone->object2);        /* run the sample hook */
+            }
+        }
+    }
+    if ((zone->valid & (MLX90614_ZONE_TOBJ1 | MLX90614_ZONE_TOBJ2)) == 0)             /* no valid object zone */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_FLAG_ERROR, live);                  /* flag error */
+        
+        return 4;                                                                     /* return error */
+    }
+    
+    if (fuse == MLX90614_BOOL_TRUE)                                                   /* fuse the zones */
+    {
+        if ((zone->valid & MLX90614_ZONE_TOBJ1) == 0)                                 /* object2 only */
+        {
+            zone->fused = zone->object2;                                              /* set object2 */
+        }
+        else if ((zone->valid & MLX90614_ZONE_TOBJ2) == 0)                            /* object1 only */
+        {
+            zone->fused = zone->object1;                                              /* set object1 */
+        }
+        else                                                                          /* both zones */
+        {
+            zone->fused = (zone->object1 + zone->object2) / 2;                        /* mean of the zones */
+            zone->difference = zone->object1 - zone->object2;                         /* object1 - object2 */
+            zone->valid |= MLX90614_ZONE_DIFFERENCE;                                  /* set valid */
+        }
+        zone->valid |= MLX90614_ZONE_FUSED;                                           /* set valid */
+        if ((zone->valid & MLX90614_ZONE_TA) != 0)                                    /* ambient is live */
+        {
+            zone->gradient = zone->fused - zone->ambient;                             /* fused - ambient */
+            zone->valid |= MLX90614_ZONE_GRADIENT;                                    /* set valid */
+        }
+    }
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the sample hook
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *hook pointer to a sample hook function, NULL removes the hook
+ * @param[in] *arg hook argument
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the ambient, object and zone reads call the hook with the register and the temperature
+ *            of every valid sample before they return, one hook per handle
+ */
+uint8_t mlx90614_set_sample_hook(mlx90614_handle_t *handle, void (*hook)(void *arg, uint8_t reg, mlx90614_temperature_t celsius),
+                                 void *arg)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
+    }
+    
+    handle->sample_hook = hook;                          /* set the hook */
+    handle->sample_hook_arg = arg;                       /* set the argument */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief      read the object1
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *celsius pointer to a celsius data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read object1 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 flag error
+ * @note       none
+ */
+uint8_t mlx90614_read_object1(mlx90614_handle_t *handle, uint16_t *raw, mlx90614_temperature_t *celsius)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                           /* check handle */
+    {
+         return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+         return 3;                                                                /* return error */
+    }
+    
+    res = a_mlx90614_read(handle, MLX90614_REG_RAM_TOBJ1, (uint16_t *)raw);       /* read data */
+    if (res != 0)                                                                 /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_RAM_TOBJ1_FAILED, 0);      /* read ram tobj1 failed. */
+        
+        return 1;                                                                 /* return error */
+    }
+    if (((*raw) & 0x8000U) != 0)                                                  /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_FLAG_ERROR, 0);                 /* flag error */
+        
+        return 4;                                                                 /* return error */
+    }
+#ifdef MLX90614_FIXED_POINT
+    *celsius = (int32_t)(*raw) * (MLX90614_FIXED_POINT / 50) - 27315 * (MLX90614_FIXED_POINT / 100);        /* get celsius */
+#else
+    *celsius = (float)(*raw) * 0.02f - 273.15f;                                   /* get celsius */
+#endif
+    if (handle->sample_hook != NULL)                                              /* check the sample hook */
+    {
+        handle->sample_hook(handle->sample_hook_arg, MLX90614_REG_RAM_TOBJ1, *celsius);        /* run the sample hook */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      read the object2
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *celsius pointer to a celsius data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read object2 failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 flag error
+ * @note       none
+ */
+uint8_t mlx90614_read_object2(mlx90614_handle_t *handle, uint16_t *raw, mlx90614_temperature_t *celsius)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                           /* check handle */
+    {
+         return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+         return 3;                                                                /* return error */
+    }
+    
+    res = a_mlx90614_read(handle, MLX90614_REG_RAM_TOBJ2, (uint16_t *)raw);       /* read data */
+    if (res != 0)                                                                 /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_RAM_TOBJ2_FAILED, 0);      /* read ram tobj2 failed. */
+        
+        return 1;                                                                 /* return error */
+    }
+    if (((*raw) & 0x8000U) != 0)                                                  /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_FLAG_ERROR, 0);                 /* flag error */
+        
+        return 4;                                                                 /* return error */
+    }
+#ifdef MLX90614_FIXED_POINT
+    *celsius = (int32_t)(*raw) * (MLX90614_FIXED_POINT / 50) - 27315 * (MLX90614_FIXED_POINT / 100);        /* get celsius */
+#else
+    *celsius = (float)(*raw) * 0.02f - 273.15f;                                   /* get celsius */
+#endif
+    if (handle->sample_hook != NULL)                                              /* check the sample hook */
+    {
+        handle->sample_hook(handle->sample_hook_arg, MLX90614_REG_RAM_TOBJ2, *celsius);        /* run the sample hook */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the chip id
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *id pointer to an id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get id failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_id(mlx90614_handle_t *handle, uint16_t id[4])
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                      /* check handle */
+    {
+         return 2;                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                 /* check handle initialization */
+    {
+         return 3;                                                                           /* return error */
+    }
+    
+    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ID1_NUMBER, (uint16_t *)&id[0]);       /* read data */
+    if (res != 0)                                                                            /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_ID1_FAILED, 0);                       /* read id1 failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ID2_NUMBER, (uint16_t *)&id[1]);       /* read data */
+    if (res != 0)                                                                            /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_ID2_FAILED, 0);                       /* read id2 failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ID3_NUMBER, (uint16_t *)&id[2]);       /* read data */
+    if (res != 0)                                                                            /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_ID3_FAILED, 0);                       /* read id3 failed */
+        
+        return 1;                                                                            /* return error */
+    }
+    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_ID4_NUMBER, (uint16_t *)&id[3]);       /* read data */
+    if (res != 0)                                                                            /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_ID4_FAILED, 0);                       /* read id4 failed */
+        
         return 1;                                                                            /* return error */
     }
     
-    return 0;                                                                                /* success return 0 */
+    return 0;                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the flag
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *flag pointer to a flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get flag failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_flag(mlx90614_handle_t *handle, uint16_t *flag)
+{
+    if (handle == NULL)                                                                       /* check handle */
+    {
+         return 2;                                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                                  /* check handle initialization */
+    {
+         return 3;                                                                            /* return error */
+    }
+    
+    if (handle->iic_read(handle->iic_addr, COMMAND_READ_FLAGS, (uint8_t *)flag, 1) != 0)      /* read config */
+    {
+        return 1;                                                                             /* return error */
+    }
+    else
+    {
+        return 0;                                                                             /* success return 0 */
+    }
+}
+
+/**
+ * @brief     enter to sleep mode
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 enter sleep mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mlx90614_enter_sleep_mode(mlx90614_handle_t *handle)
+{
+    uint8_t crc;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                                         /* check handle */
+    {
+         return 2;                                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                                    /* check handle initialization */
+    {
+         return 3;                                                                              /* return error */
+    }
+    
+    buf[0] = handle->iic_addr;                                                                  /* set iic address */
+    buf[1] = COMMAND_ENTER_SLEEP;                                                               /* set command */
+    crc = a_mlx90614_calculate_crc((uint8_t *)buf, 2);                                          /* set crc */
+    
+    if (handle->iic_write(handle->iic_addr, COMMAND_ENTER_SLEEP, (uint8_t *)&crc, 1) != 0)      /* write config */
+    {
+        return 1;                                                                               /* return error */
+    }
+    else
+    {
+        return 0;                                                                               /* success return 0 */
+    }
+}
+
+/**
+ * @brief     change pwm mode to smbus mode
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 pwm to smbus failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mlx90614_pwm_to_smbus(mlx90614_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+         return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+         return 3;                                                         /* return error */
+    }
+    
+    res = handle->scl_write(0);                                            /* set scl low */
+    if (res != 0)                                                          /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SCL_FAILED, 0);    /* write scl failed */
+        
+        return 1;                                                          /* return error */
+    }
+    handle->delay_ms(5);                                                   /* delay 5 ms */
+    res = handle->scl_write(1);                                            /* set scl high */
+    if (res != 0)                                                          /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SCL_FAILED, 0);    /* write scl failed */
+        
+        return 1;                                                          /* return error */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     set the to max
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] value set value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set to max failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      in thermal relay mode this cell holds the hysteresis
+ */
+uint8_t mlx90614_set_to_max(mlx90614_handle_t *handle, uint16_t value)
+{
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_TO_MAX, value);       /* write config */
+}
+
+/**
+ * @brief      get the to max
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get to max failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_to_max(mlx90614_handle_t *handle, uint16_t *value)
+{
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    
+    return a_mlx90614_read(handle, MLX90614_REG_EEPROM_TO_MAX, value);       /* read config */
+}
+
+/**
+ * @brief     set the to min
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] value set value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set to min failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      in thermal relay mode this cell holds the threshold
+ */
+uint8_t mlx90614_set_to_min(mlx90614_handle_t *handle, uint16_t value)
+{
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_TO_MIN, value);       /* write config */
+}
+
+/**
+ * @brief      get the to min
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get to min failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_to_min(mlx90614_handle_t *handle, uint16_t *value)
+{
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    
+    return a_mlx90614_read(handle, MLX90614_REG_EEPROM_TO_MIN, value);       /* read config */
+}
+
+/**
+ * @brief      convert the object temperature to the register raw data
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  celsius object temperature
+ * @param[out] *reg pointer to a register raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 to convert to register failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 celsius is out of range
+ * @note       the register is in 0.01 K, -273.15 <= celsius <= 382.20
+ */
+uint8_t mlx90614_to_convert_to_register(mlx90614_handle_t *handle, mlx90614_temperature_t celsius, uint16_t *reg)
+{
+    if (handle == NULL)                                                                                                                     /* check handle */
+    {
+        return 2;                                                                                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                                                                                /* check handle initialization */
+    {
+        return 3;                                                                                                                           /* return error */
+    }
+#ifdef MLX90614_FIXED_POINT
+    if ((celsius < -27315 * (MLX90614_FIXED_POINT / 100)) ||
+        (celsius > 38220 * (MLX90614_FIXED_POINT / 100)))                                                                                   /* check celsius */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_CELSIUS_OUT_OF_RANGE, 0);                                                               /* celsius is out of range */
+        
+        return 4;                                                                                                                           /* return error */
+    }
+    
+    *reg = (uint16_t)((celsius + 27315 * (MLX90614_FIXED_POINT / 100) + MLX90614_FIXED_POINT / 200) / (MLX90614_FIXED_POINT / 100));        /* set reg */
+#else
+    if ((celsius < -273.15f) || (celsius > 382.2f))                                                                                         /* check celsius */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_CELSIUS_OUT_OF_RANGE, 0);                                                               /* celsius is out of range */
+        
+        return 4;                                                                                                                           /* return error */
+    }
+    
+    *reg = (uint16_t)(round(((double)celsius + 273.15) * 100.0));                                                                           /* set reg */
+#endif
+    
+    return 0;                                                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to the object temperature
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *celsius pointer to an object temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 to convert to data failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_to_convert_to_data(mlx90614_handle_t *handle, uint16_t reg, mlx90614_temperature_t *celsius)
+{
+    if (handle == NULL)                               /* check handle */
+    {
+        return 2;                                     /* return error */
+    }
+    if (handle->inited != 1)                          /* check handle initialization */
+    {
+        return 3;                                     /* return error */
+    }
+    
+#ifdef MLX90614_FIXED_POINT
+    *celsius = (int32_t)reg * (MLX90614_FIXED_POINT / 100) - 27315 * (MLX90614_FIXED_POINT / 100);        /* convert reg */
+#else
+    *celsius = (float)reg * 0.01f - 273.15f;          /* convert reg */
+#endif
+    
+    return 0;                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the ta range
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] min ta min register raw data
+ * @param[in] max ta max register raw data
+ * @return    status code
+ *            - 0 success
+ *            - 1 set ta range failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      max is the high byte and min is the low byte
+ */
+uint8_t mlx90614_set_ta_range(mlx90614_handle_t *handle, uint8_t min, uint8_t max)
+{
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    
+    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_TA_RANGE,
+                            (uint16_t)(((uint16_t)max << 8) | min));           /* write config */
+}
+
+/**
+ * @brief      get the ta range
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *min pointer to a ta min register raw data buffer
+ * @param[out] *max pointer to a ta max register raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get ta range failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_ta_range(mlx90614_handle_t *handle, uint8_t *min, uint8_t *max)
+{
+    uint8_t res;
+    uint16_t prev;
+    
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    
+    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_TA_RANGE, &prev);        /* read config */
+    if (res != 0)                                                              /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_TA_RANGE_FAILED, 0);    /* read ta range failed */
+        
+        return 1;                                                              /* return error */
+    }
+    *max = (uint8_t)((prev >> 8) & 0xFF);                                      /* get max */
+    *min = (uint8_t)(prev & 0xFF);                                             /* get min */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      convert the ambient temperature to the ta range register raw data
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  celsius ambient temperature
+ * @param[out] *reg pointer to a register raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ta range convert to register failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 celsius is out of range
+ * @note       the register is in 0.64 degC from -38.2, -38.20 <= celsius <= 125.00
+ */
+uint8_t mlx90614_ta_range_convert_to_register(mlx90614_handle_t *handle, mlx90614_temperature_t celsius, uint8_t *reg)
+{
+    if (handle == NULL)                                                                                             /* check handle */
+    {
+        return 2;                                                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                                                        /* check handle initialization */
+    {
+        return 3;                                                                                                   /* return error */
+    }
+#ifdef MLX90614_FIXED_POINT
+    if ((celsius < -3820 * (MLX90614_FIXED_POINT / 100)) ||
+        (celsius > 12500 * (MLX90614_FIXED_POINT / 100)))                                                           /* check celsius */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_CELSIUS_OUT_OF_RANGE, 0);                                       /* celsius is out of range */
+        
+        return 4;                                                                                                   /* return error */
+    }
+    
+    *reg = (uint8_t)((celsius + 3852 * (MLX90614_FIXED_POINT / 100)) / (64 * (MLX90614_FIXED_POINT / 100)));        /* set reg */
+#else
+    if ((celsius < -38.2f) || (celsius > 125.0f))                                                                   /* check celsius */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_CELSIUS_OUT_OF_RANGE, 0);                                       /* celsius is out of range */
+        
+        return 4;                                                                                                   /* return error */
+    }
+    
+    *reg = (uint8_t)(round(((double)celsius + 38.2) / 0.64));                                                       /* set reg */
+#endif
+    
+    return 0;                                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      convert the ta range register raw data to the ambient temperature
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *celsius pointer to an ambient temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ta range convert to data failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_ta_range_convert_to_data(mlx90614_handle_t *handle, uint8_t reg, mlx90614_temperature_t *celsius)
+{
+    if (handle == NULL)                              /* check handle */
+    {
+        return 2;                                    /* return error */
+    }
+    if (handle->inited != 1)                         /* check handle initialization */
+    {
+        return 3;                                    /* return error */
+    }
+    
+#ifdef MLX90614_FIXED_POINT
+    *celsius = (int32_t)reg * (64 * (MLX90614_FIXED_POINT / 100)) - 3820 * (MLX90614_FIXED_POINT / 100);        /* convert reg */
+#else
+    *celsius = (float)reg * 0.64f - 38.2f;           /* convert reg */
+#endif
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief     set the pwm ctrl
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *ctrl pointer to a pwm ctrl structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set pwm ctrl failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 repetition is over 31
+ *            - 5 period is over 127
+ * @note      the pwm ctrl is loaded at power on
+ */
+uint8_t mlx90614_set_pwm_ctrl(mlx90614_handle_t *handle, const mlx90614_pwm_ctrl_t *ctrl)
+{
+    uint16_t prev;
+    
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    if (ctrl->repetition > 31)                                                 /* check repetition */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_REPETITION_OVER_31, 0);    /* repetition is over 31 */
+        
+        return 4;                                                              /* return error */
+    }
+    if (ctrl->period > 127)                                                    /* check period */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_PERIOD_OVER_127, 0);       /* period is over 127 */
+        
+        return 5;                                                              /* return error */
+    }
+    
+    prev = (uint16_t)(((uint16_t)ctrl->period << 9) |                          /* set period */
+                      ((uint16_t)ctrl->repetition << 4) |                      /* set repetition */
+                      ((uint16_t)(ctrl->output & 0x01) << 3) |                 /* set output */
+                      ((uint16_t)(ctrl->pin & 0x01) << 2) |                    /* set pin */
+                      ((uint16_t)(ctrl->enable & 0x01) << 1) |                 /* set enable */
+                      ((uint16_t)(ctrl->mode & 0x01) << 0));                   /* set mode */
+    
+    return a_mlx90614_write(handle, MLX90614_REG_EEPROM_PWM_CTRL, prev);       /* write config */
+}
+
+/**
+ * @brief      get the pwm ctrl
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *ctrl pointer to a pwm ctrl structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get pwm ctrl failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_pwm_ctrl(mlx90614_handle_t *handle, mlx90614_pwm_ctrl_t *ctrl)
+{
+    uint8_t res;
+    uint16_t prev;
+    
+    if (handle == NULL)                                                        /* check handle */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (handle->inited != 1)                                                   /* check handle initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    
+    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_PWM_CTRL, &prev);        /* read config */
+    if (res != 0)                                                              /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_PWM_CTRL_FAILED, 0);    /* read pwm ctrl failed */
+        
+        return 1;                                                              /* return error */
+    }
+    ctrl->mode = (mlx90614_pwm_mode_t)((prev >> 0) & 0x01);                    /* get mode */
+    ctrl->enable = (mlx90614_bool_t)((prev >> 1) & 0x01);                      /* get enable */
+    ctrl->pin = (mlx90614_pwm_pin_t)((prev >> 2) & 0x01);                      /* get pin */
+    ctrl->output = (mlx90614_pwm_output_t)((prev >> 3) & 0x01);                /* get output */
+    ctrl->repetition = (uint8_t)((prev >> 4) & 0x1F);                          /* get repetition */
+    ctrl->period = (uint8_t)((prev >> 9) & 0x7F);                              /* get period */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     configure the thermal relay mode
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] threshold object temperature threshold
+ * @param[in] hysteresis hysteresis below the threshold
+ * @param[in] pin pwm or sda pin type
+ * @return    status code
+ *            - 0 success
+ *            - 1 set thermal relay failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 threshold is out of range
+ *            - 5 hysteresis is out of range
+ * @note      the pin goes active when the object temperature rises over threshold and goes back
+ *            when it falls under threshold - hysteresis, the output follows the mode in config1
+ *            only the cells that differ are written, so the call does not wear the eeprom when repeated
+ *            the setting is loaded at power on and the chip must not be switched to smbus by the host
+ */
+uint8_t mlx90614_set_thermal_relay(mlx90614_handle_t *handle, mlx90614_temperature_t threshold,
+                                   mlx90614_temperature_t hysteresis, mlx90614_pwm_pin_t pin)
+{
+    uint8_t res;
+    uint16_t to_min;
+    uint16_t to_max;
+    uint16_t prev;
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    
+    res = mlx90614_to_convert_to_register(handle, threshold, &to_min);              /* convert threshold */
+    if (res != 0)                                                                   /* check result */
+    {
+        return 4;                                                                   /* return error */
+    }
+#ifdef MLX90614_FIXED_POINT
+    if ((hysteresis < 0) || (hysteresis > 65535 * (MLX90614_FIXED_POINT / 100)))    /* check hysteresis */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_HYSTERESIS_OUT_OF_RANGE, 0);    /* hysteresis is out of range */
+        
+        return 5;                                                                   /* return error */
+    }
+    to_max = (uint16_t)((hysteresis + MLX90614_FIXED_POINT / 200) / (MLX90614_FIXED_POINT / 100));        /* set to max */
+#else
+    if ((hysteresis < 0.0f) || (hysteresis > 655.35f))                              /* check hysteresis */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_HYSTERESIS_OUT_OF_RANGE, 0);    /* hysteresis is out of range */
+        
+        return 5;                                                                   /* return error */
+    }
+    to_max = (uint16_t)(round((double)hysteresis * 100.0));                         /* set to max */
+#endif
+    
+    res = a_mlx90614_read(handle, MLX90614_REG_EEPROM_PWM_CTRL, &prev);             /* read config */
+    if (res != 0)                                                                   /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_PWM_CTRL_FAILED, 0);         /* read pwm ctrl failed */
+        
+        return 1;                                                                   /* return error */
+    }
+    prev &= ~(0x07 << 1);                                                           /* clear enable, pin and output */
+    prev |= (uint16_t)(MLX90614_PWM_OUTPUT_THERMAL_RELAY << 3);                     /* set thermal relay */
+    prev |= (uint16_t)((pin & 0x01) << 2);                                          /* set pin */
+    prev |= (uint16_t)(MLX90614_BOOL_TRUE << 1);                                    /* set enable */
+    
+    res = a_mlx90614_update(handle, MLX90614_REG_EEPROM_TO_MIN, to_min);            /* update threshold */
+    if (res != 0)                                                                   /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_TO_MIN_FAILED, 0);          /* write to min failed */
+        
+        return 1;                                                                   /* return error */
+    }
+    res = a_mlx90614_update(handle, MLX90614_REG_EEPROM_TO_MAX, to_max);            /* update hysteresis */
+    if (res != 0)                                                                   /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_TO_MAX_FAILED, 0);          /* write to max failed */
+        
+        return 1;                                                                   /* return error */
+    }
+    res = a_mlx90614_update(handle, MLX90614_REG_EEPROM_PWM_CTRL, prev);            /* update pwm ctrl */
+    if (res != 0)                                                                   /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_PWM_CTRL_FAILED, 0);        /* write pwm ctrl failed */
+        
+        return 1;                                                                   /* return error */
+    }
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief register field descriptor structure definition
+ */
+typedef struct mlx90614_field_desc_s
+{
+    uint8_t reg;          /**< register command */
+    uint8_t shift;        /**< lowest bit */
+    uint8_t width;        /**< bit number */
+    uint8_t flags;        /**< field flags */
+} mlx90614_field_desc_t;
+
+/**
+ * @brief register field flag definition
+ */
+#define MLX90614_FIELD_FLAG_WRITABLE        (1 << 0)        /**< field can be written */
+
+/**
+ * @brief register field descriptor table, indexed by mlx90614_field_t
+ */
+static const mlx90614_field_desc_t gs_field[MLX90614_FIELD_MAX] =
+{
+    {MLX90614_REG_EEPROM_CONFIG1,    0,  3, MLX90614_FIELD_FLAG_WRITABLE},        /* iir */
+    {MLX90614_REG_EEPROM_CONFIG1,    3,  1, MLX90614_FIELD_FLAG_WRITABLE},        /* repeat sensor test */
+    {MLX90614_REG_EEPROM_CONFIG1,    4,  2, MLX90614_FIELD_FLAG_WRITABLE},        /* mode */
+    {MLX90614_REG_EEPROM_CONFIG1,    6,  1, MLX90614_FIELD_FLAG_WRITABLE},        /* ir sensor */
+    {MLX90614_REG_EEPROM_CONFIG1,    7,  1, MLX90614_FIELD_FLAG_WRITABLE},        /* ks */
+    {MLX90614_REG_EEPROM_CONFIG1,    8,  3, MLX90614_FIELD_FLAG_WRITABLE},        /* fir length */
+    {MLX90614_REG_EEPROM_CONFIG1,    11, 3, MLX90614_FIELD_FLAG_WRITABLE},        /* gain */
+    {MLX90614_REG_EEPROM_CONFIG1,    14, 1, MLX90614_FIELD_FLAG_WRITABLE},        /* kt2 */
+    {MLX90614_REG_EEPROM_CONFIG1,    15, 1, MLX90614_FIELD_FLAG_WRITABLE},        /* sensor test */
+    {MLX90614_REG_EEPROM_PWM_CTRL,   0,  1, MLX90614_FIELD_FLAG_WRITABLE},        /* pwm mode */
+    {MLX90614_REG_EEPROM_PWM_CTRL,   1,  1, MLX90614_FIELD_FLAG_WRITABLE},        /* pwm enable */
+    {MLX90614_REG_EEPROM_PWM_CTRL,   2,  1, MLX90614_FIELD_FLAG_WRITABLE},        /* pwm pin */
+    {MLX90614_REG_EEPROM_PWM_CTRL,   3,  1, MLX90614_FIELD_FLAG_WRITABLE},        /* pwm output */
+    {MLX90614_REG_EEPROM_PWM_CTRL,   4,  5, MLX90614_FIELD_FLAG_WRITABLE},        /* pwm repetition */
+    {MLX90614_REG_EEPROM_PWM_CTRL,   9,  7, MLX90614_FIELD_FLAG_WRITABLE},        /* pwm period */
+    {MLX90614_REG_EEPROM_TA_RANGE,   0,  8, MLX90614_FIELD_FLAG_WRITABLE},        /* ta min */
+    {MLX90614_REG_EEPROM_TA_RANGE,   8,  8, MLX90614_FIELD_FLAG_WRITABLE},        /* ta max */
+    {MLX90614_REG_EEPROM_ID1_NUMBER, 0, 16, 0},                                   /* id1 */
+    {MLX90614_REG_EEPROM_ID2_NUMBER, 0, 16, 0},                                   /* id2 */
+    {MLX90614_REG_EEPROM_ID3_NUMBER, 0, 16, 0},                                   /* id3 */
+    {MLX90614_REG_EEPROM_ID4_NUMBER, 0, 16, 0},                                   /* id4 */
+};
+
+/**
+ * @brief     get the mask of a field
+ * @param[in] *desc pointer to a field descriptor
+ * @return    mask in the field position
+ * @note      none
+ */
+static uint16_t a_mlx90614_field_mask(const mlx90614_field_desc_t *desc)
+{
+    return (uint16_t)(((1UL << desc->width) - 1) << desc->shift);        /* make the mask */
+}
+
+/**
+ * @brief      get many register fields
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  *field pointer to a register field buffer
+ * @param[out] *value pointer to a field value buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 get fields failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 field is invalid
+ * @note       every register is read once
+ */
+uint8_t mlx90614_get_fields(mlx90614_handle_t *handle, const mlx90614_field_t *field, uint16_t *value, uint8_t len)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t reg;
+    uint16_t data;
+    uint32_t done;
+    const mlx90614_field_desc_t *desc;
+    
+    if (handle == NULL)                                                              /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    if ((field == NULL) || (value == NULL) || (len > 32))                            /* check the params */
+    {
+        return 1;                                                                    /* return error */
+    }
+    for (i = 0; i < len; i++)                                                        /* check all fields */
+    {
+        if ((uint32_t)field[i] >= MLX90614_FIELD_MAX)                                /* check the field */
+        {
+            MLX90614_LOG_WARNING(handle, MLX90614_EVENT_FIELD_INVALID, 0);           /* field is invalid */
+            
+            return 4;                                                                /* return error */
+        }
+    }
+    
+    done = 0;                                                                        /* no field yet */
+    for (i = 0; i < len; i++)                                                        /* all fields */
+    {
+        if ((done & (1UL << i)) != 0)                                                /* check the field */
+        {
+            continue;                                                                /* read with an earlier field */
+        }
+        reg = gs_field[field[i]].reg;                                                /* get the register */
+        if (a_mlx90614_read(handle, reg, &data) != 0)                                /* read the register once */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_FIELD_FAILED, reg);       /* read field failed */
+            
+            return 1;                                                                /* return error */
+        }
+        for (j = i; j < len; j++)                                                    /* fields of this register */
+        {
+            desc = &gs_field[field[j]];                                              /* get the descriptor */
+            if (desc->reg == reg)                                                    /* check the register */
+            {
+                value[j] = (uint16_t)((data & a_mlx90614_field_mask(desc)) >>
+                                      desc->shift);                                  /* get the value */
+                done |= 1UL << j;                                                    /* mark the field */
+            }
+        }
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     set many register fields
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *field pointer to a register field buffer
+ * @param[in] *value pointer to a field value buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set fields failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field is invalid
+ *            - 5 value is over the field width
+ *            - 6 field is read only
+ * @note      all fields are checked before the bus is touched, every register is read once and
+ *            written once if any of its fields changes, so n config1 fields cost one eeprom cycle
+ */
+uint8_t mlx90614_set_fields(mlx90614_handle_t *handle, const mlx90614_field_t *field, const uint16_t *value, uint8_t len)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t reg;
+    uint16_t prev;
+    uint16_t data;
+    uint32_t done;
+    const mlx90614_field_desc_t *desc;
+    
+    if (handle == NULL)                                                              /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    if ((field == NULL) || (value == NULL) || (len > 32))                            /* check the params */
+    {
+        return 1;                                                                    /* return error */
+    }
+    for (i = 0; i < len; i++)                                                        /* check all fields */
+    {
+        if ((uint32_t)field[i] >= MLX90614_FIELD_MAX)                                /* check the field */
+        {
+            MLX90614_LOG_WARNING(handle, MLX90614_EVENT_FIELD_INVALID, 0);           /* field is invalid */
+            
+            return 4;                                                                /* return error */
+        }
+        desc = &gs_field[field[i]];                                                  /* get the descriptor */
+        if ((value[i] >> desc->width) != 0)                                          /* check the value */
+        {
+            MLX90614_LOG_WARNING(handle, MLX90614_EVENT_FIELD_VALUE_TOO_WIDE, 0);    /* value is over the field width */
+            
+            return 5;                                                                /* return error */
+        }
+        if ((desc->flags & MLX90614_FIELD_FLAG_WRITABLE) == 0)                       /* check the flags */
+        {
+            MLX90614_LOG_WARNING(handle, MLX90614_EVENT_FIELD_READ_ONLY, 0);         /* field is read only */
+            
+            return 6;                                                                /* return error */
+        }
+    }
+    
+    done = 0;                                                                        /* no field yet */
+    for (i = 0; i < len; i++)                                                        /* all fields */
+    {
+        if ((done & (1UL << i)) != 0)                                                /* check the field */
+        {
+            continue;                                                                /* written with an earlier field */
+        }
+        reg = gs_field[field[i]].reg;                                                /* get the register */
+        if (a_mlx90614_read(handle, reg, &prev) != 0)                                /* read the register once */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_FIELD_FAILED, reg);       /* read field failed */
+            
+            return 1;                                                                /* return error */
+        }
+        data = prev;                                                                 /* copy the register */
+        for (j = i; j < len; j++)                                                    /* fields of this register */
+        {
+            desc = &gs_field[field[j]];                                              /* get the descriptor */
+            if (desc->reg == reg)                                                    /* check the register */
+            {
+                data &= (uint16_t)~a_mlx90614_field_mask(desc);                      /* clear the field */
+                data |= (uint16_t)(value[j] << desc->shift);                         /* set the field */
+                done |= 1UL << j;                                                    /* mark the field */
+            }
+        }
+        if (data == prev)                                                            /* check the register */
+        {
+            continue;                                                                /* nothing to write */
+        }
+        if (a_mlx90614_write(handle, reg, data) != 0)                                /* write the register once */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_FIELD_FAILED, reg);      /* write field failed */
+            
+            return 1;                                                                /* return error */
+        }
+    }
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief      get a register field
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  field register field
+ * @param[out] *value pointer to a field value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get field failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 field is invalid
+ * @note       none
+ */
+uint8_t mlx90614_get_field(mlx90614_handle_t *handle, mlx90614_field_t field, uint16_t *value)
+{
+    return mlx90614_get_fields(handle, &field, value, 1);                            /* get one field */
+}
+
+/**
+ * @brief     set a register field
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] field register field
+ * @param[in] value field value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set field failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field is invalid
+ *            - 5 value is over the field width
+ *            - 6 field is read only
+ * @note      the eeprom cell is only written if the field changes
+ */
+uint8_t mlx90614_set_field(mlx90614_handle_t *handle, mlx90614_field_t field, uint16_t value)
+{
+    return mlx90614_set_fields(handle, &field, &value, 1);                           /* set one field */
+}
+
+/**
+ * @brief iir settling frames definition
+ */
+static const uint8_t gs_iir_frames[8] =
+{
+    7, 17, 26, 35, 1, 3, 5, 6,        /* conversions until (1 - a1) ^ n < 1 % */
+};
+
+/**
+ * @brief      get the settling model of a filter setting
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  len fir length
+ * @param[in]  iir iir param
+ * @param[out] *frames pointer to a frames buffer
+ * @param[out] *ms pointer to a settling time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 settling model failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one conversion is modelled as MLX90614_WAKE_SETTLE_MS at fir length 1024 and half of it
+ *             for each shorter fir length, frames is the number of conversions the iir needs to come
+ *             within 1 % of a step, ms is frames times the conversion time
+ */
+uint8_t mlx90614_settling_model(mlx90614_handle_t *handle, mlx90614_fir_length_t len, mlx90614_iir_t iir,
+                                uint8_t *frames, uint32_t *ms)
+{
+    uint32_t frame_ms;
+    
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    if (((uint32_t)len > MLX90614_FIR_LENGTH_1024) || ((uint32_t)iir > MLX90614_IIR_A1_0P571_B1_0P428))        /* check the params */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_PARAM_INVALID, 0);                /* param is invalid */
+        
+        return 1;                                                                     /* return error */
+    }
+    
+    frame_ms = MLX90614_WAKE_SETTLE_MS >> (MLX90614_FIR_LENGTH_1024 - len);           /* get the conversion time */
+    if (frame_ms == 0)                                                                /* check the conversion time */
+    {
+        frame_ms = 1;                                                                 /* at least 1 ms */
+    }
+    *frames = gs_iir_frames[iir];                                                     /* get the frames */
+    *ms = frame_ms * (*frames);                                                       /* get the settling time */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      wait until the chip reports fresh data
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  frames number of fresh conversions to wait for, 0 means any valid data
+ * @param[in]  timeout_ms timeout in ms
+ * @param[out] *elapsed_ms pointer to an elapsed time buffer, NULL means unused
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timeout
+ * @note       data is valid when the init flag is done and the object register holds a value without
+ *             the error flag, a conversion is fresh when the raw ir channel 1 changes or the object
+ *             register turns valid after it was cleared, the chip is polled every MLX90614_READY_POLL_MS
+ *             and a nack or pec error while it is waking up is taken as not ready, the timeout and the
+ *             elapsed time are measured with get_time_ms when it is linked, else they only count the
+ *             poll delays and leave out the bus time of the reads
+ */
+uint8_t mlx90614_wait_ready(mlx90614_handle_t *handle, uint8_t frames, uint32_t timeout_ms, uint32_t *elapsed_ms)
+{
+    uint8_t fresh;
+    uint8_t cleared;
+    uint8_t based;
+    uint16_t flag;
+    uint16_t object;
+    uint16_t ir;
+    uint16_t base;
+    uint32_t elapsed;
+    uint32_t start;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    
+    fresh = 0;                                                                           /* no fresh conversion */
+    cleared = 0;                                                                         /* no cleared register */
+    based = 0;                                                                           /* no base */
+    base = 0;                                                                            /* init 0 */
+    elapsed = 0;                                                                         /* init 0 */
+    start = 0;                                                                           /* init 0 */
+    if (handle->get_time_ms != NULL)                                                     /* check the clock */
+    {
+        start = handle->get_time_ms();                                                   /* save the start */
+    }
+    while (1)
+    {
+        flag = 0;                                                                        /* init 0 */
+        if (mlx90614_get_flag(handle, &flag) == 0)                                       /* read the flag */
+        {
+            if ((flag & MLX90614_FLAG_INIT) == 0)                                        /* init is ongoing */
+            {
+                cleared = 1;                                                             /* the data is not valid yet */
+            }
+            else if (a_mlx90614_read(handle, MLX90614_REG_RAM_TOBJ1, &object) == 0)      /* read the object */
+            {
+                if ((object == 0) || ((object & 0x8000U) != 0))                          /* not measured */
+                {
+                    cleared = 1;                                                         /* the data is not valid yet */
+                }
+                else if (frames == 0)                                                    /* any valid data */
+                {
+                    break;                                                               /* ready */
+                }
+                else if (a_mlx90614_read(handle, MLX90614_REG_RAM_RAW_DATA_IR_CHANNEL_1, &ir) == 0)        /* read the ir channel */
+                {
+                    if (based == 0)                                                      /* first valid data */
+                    {
+                        fresh = (uint8_t)(fresh + cleared);                              /* valid after cleared is fresh */
+                        based = 1;                                                       /* save the base */
+                        base = ir;                                                       /* set the base */
+                    }
+                    else if (ir != base)                                                 /* a new conversion */
+                    {
+                        fresh++;                                                         /* count it */
+                        base = ir;                                                       /* set the base */
+                    }
+                    else
+                    {
+                        /* the same conversion */
+                    }
+                    if (fresh >= frames)                                                 /* check the frames */
+                    {
+                        break;                                                           /* ready */
+                    }
+                }
+                else
+                {
+                    /* the chip is not ready to talk */
+                }
+            }
+            else
+            {
+                /* the chip is not ready to talk */
+            }
+        }
+        if (handle->get_time_ms != NULL)                                                 /* check the clock */
+        {
+            elapsed = handle->get_time_ms() - start;                                     /* measure the time */
+        }
+        if (elapsed >= timeout_ms)                                                       /* check the timeout */
+        {
+            if (elapsed_ms != NULL)                                                      /* check the buffer */
+            {
+                *elapsed_ms = elapsed;                                                   /* save the elapsed time */
+            }
+            
+            return 4;                                                                    /* return timeout */
+        }
+        handle->delay_ms(MLX90614_READY_POLL_MS);                                        /* wait one step */
+        elapsed += MLX90614_READY_POLL_MS;                                               /* count the step */
+    }
+    if (handle->get_time_ms != NULL)                                                     /* check the clock */
+    {
+        elapsed = handle->get_time_ms() - start;                                         /* measure the time */
+    }
+    if (elapsed_ms != NULL)                                                              /* check the buffer */
+    {
+        *elapsed_ms = elapsed;                                                           /* save the elapsed time */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      probe the chip with one read
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *valid pointer to a valid data flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 probe failed
+ * @note       a nack or a pec error means the chip doesn't answer on smbus
+ */
+static uint8_t a_mlx90614_probe(mlx90614_handle_t *handle, uint8_t *valid)
+{
+    uint16_t raw;
+    
+    if (a_mlx90614_read(handle, MLX90614_REG_RAM_TOBJ1, &raw) != 0)                    /* one pec checked read */
+    {
+        return 1;                                                                      /* return error */
+    }
+    *valid = (uint8_t)((raw != 0) && ((raw & 0x8000U) == 0));                          /* check the data */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      make sure the chip is awake and in smbus mode
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *path pointer to a start path buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       probes with one pec checked tobj1 read first, only a failed probe runs mlx90614_pwm_to_smbus
+ *             and probes again, and only a second failure runs mlx90614_exit_sleep_mode,
+ *             valid data is ready when it returns
+ */
+uint8_t mlx90614_start(mlx90614_handle_t *handle, mlx90614_start_path_t *path)
+{
+    uint8_t res;
+    uint8_t valid;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    
+    valid = 0;                                                                           /* init 0 */
+    *path = MLX90614_START_PATH_FAST;                                                    /* set fast */
+    if (a_mlx90614_probe(handle, &valid) != 0)                                           /* probe the chip */
+    {
+        res = mlx90614_pwm_to_smbus(handle);                                             /* pwm to smbus */
+        if (res != 0)                                                                    /* check result */
+        {
+            return 1;                                                                    /* return error */
+        }
+        *path = MLX90614_START_PATH_SMBUS;                                               /* set smbus */
+        if (a_mlx90614_probe(handle, &valid) != 0)                                       /* probe again */
+        {
+            res = mlx90614_exit_sleep_mode(handle);                                      /* exit sleep mode */
+            if (res != 0)                                                                /* check result */
+            {
+                MLX90614_LOG_ERROR(handle, MLX90614_EVENT_EXIT_SLEEP_MODE_FAILED, 0);    /* exit sleep mode failed */
+                
+                return 1;                                                                /* return error */
+            }
+            *path = MLX90614_START_PATH_WAKE;                                            /* set wake */
+            
+            return 0;                                                                    /* data is fresh after the wake */
+        }
+    }
+    if (valid == 0)                                                                      /* no data yet after power on */
+    {
+        res = mlx90614_wait_ready(handle, 0, MLX90614_READY_TIMEOUT_MS, NULL);           /* wait for valid data */
+        if (res != 0)                                                                    /* check result */
+        {
+            MLX90614_LOG_WARNING(handle, MLX90614_EVENT_WAIT_READY_TIMEOUT, 0);          /* wait ready timeout */
+            
+            return 1;                                                                    /* return error */
+        }
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     exit from sleep mode
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 exit sleep mode failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      returns as soon as the first fresh data is ready, at most MLX90614_READY_TIMEOUT_MS
+ */
+uint8_t mlx90614_exit_sleep_mode(mlx90614_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                           /* check handle */
+    {
+         return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+         return 3;                                                                /* return error */
+    }
+    
+    res = handle->scl_write(1);                                                   /* write scl 1 */
+    if (res != 0)                                                                 /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SCL_FAILED, 0);           /* write scl failed */
+        
+        return 1;                                                                 /* return error */
+    }
+    res = handle->sda_write(1);                                                   /* write sda 1 */
+    if (res != 0)                                                                 /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SDA_FAILED, 0);           /* write sda failed */
+        
+        return 1;                                                                 /* return error */
+    }
+    handle->delay_ms(1);                                                          /* delay 1 ms */
+    res = handle->sda_write(0);                                                   /* write sda 0 */
+    if (res != 0)                                                                 /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SDA_FAILED, 0);           /* write sda failed */
+        
+        return 1;                                                                 /* return error */
+    }    
+    handle->delay_ms(MLX90614_WAKE_PULSE_MS);                                     /* delay 50 ms */
+    res = handle->sda_write(1);                                                   /* write sda 1 */
+    if (res != 0)                                                                 /* return error */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SDA_FAILED, 0);           /* write sda failed */
+        
+        return 1;                                                                 /* return error */
+    }
+    res = mlx90614_wait_ready(handle, 1, MLX90614_READY_TIMEOUT_MS, NULL);        /* wait for the first fresh data */
+    if (res != 0)                                                                 /* check result */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_WAIT_READY_TIMEOUT, 0);       /* wait ready timeout */
+        
+        return 1;                                                                 /* return error */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     start the exit from sleep mode request
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 exit sleep mode start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      sda is left low, call mlx90614_exit_sleep_mode_stop after MLX90614_WAKE_PULSE_MS
+ *            and wait for the first valid data with mlx90614_wait_ready
+ */
+uint8_t mlx90614_exit_sleep_mode_start(mlx90614_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+         return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+         return 3;                                                         /* return error */
+    }
+    
+    res = handle->scl_write(1);                                            /* write scl 1 */
+    if (res != 0)                                                          /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SCL_FAILED, 0);    /* write scl failed */
+        
+        return 1;                                                          /* return error */
+    }
+    res = handle->sda_write(1);                                            /* write sda 1 */
+    if (res != 0)                                                          /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SDA_FAILED, 0);    /* write sda failed */
+        
+        return 1;                                                          /* return error */
+    }
+    res = handle->sda_write(0);                                            /* write sda 0 */
+    if (res != 0)                                                          /* check result */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SDA_FAILED, 0);    /* write sda failed */
+        
+        return 1;                                                          /* return error */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     stop the exit from sleep mode request
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 exit sleep mode stop failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mlx90614_exit_sleep_mode_stop(mlx90614_handle_t *handle)
+{
+    if (handle == NULL)                                                    /* check handle */
+    {
+         return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+         return 3;                                                         /* return error */
+    }
+    
+    if (handle->sda_write(1) != 0)                                         /* write sda 1 */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_SDA_FAILED, 0);    /* write sda failed */
+        
+        return 1;                                                          /* return error */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief     erase an eeprom cell without waiting
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] reg eeprom register address
+ * @return    status code
+ *            - 0 success
+ *            - 1 eeprom erase failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 reg is not an eeprom register
+ *            - 5 eeprom write budget is exceeded
+ * @note      the cell is busy for MLX90614_EEPROM_WRITE_MS after this call,
+ *            the erase counts as the write of the cell against the budget
+ */
+uint8_t mlx90614_eeprom_erase(mlx90614_handle_t *handle, uint8_t reg)
+{
+    if (handle == NULL)                                                              /* check handle */
+    {
+        return 2;                                                                    /* return error */
+    }
+    if (handle->inited != 1)                                                         /* check handle initialization */
+    {
+        return 3;                                                                    /* return error */
+    }
+    if ((reg & 0xE0) != 0x20)                                                        /* check reg */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_REG_NOT_EEPROM, reg);            /* reg is not eeprom */
+        
+        return 4;                                                                    /* return error */
+    }
+    if (a_mlx90614_eeprom_admit(handle) == 0)                                        /* check the budget */
+    {
+        handle->eeprom_rejected++;                                                   /* count the rejected write */
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_EEPROM_BUDGET_EXCEEDED, reg);    /* eeprom budget is exceeded */
+        
+        return 5;                                                                    /* return error */
+    }
+    
+    a_mlx90614_eeprom_count(handle, reg);                                            /* count the write */
+    if (a_mlx90614_write_word(handle, reg, 0x0000) != 0)                             /* erase the cell */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_ERASE_EEPROM_FAILED, reg);         /* erase eeprom failed */
+        
+        return 1;                                                                    /* return error */
+    }
+    
+    return 0;                                                                        /* success return 0 */
 }
 
 /**
- * @brief      get the flag
+ * @brief     program an erased eeprom cell without waiting
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] reg eeprom register address
+ * @param[in] data written data
+ * @return    status code
+ *            - 0 success
+ *            - 1 eeprom program failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 reg is not an eeprom register
+ * @note      the cell must be erased by mlx90614_eeprom_erase at least MLX90614_EEPROM_WRITE_MS before
+ *            and is busy for MLX90614_EEPROM_WRITE_MS after this call
+ */
+uint8_t mlx90614_eeprom_program(mlx90614_handle_t *handle, uint8_t reg, uint16_t data)
+{
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    if ((reg & 0xE0) != 0x20)                                                     /* check reg */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_REG_NOT_EEPROM, reg);         /* reg is not eeprom */
+        
+        return 4;                                                                 /* return error */
+    }
+    
+    if (a_mlx90614_write_word(handle, reg, data) != 0)                            /* write data */
+    {
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_PROGRAM_EEPROM_FAILED, reg);    /* program eeprom failed */
+        
+        return 1;                                                                 /* return error */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     calculate the pec of a word read
+ * @param[in] addr iic device address
+ * @param[in] command read command
+ * @param[in] data read data
+ * @return    pec
+ * @note      none
+ */
+static uint8_t a_mlx90614_read_pec(uint8_t addr, uint8_t command, uint16_t data)
+{
+    uint8_t arr[5];
+    
+    arr[0] = addr;                                           /* set read addr */
+    arr[1] = command;                                        /* set command */
+    arr[2] = addr + 1;                                       /* set write addr */
+    arr[3] = (uint8_t)(data & 0xFF);                         /* set data lsb */
+    arr[4] = (uint8_t)(data >> 8);                           /* set data msb */
+    
+    return a_mlx90614_calculate_crc((uint8_t *)arr, 5);      /* calculate pec */
+}
+
+/**
+ * @brief      dump the whole eeprom
  * @param[in]  *handle pointer to an mlx90614 handle structure
- * @param[out] *flag pointer to a flag buffer
+ * @param[out] *image pointer to an eeprom image structure
  * @return     status code
  *             - 0 success
- *             - 1 get flag failed
+ *             - 1 eeprom dump failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       32 pec checked reads, the pec of every read is kept in the image, a coalesced cell
+ *             is dumped as programmed in the chip and not as its pending value
  */
-uint8_t mlx90614_get_flag(mlx90614_handle_t *handle, uint16_t *flag)
+uint8_t mlx90614_eeprom_dump(mlx90614_handle_t *handle, mlx90614_eeprom_image_t *image)
 {
-    if (handle == NULL)                                                                       /* check handle */
+    uint8_t i;
+    uint8_t command;
+    
+    if (handle == NULL)                                                                         /* check handle */
     {
-         return 2;                                                                            /* return error */
+        return 2;                                                                               /* return error */
     }
-    if (handle->inited != 1)                                                                  /* check handle initialization */
+    if (handle->inited != 1)                                                                    /* check handle initialization */
     {
-         return 3;                                                                            /* return error */
+        return 3;                                                                               /* return error */
     }
-    
-    if (handle->iic_read(handle->iic_addr, COMMAND_READ_FLAGS, (uint8_t *)flag, 1) != 0)      /* read config */
+    if (image == NULL)                                                                          /* check image */
     {
-        return 1;                                                                             /* return error */
+        return 1;                                                                               /* return error */
     }
-    else
+    
+    memset(image, 0, sizeof(mlx90614_eeprom_image_t));                                          /* clear the image */
+    image->magic = MLX90614_EEPROM_IMAGE_MAGIC;                                                 /* set the magic */
+    image->version = MLX90614_EEPROM_IMAGE_VERSION;                                             /* set the version */
+    image->addr = handle->iic_addr;                                                             /* set the address */
+    for (i = 0; i < MLX90614_EEPROM_SIZE; i++)                                                  /* all cells */
     {
-        return 0;                                                                             /* success return 0 */
+        command = (uint8_t)(MLX90614_EEPROM_BASE + i);                                          /* set the command */
+        if (a_mlx90614_read_bus(handle, command, &image->word[i]) != 0)                         /* read the chip cell */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_EEPROM_FAILED, command);             /* read eeprom failed */
+            
+            return 1;                                                                           /* return error */
+        }
+        image->pec[i] = a_mlx90614_read_pec(handle->iic_addr, command, image->word[i]);         /* keep the checked pec */
     }
+    image->id = ((uint64_t)image->word[MLX90614_REG_EEPROM_ID4_NUMBER - MLX90614_EEPROM_BASE] << 48) |
+                ((uint64_t)image->word[MLX90614_REG_EEPROM_ID3_NUMBER - MLX90614_EEPROM_BASE] << 32) |
+                ((uint64_t)image->word[MLX90614_REG_EEPROM_ID2_NUMBER - MLX90614_EEPROM_BASE] << 16) |
+                (uint64_t)image->word[MLX90614_REG_EEPROM_ID1_NUMBER - MLX90614_EEPROM_BASE];     /* set the id */
+    
+    return 0;                                                                                   /* success return 0 */
 }
 
 /**
- * @brief     enter to sleep mode
- * @param[in] *handle pointer to an mlx90614 handle structure
+ * @brief     check an eeprom image
+ * @param[in] *image pointer to an eeprom image structure
  * @return    status code
  *            - 0 success
- *            - 1 enter sleep mode failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
+ *            - 1 check failed
+ *            - 4 magic or version is invalid
+ *            - 5 pec is invalid
+ *            - 6 id doesn't match the id cells
  * @note      none
  */
-uint8_t mlx90614_enter_sleep_mode(mlx90614_handle_t *handle)
+uint8_t mlx90614_eeprom_image_check(const mlx90614_eeprom_image_t *image)
 {
-    uint8_t crc;
-    uint8_t buf[2];
+    uint8_t i;
+    uint64_t id;
     
-    if (handle == NULL)                                                                         /* check handle */
+    if (image == NULL)                                                                          /* check image */
     {
-         return 2;                                                                              /* return error */
+        return 1;                                                                               /* return error */
     }
-    if (handle->inited != 1)                                                                    /* check handle initialization */
+    if ((image->magic != MLX90614_EEPROM_IMAGE_MAGIC) ||
+        (image->version != MLX90614_EEPROM_IMAGE_VERSION))                                      /* check the format */
     {
-         return 3;                                                                              /* return error */
+        return 4;                                                                               /* return error */
     }
     
-    buf[0] = handle->iic_addr;                                                                  /* set iic address */
-    buf[1] = COMMAND_ENTER_SLEEP;                                                               /* set command */
-    crc = a_mlx90614_calculate_crc((uint8_t *)buf, 2);                                          /* set crc */
+    for (i = 0; i < MLX90614_EEPROM_SIZE; i++)                                                  /* all cells */
+    {
+        if (image->pec[i] != a_mlx90614_read_pec(image->addr, (uint8_t)(MLX90614_EEPROM_BASE + i),
+                                                 image->word[i]))                               /* check the pec */
+        {
+            return 5;                                                                           /* return error */
+        }
+    }
+    id = ((uint64_t)image->word[MLX90614_REG_EEPROM_ID4_NUMBER - MLX90614_EEPROM_BASE] << 48) |
+         ((uint64_t)image->word[MLX90614_REG_EEPROM_ID3_NUMBER - MLX90614_EEPROM_BASE] << 32) |
+         ((uint64_t)image->word[MLX90614_REG_EEPROM_ID2_NUMBER - MLX90614_EEPROM_BASE] << 16) |
+         (uint64_t)image->word[MLX90614_REG_EEPROM_ID1_NUMBER - MLX90614_EEPROM_BASE];            /* get the id */
+    if (id != image->id)                                                                        /* check the id */
+    {
+        return 6;                                                                               /* return error */
+    }
     
-    if (handle->iic_write(handle->iic_addr, COMMAND_ENTER_SLEEP, (uint8_t *)&crc, 1) != 0)      /* write config */
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      restore an eeprom image with the fewest writes
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  *image pointer to an eeprom image structure
+ * @param[in]  mask cells to restore, MLX90614_EEPROM_CELL bits
+ * @param[out] *written pointer to a written cell number buffer, NULL is allowed
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom restore failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 image is invalid
+ *             - 5 mask has factory cells
+ *             - 6 read back verify failed
+ * @note       only the cells that differ from the live eeprom are erased and written and every written cell
+ *             is read back, factory calibration and id cells are refused, the address cell only takes the
+ *             low byte and the new address is used after the next power on, the writes are never
+ *             coalesced, a write beyond the budget fails and a restored cell drops its pending value
+ */
+uint8_t mlx90614_eeprom_restore(mlx90614_handle_t *handle, const mlx90614_eeprom_image_t *image,
+                                uint32_t mask, uint8_t *written)
+{
+    uint8_t i;
+    uint8_t command;
+    uint8_t count;
+    uint16_t live;
+    uint16_t data;
+    
+    if (handle == NULL)                                                                         /* check handle */
     {
-        return 1;                                                                               /* return error */
+        return 2;                                                                               /* return error */
     }
-    else
+    if (handle->inited != 1)                                                                    /* check handle initialization */
     {
-        return 0;                                                                               /* success return 0 */
+        return 3;                                                                               /* return error */
+    }
+    if (written != NULL)                                                                        /* check written */
+    {
+        *written = 0;                                                                           /* nothing written yet */
+    }
+    if (mlx90614_eeprom_image_check(image) != 0)                                                /* check the image */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_EEPROM_IMAGE_INVALID, 0);                   /* eeprom image is invalid */
+        
+        return 4;                                                                               /* return error */
+    }
+    if ((mask & ~MLX90614_EEPROM_WRITABLE_MASK) != 0)                                           /* check the mask */
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_EEPROM_MASK_FACTORY, 0);                    /* mask has factory cells */
+        
+        return 5;                                                                               /* return error */
+    }
+    
+    count = 0;                                                                                  /* init 0 */
+    for (i = 0; i < MLX90614_EEPROM_SIZE; i++)                                                  /* all cells */
+    {
+        if ((mask & (1UL << i)) == 0)                                                           /* check the mask */
+        {
+            continue;                                                                           /* skip the cell */
+        }
+        command = (uint8_t)(MLX90614_EEPROM_BASE + i);                                          /* set the command */
+        if (a_mlx90614_read_bus(handle, command, &live) != 0)                                   /* read the chip cell */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_READ_EEPROM_FAILED, command);             /* read eeprom failed */
+            
+            return 1;                                                                           /* return error */
+        }
+        data = image->word[i];                                                                  /* set the data */
+        if (command == MLX90614_REG_EEPROM_ADDRESS)                                             /* address cell */
+        {
+            data = (uint16_t)((live & 0xFF00U) | (data & 0x00FFU));                             /* keep the factory msb */
+        }
+        if (live == data)                                                                       /* check the cell */
+        {
+            handle->eeprom_pending &= ~(1UL << i);                                              /* drop a pending value */
+            
+            continue;                                                                           /* nothing to write */
+        }
+        if (a_mlx90614_eeprom_admit(handle) == 0)                                               /* check the budget */
+        {
+            handle->eeprom_rejected++;                                                          /* count the rejected write */
+            MLX90614_LOG_WARNING(handle, MLX90614_EVENT_EEPROM_BUDGET_EXCEEDED, command);       /* eeprom budget is exceeded */
+            
+            return 1;                                                                           /* return error */
+        }
+        if (a_mlx90614_eeprom_cycle(handle, command, data) != 0)                                /* erase and write */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_WRITE_EEPROM_FAILED, command);            /* write eeprom failed */
+            
+            return 1;                                                                           /* return error */
+        }
+        count++;                                                                                /* count the write */
+        if (written != NULL)                                                                    /* check written */
+        {
+            *written = count;                                                                   /* set written */
+        }
+        if ((a_mlx90614_read_bus(handle, command, &live) != 0) || (live != data))               /* read back the chip */
+        {
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_VERIFY_EEPROM_FAILED, command);           /* verify eeprom failed */
+            
+            return 6;                                                                           /* return error */
+        }
     }
+    
+    return 0;                                                                                   /* success return 0 */
 }
 
 /**
- * @brief     change pwm mode to smbus mode
+ * @brief     set the eeprom write budget
  * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] writes eeprom writes allowed in one window, 0 means no limit
+ * @param[in] window_ms budget window in ms
+ * @param[in] policy what to do with the writes beyond the budget
  * @return    status code
  *            - 0 success
- *            - 1 pwm to smbus failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      the window restarts now, the window needs the get_time_ms link to restart by itself,
+ *            a coalesced cell reads back its pending value until mlx90614_eeprom_flush writes it
  */
-uint8_t mlx90614_pwm_to_smbus(mlx90614_handle_t *handle)
+uint8_t mlx90614_set_eeprom_budget(mlx90614_handle_t *handle, uint32_t writes, uint32_t window_ms,
+                                   mlx90614_eeprom_policy_t policy)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                              /* check handle */
+    if (handle == NULL)                                                                   /* check handle */
     {
-         return 2;                                                   /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                         /* check handle initialization */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-         return 3;                                                   /* return error */
+        return 3;                                                                         /* return error */
     }
     
-    res = handle->scl_write(0);                                      /* set scl low */
-    if (res != 0)                                                    /* check result */
+    handle->eeprom_budget = writes;                                                       /* set the budget */
+    handle->eeprom_window_ms = window_ms;                                                 /* set the window */
+    handle->eeprom_policy = (uint8_t)policy;                                              /* set the policy */
+    handle->eeprom_window_start = 0;                                                      /* restart the window */
+    if (handle->get_time_ms != NULL)                                                      /* check the clock */
     {
-        handle->debug_print("mlx90614: write scl failed.\n");        /* write scl failed */
-        
-        return 1;                                                    /* return error */
+        handle->eeprom_window_start = handle->get_time_ms();                              /* set the window start */
+    }
+    handle->eeprom_window_writes = 0;                                                     /* clear the writes */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the eeprom wear stats
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *stats pointer to an eeprom stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eeprom stats failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one write is one erase and write cycle of a cell
+ */
+uint8_t mlx90614_get_eeprom_stats(mlx90614_handle_t *handle, mlx90614_eeprom_stats_t *stats)
+{
+    uint8_t i;
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
     }
-    handle->delay_ms(5);                                             /* delay 5 ms */
-    res = handle->scl_write(1);                                      /* set scl high */
-    if (res != 0)                                                    /* check result */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-        handle->debug_print("mlx90614: write scl failed.\n");        /* write scl failed */
-        
-        return 1;                                                    /* return error */
+        return 3;                                                                         /* return error */
+    }
+    if (stats == NULL)                                                                    /* check stats */
+    {
+        return 1;                                                                         /* return error */
+    }
+    
+    memset(stats, 0, sizeof(mlx90614_eeprom_stats_t));                                    /* clear the stats */
+    stats->max_cell = MLX90614_EEPROM_BASE;                                               /* first cell */
+    for (i = 0; i < MLX90614_EEPROM_SIZE; i++)                                            /* all cells */
+    {
+        stats->writes[i] = handle->eeprom_writes[i];                                      /* copy the counter */
+        stats->total += handle->eeprom_writes[i];                                         /* sum the writes */
+        if (handle->eeprom_writes[i] > stats->max_writes)                                 /* check the max */
+        {
+            stats->max_writes = handle->eeprom_writes[i];                                 /* set the max writes */
+            stats->max_cell = (uint8_t)(MLX90614_EEPROM_BASE + i);                        /* set the max cell */
+        }
+        if ((handle->eeprom_pending & (1UL << i)) != 0)                                   /* check the pending cell */
+        {
+            stats->pending++;                                                             /* count the pending cell */
+        }
     }
+    stats->window_writes = handle->eeprom_window_writes;                                  /* set the window writes */
+    stats->rejected = handle->eeprom_rejected;                                            /* set the rejected writes */
+    stats->coalesced = handle->eeprom_coalesced;                                          /* set the coalesced writes */
     
-    return 0;                                                        /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief     exit from sleep mode
+ * @brief     load persisted eeprom write counters
  * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *writes pointer to a write counter buffer of MLX90614_EEPROM_SIZE cells
  * @return    status code
  *            - 0 success
- *            - 1 exit sleep mode failed
+ *            - 1 set eeprom wear failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      save mlx90614_eeprom_stats_t.writes before deinit and load it after init
  */
-uint8_t mlx90614_exit_sleep_mode(mlx90614_handle_t *handle)
+uint8_t mlx90614_set_eeprom_wear(mlx90614_handle_t *handle, const uint32_t *writes)
 {
-    uint8_t res;
-    
-    if (handle == NULL)                                              /* check handle */
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-         return 2;                                                   /* return error */
+        return 3;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                         /* check handle initialization */
+    if (writes == NULL)                                                                   /* check writes */
     {
-         return 3;                                                   /* return error */
+        return 1;                                                                         /* return error */
     }
     
-    res = handle->scl_write(1);                                      /* write scl 1 */
-    if (res != 0)                                                    /* check result */
+    memcpy(handle->eeprom_writes, writes, sizeof(handle->eeprom_writes));                 /* copy the counters */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      write the coalesced eeprom cells within the budget
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *left pointer to a left cell number buffer, NULL is allowed
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom flush failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       call it periodically, the cells that still don't fit the budget are kept, left is the
+ *             number of cells still pending, including a cell whose write failed
+ */
+uint8_t mlx90614_eeprom_flush(mlx90614_handle_t *handle, uint8_t *left)
+{
+    uint8_t i;
+    uint8_t command;
+    uint16_t data;
+    
+    if (handle == NULL)                                                                   /* check handle */
     {
-        handle->debug_print("mlx90614: write scl failed.\n");        /* write scl failed */
-        
-        return 1;                                                    /* return error */
+        return 2;                                                                         /* return error */
     }
-    res = handle->sda_write(1);                                      /* write sda 1 */
-    if (res != 0)                                                    /* check result */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-        handle->debug_print("mlx90614: write sda failed.\n");        /* write sda failed */
-        
-        return 1;                                                    /* return error */
+        return 3;                                                                         /* return error */
     }
-    handle->delay_ms(1);                                             /* delay 1 ms */
-    res = handle->sda_write(0);                                      /* write sda 0 */
-    if (res != 0)                                                    /* check result */
+    
+    for (i = 0; i < MLX90614_EEPROM_SIZE; i++)                                            /* all cells */
     {
-        handle->debug_print("mlx90614: write sda failed.\n");        /* write sda failed */
-        
-        return 1;                                                    /* return error */
-    }    
-    handle->delay_ms(50);                                            /* delay 50 ms */
-    res = handle->sda_write(1);                                      /* write sda 1 */
-    if (res != 0)                                                    /* return error */
+        if ((handle->eeprom_pending & (1UL << i)) == 0)                                   /* check the pending cell */
+        {
+            continue;                                                                     /* skip the cell */
+        }
+        if (a_mlx90614_eeprom_admit(handle) == 0)                                         /* check the budget */
+        {
+            continue;                                                                     /* keep the cell */
+        }
+        command = (uint8_t)(MLX90614_EEPROM_BASE + i);                                    /* set the command */
+        data = handle->eeprom_pending_data[i];                                            /* get the pending data */
+        if (a_mlx90614_eeprom_cycle(handle, command, data) != 0)                          /* erase and write */
+        {
+            handle->eeprom_pending |= 1UL << i;                                           /* keep the cell */
+            MLX90614_LOG_ERROR(handle, MLX90614_EVENT_FLUSH_EEPROM_FAILED, command);      /* flush eeprom failed */
+            if (left != NULL)                                                             /* check left */
+            {
+                *left = a_mlx90614_eeprom_pending(handle);                                /* set left */
+            }
+            
+            return 1;                                                                     /* return error */
+        }
+    }
+    if (left != NULL)                                                                     /* check left */
     {
-        handle->debug_print("mlx90614: write sda failed.\n");        /* write sda failed */
-        
-        return 1;                                                    /* return error */
+        *left = a_mlx90614_eeprom_pending(handle);                                        /* set left */
     }
-    handle->delay_ms(260);                                           /* delay 260 ms */
     
-    return 0;                                                        /* success return 0 */
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
@@ -1563,66 +3315,67 @@ uint8_t mlx90614_exit_sleep_mode(mlx90614_handle_t *handle)
  */
 uint8_t mlx90614_init(mlx90614_handle_t *handle)
 {
-    if (handle == NULL)                                              /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                    /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->debug_print == NULL)                                 /* check debug_print */
+    if (handle->debug_print == NULL)                                           /* check debug_print */
     {
-        return 3;                                                    /* return error */
+        return 3;                                                              /* return error */
     }
-    if (handle->iic_init == NULL)                                    /* check iic_init */
+    if (handle->iic_init == NULL)                                              /* check iic_init */
     {
-        handle->debug_print("mlx90614: iic_init is null.\n");        /* iic_init is null */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_LINK_IIC_INIT_NULL, 0);      /* iic_init is null */
         
-        return 3;                                                    /* return error */
+        return 3;                                                              /* return error */
     }
-    if (handle->iic_deinit == NULL)                                  /* check iic_deinit */
+    if (handle->iic_deinit == NULL)                                            /* check iic_deinit */
     {
-        handle->debug_print("mlx90614: iic_deinit is null.\n");      /* iic_deinit is null */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_LINK_IIC_DEINIT_NULL, 0);    /* iic_deinit is null */
         
-        return 3;                                                    /* return error */
+        return 3;                                                              /* return error */
     }
-    if (handle->iic_read == NULL)                                    /* check iic_read */
+    if (handle->iic_read == NULL)                                              /* check iic_read */
     {
-        handle->debug_print("mlx90614: iic_read is null.\n");        /* iic_read is null */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_LINK_IIC_READ_NULL, 0);      /* iic_read is null */
         
-        return 3;                                                    /* return error */
+        return 3;                                                              /* return error */
     }
-    if (handle->iic_write == NULL)                                   /* check iic_write */
+    if (handle->iic_write == NULL)                                             /* check iic_write */
     {
-        handle->debug_print("mlx90614: iic_write is null.\n");       /* iic_write is null */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_LINK_IIC_WRITE_NULL, 0);     /* iic_write is null */
         
-        return 3;                                                    /* return error */
+        return 3;                                                              /* return error */
     }
-    if (handle->scl_write == NULL)                                   /* check scl_write */
+    if (handle->scl_write == NULL)                                             /* check scl_write */
     {
-        handle->debug_print("mlx90614: scl_write is null.\n");       /* scl_write is null */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_LINK_SCL_WRITE_NULL, 0);     /* scl_write is null */
         
-        return 3;                                                    /* return error */
+        return 3;                                                              /* return error */
     }
-    if (handle->sda_write == NULL)                                   /* check sda_write */
+    if (handle->sda_write == NULL)                                             /* check sda_write */
     {
-        handle->debug_print("mlx90614: sda_write is null.\n");       /* sda_write is null */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_LINK_SDA_WRITE_NULL, 0);     /* sda_write is null */
         
-        return 3;                                                    /* return error */
+        return 3;                                                              /* return error */
     }
-    if (handle->delay_ms == NULL)                                    /* check delay_ms */
+    if (handle->delay_ms == NULL)                                              /* check delay_ms */
     {
-        handle->debug_print("mlx90614: delay_ms is null.\n");        /* delay_ms is null */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_LINK_DELAY_MS_NULL, 0);      /* delay_ms is null */
         
-        return 3;                                                    /* return error */
+        return 3;                                                              /* return error */
     }
     
-    if (handle->iic_init() != 0)                                     /* iic init */
+    if (handle->iic_init() != 0)                                               /* iic init */
     {
-        handle->debug_print("mlx90614: iic init failed.\n");         /* iic init failed */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_IIC_INIT_FAILED, 0);         /* iic init failed */
         
-        return 1;                                                    /* return error */
+        return 1;                                                              /* return error */
     }
-    handle->inited = 1;                                              /* flag finish initialization */
+    handle->config1_valid = 0;                                                 /* config1 is not cached */
+    handle->inited = 1;                                                        /* flag finish initialization */
 
-    return 0;                                                        /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
@@ -1651,7 +3404,7 @@ uint8_t mlx90614_deinit(mlx90614_handle_t *handle)
     res = handle->iic_deinit();                                                                /* iic deinit */
     if (res != 0)                                                                              /* check result */
     {
-        handle->debug_print("mlx90614: iic deinit failed.\n");                                 /* iic deinit failed */
+        MLX90614_LOG_ERROR(handle, MLX90614_EVENT_IIC_DEINIT_FAILED, 0);                       /* iic deinit failed */
         
         return 1;                                                                              /* return error */
     }
@@ -1660,6 +3413,140 @@ uint8_t mlx90614_deinit(mlx90614_handle_t *handle)
     return 0;                                                                                  /* success return 0 */
 }
 
+/**
+ * @brief mlx90614 event text table, indexed by the event code
+ * @note  the common "mlx90614: " prefix is added when the text is printed
+ */
+#if (MLX90614_LOG_TEXT != 0) && (MLX90614_LOG_LEVEL != MLX90614_LOG_LEVEL_NONE)
+static const char *const gs_event_text[MLX90614_EVENT_MAX] =
+{
+    "no event",
+    "iic_init is null",
+    "iic_deinit is null",
+    "iic_read is null",
+    "iic_write is null",
+    "scl_write is null",
+    "sda_write is null",
+    "delay_ms is null",
+    "iic init failed",
+    "iic deinit failed",
+    "write scl failed",
+    "write sda failed",
+    "read raw channel 1 failed",
+    "read raw channel 2 failed",
+    "read raw ta failed",
+    "read ram tobj1 failed",
+    "read ram tobj2 failed",
+    "flag error",
+    "read id1 failed",
+    "read id2 failed",
+    "read id3 failed",
+    "read id4 failed",
+    "read ta range failed",
+    "read pwm ctrl failed",
+    "write pwm ctrl failed",
+    "write to min failed",
+    "write to max failed",
+    "read field failed",
+    "write field failed",
+    "read eeprom address failed",
+    "write eeprom address failed",
+    "read eeprom failed",
+    "write eeprom failed",
+    "erase eeprom failed",
+    "program eeprom failed",
+    "verify eeprom failed",
+    "flush eeprom failed",
+    "exit sleep mode failed",
+    "wait ready timeout",
+    "wake up timeout",
+    "eeprom budget is exceeded",
+    "param is invalid",
+    "s is over 1.0",
+    "celsius is out of range",
+    "hysteresis is out of range",
+    "repetition is over 31",
+    "period is over 127",
+    "field is invalid",
+    "value is over the field width",
+    "field is read only",
+    "reg is not eeprom",
+    "eeprom image is invalid",
+    "mask has factory cells",
+};
+#endif
+
+/**
+ * @brief     log an event
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] level log level
+ * @param[in] event event code
+ * @param[in] arg event argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 no output is linked
+ *            - 2 handle is NULL
+ * @note      the linked log_event sink gets the event code and the argument unformatted,
+ *            without a sink the message is passed to debug_print
+ */
+uint8_t mlx90614_log(mlx90614_handle_t *handle, uint8_t level, mlx90614_event_t event, uint32_t arg)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    
+    if (handle->log_event != NULL)                                               /* check the sink */
+    {
+        handle->log_event(level, (uint16_t)event, arg);                          /* pass the code, format nothing */
+        
+        return 0;                                                                /* success return 0 */
+    }
+    if (handle->debug_print == NULL)                                             /* check debug_print */
+    {
+        return 1;                                                                /* return error */
+    }
+#if (MLX90614_LOG_TEXT != 0) && (MLX90614_LOG_LEVEL != MLX90614_LOG_LEVEL_NONE)
+    if ((uint32_t)event < (uint32_t)MLX90614_EVENT_MAX)                          /* check the event */
+    {
+        handle->debug_print("mlx90614: %s.\n", gs_event_text[event]);            /* print the text */
+        
+        return 0;                                                                /* success return 0 */
+    }
+#endif
+    handle->debug_print("mlx90614: event 0x%02X arg 0x%08X.\n",
+                        (unsigned int)event, (unsigned int)arg);                  /* print the code */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the message text of an event
+ * @param[in]  event event code
+ * @param[out] **text pointer to a text pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 event is invalid
+ *             - 5 texts are not built in
+ * @note       lets a log_event sink format the events later, out of the driver call path
+ */
+uint8_t mlx90614_get_event_text(mlx90614_event_t event, const char **text)
+{
+    if ((uint32_t)event >= (uint32_t)MLX90614_EVENT_MAX)                         /* check the event */
+    {
+        return 4;                                                                /* return error */
+    }
+#if (MLX90614_LOG_TEXT != 0) && (MLX90614_LOG_LEVEL != MLX90614_LOG_LEVEL_NONE)
+    *text = gs_event_text[event];                                                /* get the text */
+    
+    return 0;                                                                    /* success return 0 */
+#else
+    *text = NULL;                                                                /* no text */
+    
+    return 5;                                                                    /* return error */
+#endif
+}
+
 /**
  * @brief     set the chip register
  * @param[in] *handle pointer to an mlx90614 handle structure
@@ -64,6 +64,24 @@ typedef enum
     MLX90614_ADDRESS_DEFAULT = 0xB4,        /**< default address */
 } mlx90614_address_t;
 
+/**
+ * @brief mlx90614 fixed point definition
+ * @note  define MLX90614_FIXED_POINT as 100 or 1000 to build the driver without any float code,
+ *        temperatures are then integer centi or milli degrees celsius and the emissivity
+ *        correction coefficient is an integer in 1 / MLX90614_EMISSIVITY_SCALE
+ */
+#ifdef MLX90614_FIXED_POINT
+#if (MLX90614_FIXED_POINT != 100) && (MLX90614_FIXED_POINT != 1000)
+#error "MLX90614_FIXED_POINT must be 100 or 1000"
+#endif
+#define MLX90614_EMISSIVITY_SCALE        10000U        /**< emissivity correction coefficient scale */
+typedef int32_t mlx90614_temperature_t;                 /**< temperature in 1 / MLX90614_FIXED_POINT celsius */
+typedef uint32_t mlx90614_emissivity_t;                 /**< emissivity correction coefficient in 1 / MLX90614_EMISSIVITY_SCALE */
+#else
+typedef float mlx90614_temperature_t;                   /**< temperature in celsius */
+typedef double mlx90614_emissivity_t;                   /**< emissivity correction coefficient */
+#endif
+
 /**
  * @}
  */
@@ -174,6 +192,210 @@ typedef enum
     MLX90614_IIR_A1_0P571_B1_0P428 = 0x07,        /**< a1 = 0.571 b1 = 0.428 */
 } mlx90614_iir_t;
 
+/**
+ * @brief mlx90614 pwm mode enumeration definition
+ */
+typedef enum
+{
+    MLX90614_PWM_MODE_EXTENDED = 0x00,        /**< extended pwm, ta and tobj1 or tobj1 and tobj2 */
+    MLX90614_PWM_MODE_SINGLE   = 0x01,        /**< single pwm, the output selected by the mode */
+} mlx90614_pwm_mode_t;
+
+/**
+ * @brief mlx90614 pwm pin enumeration definition
+ */
+typedef enum
+{
+    MLX90614_PWM_PIN_OPEN_DRAIN = 0x00,        /**< pwm or sda pin is open drain */
+    MLX90614_PWM_PIN_PUSH_PULL  = 0x01,        /**< pwm or sda pin is push pull */
+} mlx90614_pwm_pin_t;
+
+/**
+ * @brief mlx90614 pwm output enumeration definition
+ */
+typedef enum
+{
+    MLX90614_PWM_OUTPUT_PWM           = 0x00,        /**< pwm output */
+    MLX90614_PWM_OUTPUT_THERMAL_RELAY = 0x01,        /**< thermal relay output */
+} mlx90614_pwm_output_t;
+
+/**
+ * @brief mlx90614 eeprom budget policy enumeration definition
+ */
+typedef enum
+{
+    MLX90614_EEPROM_POLICY_REJECT   = 0x00,        /**< fail the writes beyond the budget */
+    MLX90614_EEPROM_POLICY_COALESCE = 0x01,        /**< keep the last value of every cell and write it later */
+} mlx90614_eeprom_policy_t;
+
+/**
+ * @brief mlx90614 register field enumeration definition
+ */
+typedef enum
+{
+    MLX90614_FIELD_IIR                = 0x00,        /**< config1 bits 2:0, mlx90614_iir_t */
+    MLX90614_FIELD_REPEAT_SENSOR_TEST = 0x01,        /**< config1 bit 3, mlx90614_bool_t */
+    MLX90614_FIELD_MODE               = 0x02,        /**< config1 bits 5:4, mlx90614_mode_t */
+    MLX90614_FIELD_IR_SENSOR          = 0x03,        /**< config1 bit 6, mlx90614_ir_sensor_t */
+    MLX90614_FIELD_KS                 = 0x04,        /**< config1 bit 7, mlx90614_ks_t */
+    MLX90614_FIELD_FIR_LENGTH         = 0x05,        /**< config1 bits 10:8, mlx90614_fir_length_t */
+    MLX90614_FIELD_GAIN               = 0x06,        /**< config1 bits 13:11, mlx90614_gain_t */
+    MLX90614_FIELD_KT2                = 0x07,        /**< config1 bit 14, mlx90614_kt2_t */
+    MLX90614_FIELD_SENSOR_TEST        = 0x08,        /**< config1 bit 15, mlx90614_bool_t */
+    MLX90614_FIELD_PWM_MODE           = 0x09,        /**< pwm ctrl bit 0, mlx90614_pwm_mode_t */
+    MLX90614_FIELD_PWM_ENABLE         = 0x0A,        /**< pwm ctrl bit 1, mlx90614_bool_t */
+    MLX90614_FIELD_PWM_PIN            = 0x0B,        /**< pwm ctrl bit 2, mlx90614_pwm_pin_t */
+    MLX90614_FIELD_PWM_OUTPUT         = 0x0C,        /**< pwm ctrl bit 3, mlx90614_pwm_output_t */
+    MLX90614_FIELD_PWM_REPETITION     = 0x0D,        /**< pwm ctrl bits 8:4 */
+    MLX90614_FIELD_PWM_PERIOD         = 0x0E,        /**< pwm ctrl bits 15:9 */
+    MLX90614_FIELD_TA_MIN             = 0x0F,        /**< ta range bits 7:0 */
+    MLX90614_FIELD_TA_MAX             = 0x10,        /**< ta range bits 15:8 */
+    MLX90614_FIELD_ID1                = 0x11,        /**< id1 number, read only */
+    MLX90614_FIELD_ID2                = 0x12,        /**< id2 number, read only */
+    MLX90614_FIELD_ID3                = 0x13,        /**< id3 number, read only */
+    MLX90614_FIELD_ID4                = 0x14,        /**< id4 number, read only */
+    MLX90614_FIELD_MAX                = 0x15,        /**< field number */
+} mlx90614_field_t;
+
+/**
+ * @brief mlx90614 start path enumeration definition
+ */
+typedef enum
+{
+    MLX90614_START_PATH_FAST  = 0x00,        /**< the chip was awake in smbus mode, one read */
+    MLX90614_START_PATH_SMBUS = 0x01,        /**< the chip was in pwm mode and was switched to smbus */
+    MLX90614_START_PATH_WAKE  = 0x02,        /**< the chip was asleep and was woken up */
+} mlx90614_start_path_t;
+
+/**
+ * @brief mlx90614 event enumeration definition
+ */
+typedef enum
+{
+    MLX90614_EVENT_NONE                         = 0x00,        /**< no event */
+    MLX90614_EVENT_LINK_IIC_INIT_NULL           = 0x01,        /**< iic_init is null */
+    MLX90614_EVENT_LINK_IIC_DEINIT_NULL         = 0x02,        /**< iic_deinit is null */
+    MLX90614_EVENT_LINK_IIC_READ_NULL           = 0x03,        /**< iic_read is null */
+    MLX90614_EVENT_LINK_IIC_WRITE_NULL          = 0x04,        /**< iic_write is null */
+    MLX90614_EVENT_LINK_SCL_WRITE_NULL          = 0x05,        /**< scl_write is null */
+    MLX90614_EVENT_LINK_SDA_WRITE_NULL          = 0x06,        /**< sda_write is null */
+    MLX90614_EVENT_LINK_DELAY_MS_NULL           = 0x07,        /**< delay_ms is null */
+    MLX90614_EVENT_IIC_INIT_FAILED              = 0x08,        /**< iic init failed */
+    MLX90614_EVENT_IIC_DEINIT_FAILED            = 0x09,        /**< iic deinit failed */
+    MLX90614_EVENT_WRITE_SCL_FAILED             = 0x0A,        /**< write scl failed */
+    MLX90614_EVENT_WRITE_SDA_FAILED             = 0x0B,        /**< write sda failed */
+    MLX90614_EVENT_READ_RAW_CHANNEL_1_FAILED    = 0x0C,        /**< read raw channel 1 failed */
+    MLX90614_EVENT_READ_RAW_CHANNEL_2_FAILED    = 0x0D,        /**< read raw channel 2 failed */
+    MLX90614_EVENT_READ_RAW_TA_FAILED           = 0x0E,        /**< read raw ta failed */
+    MLX90614_EVENT_READ_RAM_TOBJ1_FAILED        = 0x0F,        /**< read ram tobj1 failed */
+    MLX90614_EVENT_READ_RAM_TOBJ2_FAILED        = 0x10,        /**< read ram tobj2 failed */
+    MLX90614_EVENT_FLAG_ERROR                   = 0x11,        /**< flag error */
+    MLX90614_EVENT_READ_ID1_FAILED              = 0x12,        /**< read id1 failed */
+    MLX90614_EVENT_READ_ID2_FAILED              = 0x13,        /**< read id2 failed */
+    MLX90614_EVENT_READ_ID3_FAILED              = 0x14,        /**< read id3 failed */
+    MLX90614_EVENT_READ_ID4_FAILED              = 0x15,        /**< read id4 failed */
+    MLX90614_EVENT_READ_TA_RANGE_FAILED         = 0x16,        /**< read ta range failed */
+    MLX90614_EVENT_READ_PWM_CTRL_FAILED         = 0x17,        /**< read pwm ctrl failed */
+    MLX90614_EVENT_WRITE_PWM_CTRL_FAILED        = 0x18,        /**< write pwm ctrl failed */
+    MLX90614_EVENT_WRITE_TO_MIN_FAILED          = 0x19,        /**< write to min failed */
+    MLX90614_EVENT_WRITE_TO_MAX_FAILED          = 0x1A,        /**< write to max failed */
+    MLX90614_EVENT_READ_FIELD_FAILED            = 0x1B,        /**< read field failed */
+    MLX90614_EVENT_WRITE_FIELD_FAILED           = 0x1C,        /**< write field failed */
+    MLX90614_EVENT_READ_EEPROM_ADDRESS_FAILED   = 0x1D,        /**< read eeprom address failed */
+    MLX90614_EVENT_WRITE_EEPROM_ADDRESS_FAILED  = 0x1E,        /**< write eeprom address failed */
+    MLX90614_EVENT_READ_EEPROM_FAILED           = 0x1F,        /**< read eeprom failed */
+    MLX90614_EVENT_WRITE_EEPROM_FAILED          = 0x20,        /**< write eeprom failed */
+    MLX90614_EVENT_ERASE_EEPROM_FAILED          = 0x21,        /**< erase eeprom failed */
+    MLX90614_EVENT_PROGRAM_EEPROM_FAILED        = 0x22,        /**< program eeprom failed */
+    MLX90614_EVENT_VERIFY_EEPROM_FAILED         = 0x23,        /**< verify eeprom failed */
+    MLX90614_EVENT_FLUSH_EEPROM_FAILED          = 0x24,        /**< flush eeprom failed */
+    MLX90614_EVENT_EXIT_SLEEP_MODE_FAILED       = 0x25,        /**< exit sleep mode failed */
+    MLX90614_EVENT_WAIT_READY_TIMEOUT           = 0x26,        /**< wait ready timeout */
+    MLX90614_EVENT_WAKE_UP_TIMEOUT              = 0x27,        /**< wake up timeout */
+    MLX90614_EVENT_EEPROM_BUDGET_EXCEEDED       = 0x28,        /**< eeprom budget is exceeded */
+    MLX90614_EVENT_PARAM_INVALID                = 0x29,        /**< param is invalid */
+    MLX90614_EVENT_EMISSIVITY_OVER_1            = 0x2A,        /**< s is over 1.0 */
+    MLX90614_EVENT_CELSIUS_OUT_OF_RANGE         = 0x2B,        /**< celsius is out of range */
+    MLX90614_EVENT_HYSTERESIS_OUT_OF_RANGE      = 0x2C,        /**< hysteresis is out of range */
+    MLX90614_EVENT_REPETITION_OVER_31           = 0x2D,        /**< repetition is over 31 */
+    MLX90614_EVENT_PERIOD_OVER_127              = 0x2E,        /**< period is over 127 */
+    MLX90614_EVENT_FIELD_INVALID                = 0x2F,        /**< field is invalid */
+    MLX90614_EVENT_FIELD_VALUE_TOO_WIDE         = 0x30,        /**< value is over the field width */
+    MLX90614_EVENT_FIELD_READ_ONLY              = 0x31,        /**< field is read only */
+    MLX90614_EVENT_REG_NOT_EEPROM               = 0x32,        /**< reg is not eeprom */
+    MLX90614_EVENT_EEPROM_IMAGE_INVALID         = 0x33,        /**< eeprom image is invalid */
+    MLX90614_EVENT_EEPROM_MASK_FACTORY          = 0x34,        /**< mask has factory cells */
+    MLX90614_EVENT_MAX                          = 0x35,        /**< event number */
+} mlx90614_event_t;
+
+/**
+ * @brief mlx90614 timing definition
+ */
+#define MLX90614_EEPROM_WRITE_MS        10         /**< eeprom erase or write cycle time in ms */
+#define MLX90614_WAKE_PULSE_MS          50         /**< sda low time of the wake up request in ms */
+#define MLX90614_WAKE_SETTLE_MS         260        /**< time from the end of the wake up request to the first valid data in ms */
+#define MLX90614_READY_POLL_MS          5          /**< readiness poll step in ms */
+#define MLX90614_READY_TIMEOUT_MS       (2 * MLX90614_WAKE_SETTLE_MS)        /**< readiness timeout after a wake up in ms */
+
+/**
+ * @brief mlx90614 log level definition
+ * @note  define MLX90614_LOG_LEVEL to drop every message above the level at compile time,
+ *        MLX90614_LOG_LEVEL_NONE removes the messages and their strings from the image
+ */
+#define MLX90614_LOG_LEVEL_NONE           0        /**< no message */
+#define MLX90614_LOG_LEVEL_ERROR          1        /**< bus and device failures */
+#define MLX90614_LOG_LEVEL_WARNING        2        /**< rejected parameters, timeouts and eeprom budget */
+#ifndef MLX90614_LOG_LEVEL
+#define MLX90614_LOG_LEVEL                MLX90614_LOG_LEVEL_WARNING        /**< keep every message */
+#endif
+
+/**
+ * @brief mlx90614 log text definition
+ * @note  define MLX90614_LOG_TEXT as 0 to keep the event codes but drop the message strings,
+ *        debug_print then gets the event number and the argument instead of the text
+ */
+#ifndef MLX90614_LOG_TEXT
+#define MLX90614_LOG_TEXT                 1        /**< keep the message strings */
+#endif
+
+/**
+ * @brief     log an error event
+ * @param[in] HANDLE pointer to an mlx90614 handle structure
+ * @param[in] EVENT event code
+ * @param[in] ARG event argument
+ * @note      none
+ */
+#if (MLX90614_LOG_LEVEL >= MLX90614_LOG_LEVEL_ERROR)
+#define MLX90614_LOG_ERROR(HANDLE, EVENT, ARG)      (void)mlx90614_log((HANDLE), MLX90614_LOG_LEVEL_ERROR, (EVENT), (uint32_t)(ARG))
+#else
+#define MLX90614_LOG_ERROR(HANDLE, EVENT, ARG)      (void)(ARG)
+#endif
+
+/**
+ * @brief     log a warning event
+ * @param[in] HANDLE pointer to an mlx90614 handle structure
+ * @param[in] EVENT event code
+ * @param[in] ARG event argument
+ * @note      none
+ */
+#if (MLX90614_LOG_LEVEL >= MLX90614_LOG_LEVEL_WARNING)
+#define MLX90614_LOG_WARNING(HANDLE, EVENT, ARG)    (void)mlx90614_log((HANDLE), MLX90614_LOG_LEVEL_WARNING, (EVENT), (uint32_t)(ARG))
+#else
+#define MLX90614_LOG_WARNING(HANDLE, EVENT, ARG)    (void)(ARG)
+#endif
+
+/**
+ * @brief mlx90614 eeprom image definition
+ */
+#define MLX90614_EEPROM_IMAGE_MAGIC          0x45584C4DU                                                  /**< image magic "MLXE" */
+#define MLX90614_EEPROM_IMAGE_VERSION        1                                                            /**< image format version */
+#define MLX90614_EEPROM_BASE                 0x20                                                         /**< first eeprom cell */
+#define MLX90614_EEPROM_SIZE                 32                                                           /**< eeprom cell number */
+#define MLX90614_EEPROM_CELL(reg)            (1UL << ((reg) - MLX90614_EEPROM_BASE))                      /**< restore mask bit of a cell */
+#define MLX90614_EEPROM_USER_MASK            0x0000003FUL                                                 /**< to max, to min, pwm ctrl, ta range, emissivity and config1 */
+#define MLX90614_EEPROM_ADDRESS_MASK         0x00004000UL                                                 /**< smbus address cell */
+#define MLX90614_EEPROM_WRITABLE_MASK        (MLX90614_EEPROM_USER_MASK | MLX90614_EEPROM_ADDRESS_MASK)   /**< all cells a restore may write */
+
 /**
  * @}
  */
@@ -197,9 +419,95 @@ typedef struct mlx90614_handle_s
     void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
     uint8_t (*scl_write)(uint8_t v);                                                    /**< point to a scl_write address */
     uint8_t (*sda_write)(uint8_t v);                                                    /**< point to a sda_write address */
+    uint32_t (*get_time_ms)(void);                                                      /**< point to a get_time_ms function address, optional */
+    void (*log_event)(uint8_t level, uint16_t event, uint32_t arg);                     /**< point to a log_event function address, optional */
+    void (*sample_hook)(void *arg, uint8_t reg, mlx90614_temperature_t celsius);        /**< point to a sample_hook function address, optional */
+    void *sample_hook_arg;                                                              /**< sample_hook argument */
+    uint32_t eeprom_writes[MLX90614_EEPROM_SIZE];                                       /**< eeprom write counter of every cell */
+    uint32_t eeprom_budget;                                                             /**< eeprom writes allowed in one window, 0 means no limit */
+    uint32_t eeprom_window_ms;                                                          /**< budget window in ms */
+    uint32_t eeprom_window_start;                                                       /**< budget window start in ms */
+    uint32_t eeprom_window_writes;                                                      /**< eeprom writes in the current window */
+    uint32_t eeprom_rejected;                                                           /**< rejected eeprom writes */
+    uint32_t eeprom_coalesced;                                                          /**< coalesced eeprom writes */
+    uint32_t eeprom_pending;                                                            /**< cells with a coalesced value */
+    uint16_t eeprom_pending_data[MLX90614_EEPROM_SIZE];                                 /**< coalesced value of every cell */
+    uint8_t eeprom_policy;                                                              /**< eeprom budget policy */
+    uint16_t config1;                                                                   /**< cached config1 register */
+    uint8_t config1_valid;                                                              /**< cached config1 flag */
     uint8_t inited;                                                                     /**< inited flag */
 } mlx90614_handle_t;
 
+/**
+ * @brief mlx90614 pwm ctrl structure definition
+ */
+typedef struct mlx90614_pwm_ctrl_s
+{
+    mlx90614_pwm_mode_t mode;           /**< pwm mode, bit 0 */
+    mlx90614_bool_t enable;             /**< pwm enable, bit 1 */
+    mlx90614_pwm_pin_t pin;             /**< pwm or sda pin type, bit 2 */
+    mlx90614_pwm_output_t output;       /**< pwm or thermal relay output, bit 3 */
+    uint8_t repetition;                 /**< repetition number minus one, bits 8:4, 0 - 31 */
+    uint8_t period;                     /**< period multiplier of the 1.024 ms base period, bits 15:9, 0 - 127 */
+} mlx90614_pwm_ctrl_t;
+
+/**
+ * @brief mlx90614 eeprom image structure definition
+ */
+typedef struct mlx90614_eeprom_image_s
+{
+    uint32_t magic;                             /**< image magic */
+    uint16_t version;                           /**< image format version */
+    uint8_t addr;                               /**< iic address the image was read from */
+    uint8_t reserved;                           /**< reserved */
+    uint64_t id;                                /**< 64 bits chip id */
+    uint16_t word[MLX90614_EEPROM_SIZE];        /**< eeprom cells 0x20 - 0x3F */
+    uint8_t pec[MLX90614_EEPROM_SIZE];          /**< pec of every cell read */
+} mlx90614_eeprom_image_t;
+
+/**
+ * @brief mlx90614 eeprom stats structure definition
+ */
+typedef struct mlx90614_eeprom_stats_s
+{
+    uint32_t writes[MLX90614_EEPROM_SIZE];        /**< write counter of every cell */
+    uint32_t total;                               /**< writes of all cells */
+    uint8_t max_cell;                             /**< most written cell register */
+    uint32_t max_writes;                          /**< writes of the most written cell */
+    uint32_t window_writes;                       /**< writes in the current budget window */
+    uint32_t rejected;                            /**< rejected writes */
+    uint32_t coalesced;                           /**< coalesced writes */
+    uint32_t pending;                             /**< cells waiting for mlx90614_eeprom_flush */
+} mlx90614_eeprom_stats_t;
+
+/**
+ * @brief mlx90614 zone flag definition
+ */
+#define MLX90614_ZONE_TA                (1 << 0)        /**< ambient */
+#define MLX90614_ZONE_TOBJ1             (1 << 1)        /**< object1 zone */
+#define MLX90614_ZONE_TOBJ2             (1 << 2)        /**< object2 zone */
+#define MLX90614_ZONE_FUSED             (1 << 3)        /**< fused object estimate */
+#define MLX90614_ZONE_DIFFERENCE        (1 << 4)        /**< object1 - object2 */
+#define MLX90614_ZONE_GRADIENT          (1 << 5)        /**< fused object - ambient */
+
+/**
+ * @brief mlx90614 zone structure definition
+ */
+typedef struct mlx90614_zone_s
+{
+    uint8_t live;                              /**< registers the mode updates, MLX90614_ZONE_TA - TOBJ2 */
+    uint8_t valid;                             /**< outputs with a valid value, MLX90614_ZONE_* */
+    uint16_t ambient_raw;                      /**< ambient raw data */
+    uint16_t object1_raw;                      /**< object1 raw data */
+    uint16_t object2_raw;                      /**< object2 raw data */
+    mlx90614_temperature_t ambient;            /**< ambient temperature */
+    mlx90614_temperature_t object1;            /**< object1 temperature */
+    mlx90614_temperature_t object2;            /**< object2 temperature */
+    mlx90614_temperature_t fused;              /**< mean of the valid object zones */
+    mlx90614_temperature_t difference;         /**< object1 - object2 */
+    mlx90614_temperature_t gradient;           /**< fused - ambient */
+} mlx90614_zone_t;
+
 /**
  * @brief mlx90614 information structure definition
  */
@@ -299,6 +607,22 @@ typedef struct mlx90614_info_s
  */
 #define DRIVER_MLX90614_LINK_DEBUG_PRINT(HANDLE, FUC)        (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link get_time_ms function
+ * @param[in] HANDLE pointer to an mlx90614 handle structure
+ * @param[in] FUC pointer to a get_time_ms function address
+ * @note      optional, without it the eeprom budget window never restarts by itself
+ */
+#define DRIVER_MLX90614_LINK_GET_TIME_MS(HANDLE, FUC)        (HANDLE)->get_time_ms = FUC
+
+/**
+ * @brief     link log_event function
+ * @param[in] HANDLE pointer to an mlx90614 handle structure
+ * @param[in] FUC pointer to a log_event function address
+ * @note      optional, with it the driver passes event codes to the sink and never calls debug_print
+ */
+#define DRIVER_MLX90614_LINK_LOG_EVENT(HANDLE, FUC)          (HANDLE)->log_event = FUC
+
 /**
  * @}
  */
@@ -327,7 +651,7 @@ uint8_t mlx90614_info(mlx90614_info_t *info);
  * @return    status code
  *            - 0 success
  *            - 2 handle is NULL
- * @note      none
+ * @note      the cached config1 belongs to the previous chip and is dropped
  */
 uint8_t mlx90614_set_addr(mlx90614_handle_t *handle, uint8_t addr);
 
@@ -379,7 +703,7 @@ uint8_t mlx90614_deinit(mlx90614_handle_t *handle);
  *             - 4 flag error
  * @note       none
  */
-uint8_t mlx90614_read_object1(mlx90614_handle_t *handle, uint16_t *raw, float *celsius);
+uint8_t mlx90614_read_object1(mlx90614_handle_t *handle, uint16_t *raw, mlx90614_temperature_t *celsius);
 
 /**
  * @brief      read the object2
@@ -394,7 +718,7 @@ uint8_t mlx90614_read_object1(mlx90614_handle_t *handle, uint16_t *raw, float *c
  *             - 4 flag error
  * @note       none
  */
-uint8_t mlx90614_read_object2(mlx90614_handle_t *handle, uint16_t *raw, float *celsius);
+uint8_t mlx90614_read_object2(mlx90614_handle_t *handle, uint16_t *raw, mlx90614_temperature_t *celsius);
 
 /**
  * @brief      read the ir channel raw data
@@ -422,7 +746,50 @@ uint8_t mlx90614_read_raw_ir_channel(mlx90614_handle_t *handle, uint16_t *channe
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mlx90614_read_ambient(mlx90614_handle_t *handle, uint16_t *raw, float *celsius);
+uint8_t mlx90614_read_ambient(mlx90614_handle_t *handle, uint16_t *raw, mlx90614_temperature_t *celsius);
+
+/**
+ * @brief      get the live zones of the cached mode
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *live pointer to a live zone buffer, MLX90614_ZONE_TA - TOBJ2
+ * @return     status code
+ *             - 0 success
+ *             - 1 get live zones failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       config1 is read once and cached, the driver refreshes the cache on every config1 write,
+ *             a single ir sensor chip has no tobj2, so its tobj2 modes read tobj1
+ */
+uint8_t mlx90614_get_live_zones(mlx90614_handle_t *handle, uint8_t *live);
+
+/**
+ * @brief      read the live zones of the cached mode
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *zone pointer to a zone structure
+ * @param[in]  fuse MLX90614_BOOL_TRUE to get the fused estimate, the difference and the gradient
+ * @return     status code
+ *             - 0 success
+ *             - 1 read zones failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 every live object zone has the error flag
+ * @note       only the registers the mode updates are read, a zone with the error flag is left out of valid
+ */
+uint8_t mlx90614_read_zones(mlx90614_handle_t *handle, mlx90614_zone_t *zone, mlx90614_bool_t fuse);
+
+/**
+ * @brief     set the sample hook
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *hook pointer to a sample hook function, NULL removes the hook
+ * @param[in] *arg hook argument
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      the ambient, object and zone reads call the hook with the register and the temperature
+ *            of every valid sample before they return, one hook per handle
+ */
+uint8_t mlx90614_set_sample_hook(mlx90614_handle_t *handle, void (*hook)(void *arg, uint8_t reg, mlx90614_temperature_t celsius),
+                                 void *arg);
 
 /**
  * @}
@@ -470,7 +837,8 @@ uint8_t mlx90614_read_addr(mlx90614_handle_t *handle, uint8_t *addr);
  *            - 1 set fir length failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_fir_length(mlx90614_handle_t *handle, mlx90614_fir_length_t len);
 
@@ -496,7 +864,8 @@ uint8_t mlx90614_get_fir_length(mlx90614_handle_t *handle, mlx90614_fir_length_t
  *            - 1 set fir failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_iir(mlx90614_handle_t *handle, mlx90614_iir_t iir);
 
@@ -522,7 +891,8 @@ uint8_t mlx90614_get_iir(mlx90614_handle_t *handle, mlx90614_iir_t *iir);
  *            - 1 set mode failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_mode(mlx90614_handle_t *handle, mlx90614_mode_t mode);
 
@@ -548,7 +918,8 @@ uint8_t mlx90614_get_mode(mlx90614_handle_t *handle, mlx90614_mode_t *mode);
  *            - 1 set ir sensor failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_ir_sensor(mlx90614_handle_t *handle, mlx90614_ir_sensor_t sensor);
 
@@ -574,7 +945,8 @@ uint8_t mlx90614_get_ir_sensor(mlx90614_handle_t *handle, mlx90614_ir_sensor_t *
  *            - 1 set ks failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_ks(mlx90614_handle_t *handle, mlx90614_ks_t ks);
 
@@ -600,7 +972,8 @@ uint8_t mlx90614_get_ks(mlx90614_handle_t *handle, mlx90614_ks_t *ks);
  *            - 1 set kt2 failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_kt2(mlx90614_handle_t *handle, mlx90614_kt2_t kt2);
 
@@ -626,7 +999,8 @@ uint8_t mlx90614_get_kt2(mlx90614_handle_t *handle, mlx90614_kt2_t *kt2);
  *            - 1 set gain failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_gain(mlx90614_handle_t *handle, mlx90614_gain_t gain);
 
@@ -652,7 +1026,8 @@ uint8_t mlx90614_get_gain(mlx90614_handle_t *handle, mlx90614_gain_t *gain);
  *            - 1 set sensor test failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_sensor_test(mlx90614_handle_t *handle, mlx90614_bool_t enable);
 
@@ -678,7 +1053,8 @@ uint8_t mlx90614_get_sensor_test(mlx90614_handle_t *handle, mlx90614_bool_t *ena
  *            - 1 set repeat sensor test failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 5 value is over the field width
+ * @note      the config1 cell is read first and only erased and written if the value changes
  */
 uint8_t mlx90614_set_repeat_sensor_test(mlx90614_handle_t *handle, mlx90614_bool_t enable);
 
@@ -732,9 +1108,9 @@ uint8_t mlx90614_get_emissivity_correction_coefficient(mlx90614_handle_t *handle
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  *             - 4 s is over 1.0
- * @note       none
+ * @note       s is in 1 / MLX90614_EMISSIVITY_SCALE with MLX90614_FIXED_POINT
  */
-uint8_t mlx90614_emissivity_correction_coefficient_convert_to_register(mlx90614_handle_t *handle, double s, uint16_t *reg);
+uint8_t mlx90614_emissivity_correction_coefficient_convert_to_register(mlx90614_handle_t *handle, mlx90614_emissivity_t s, uint16_t *reg);
 
 /**
  * @brief      emissivity correction coefficient convert to data
@@ -746,9 +1122,9 @@ uint8_t mlx90614_emissivity_correction_coefficient_convert_to_register(mlx90614_
  *             - 1 emissivity correction coefficient convert to data failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       s is in 1 / MLX90614_EMISSIVITY_SCALE with MLX90614_FIXED_POINT
  */
-uint8_t mlx90614_emissivity_correction_coefficient_convert_to_data(mlx90614_handle_t *handle, uint16_t reg, double *s);
+uint8_t mlx90614_emissivity_correction_coefficient_convert_to_data(mlx90614_handle_t *handle, uint16_t reg, mlx90614_emissivity_t *s);
 
 /**
  * @brief      get the chip id
@@ -783,7 +1159,7 @@ uint8_t mlx90614_enter_sleep_mode(mlx90614_handle_t *handle);
  *            - 1 exit sleep mode failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      returns as soon as the first fresh data is ready, at most MLX90614_READY_TIMEOUT_MS
  */
 uint8_t mlx90614_exit_sleep_mode(mlx90614_handle_t *handle);
 
@@ -812,6 +1188,559 @@ uint8_t mlx90614_get_flag(mlx90614_handle_t *handle, uint16_t *flag);
  */
 uint8_t mlx90614_pwm_to_smbus(mlx90614_handle_t *handle);
 
+/**
+ * @brief     set the to max
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] value set value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set to max failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      in thermal relay mode this cell holds the hysteresis
+ */
+uint8_t mlx90614_set_to_max(mlx90614_handle_t *handle, uint16_t value);
+
+/**
+ * @brief      get the to max
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get to max failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_to_max(mlx90614_handle_t *handle, uint16_t *value);
+
+/**
+ * @brief     set the to min
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] value set value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set to min failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      in thermal relay mode this cell holds the threshold
+ */
+uint8_t mlx90614_set_to_min(mlx90614_handle_t *handle, uint16_t value);
+
+/**
+ * @brief      get the to min
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get to min failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_to_min(mlx90614_handle_t *handle, uint16_t *value);
+
+/**
+ * @brief      convert the object temperature to the register raw data
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  celsius object temperature
+ * @param[out] *reg pointer to a register raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 to convert to register failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 celsius is out of range
+ * @note       the register is in 0.01 K, -273.15 <= celsius <= 382.20
+ */
+uint8_t mlx90614_to_convert_to_register(mlx90614_handle_t *handle, mlx90614_temperature_t celsius, uint16_t *reg);
+
+/**
+ * @brief      convert the register raw data to the object temperature
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *celsius pointer to an object temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 to convert to data failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_to_convert_to_data(mlx90614_handle_t *handle, uint16_t reg, mlx90614_temperature_t *celsius);
+
+/**
+ * @brief     set the ta range
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] min ta min register raw data
+ * @param[in] max ta max register raw data
+ * @return    status code
+ *            - 0 success
+ *            - 1 set ta range failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      max is the high byte and min is the low byte
+ */
+uint8_t mlx90614_set_ta_range(mlx90614_handle_t *handle, uint8_t min, uint8_t max);
+
+/**
+ * @brief      get the ta range
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *min pointer to a ta min register raw data buffer
+ * @param[out] *max pointer to a ta max register raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get ta range failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_ta_range(mlx90614_handle_t *handle, uint8_t *min, uint8_t *max);
+
+/**
+ * @brief      convert the ambient temperature to the ta range register raw data
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  celsius ambient temperature
+ * @param[out] *reg pointer to a register raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ta range convert to register failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 celsius is out of range
+ * @note       the register is in 0.64 degC from -38.2, -38.20 <= celsius <= 125.00
+ */
+uint8_t mlx90614_ta_range_convert_to_register(mlx90614_handle_t *handle, mlx90614_temperature_t celsius, uint8_t *reg);
+
+/**
+ * @brief      convert the ta range register raw data to the ambient temperature
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  reg raw data
+ * @param[out] *celsius pointer to an ambient temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ta range convert to data failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_ta_range_convert_to_data(mlx90614_handle_t *handle, uint8_t reg, mlx90614_temperature_t *celsius);
+
+/**
+ * @brief     set the pwm ctrl
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *ctrl pointer to a pwm ctrl structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set pwm ctrl failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 repetition is over 31
+ *            - 5 period is over 127
+ * @note      the pwm ctrl is loaded at power on
+ */
+uint8_t mlx90614_set_pwm_ctrl(mlx90614_handle_t *handle, const mlx90614_pwm_ctrl_t *ctrl);
+
+/**
+ * @brief      get the pwm ctrl
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *ctrl pointer to a pwm ctrl structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get pwm ctrl failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mlx90614_get_pwm_ctrl(mlx90614_handle_t *handle, mlx90614_pwm_ctrl_t *ctrl);
+
+/**
+ * @brief     configure the thermal relay mode
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] threshold object temperature threshold
+ * @param[in] hysteresis hysteresis below the threshold
+ * @param[in] pin pwm or sda pin type
+ * @return    status code
+ *            - 0 success
+ *            - 1 set thermal relay failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 threshold is out of range
+ *            - 5 hysteresis is out of range
+ * @note      the pin goes active when the object temperature rises over threshold and goes back
+ *            when it falls under threshold - hysteresis, the output follows the mode in config1
+ *            only the cells that differ are written, so the call does not wear the eeprom when repeated
+ *            the setting is loaded at power on and the chip must not be switched to smbus by the host
+ */
+uint8_t mlx90614_set_thermal_relay(mlx90614_handle_t *handle, mlx90614_temperature_t threshold,
+                                   mlx90614_temperature_t hysteresis, mlx90614_pwm_pin_t pin);
+
+/**
+ * @brief      get the settling model of a filter setting
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  len fir length
+ * @param[in]  iir iir param
+ * @param[out] *frames pointer to a frames buffer
+ * @param[out] *ms pointer to a settling time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 settling model failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one conversion is modelled as MLX90614_WAKE_SETTLE_MS at fir length 1024 and half of it
+ *             for each shorter fir length, frames is the number of conversions the iir needs to come
+ *             within 1 % of a step, ms is frames times the conversion time
+ */
+uint8_t mlx90614_settling_model(mlx90614_handle_t *handle, mlx90614_fir_length_t len, mlx90614_iir_t iir,
+                                uint8_t *frames, uint32_t *ms);
+
+/**
+ * @brief      wait until the chip reports fresh data
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  frames number of fresh conversions to wait for, 0 means any valid data
+ * @param[in]  timeout_ms timeout in ms
+ * @param[out] *elapsed_ms pointer to an elapsed time buffer, NULL means unused
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timeout
+ * @note       data is valid when the init flag is done and the object register holds a value without
+ *             the error flag, a conversion is fresh when the raw ir channel 1 changes or the object
+ *             register turns valid after it was cleared, the chip is polled every MLX90614_READY_POLL_MS
+ *             and a nack or pec error while it is waking up is taken as not ready, the timeout and the
+ *             elapsed time are measured with get_time_ms when it is linked, else they only count the
+ *             poll delays and leave out the bus time of the reads
+ */
+uint8_t mlx90614_wait_ready(mlx90614_handle_t *handle, uint8_t frames, uint32_t timeout_ms, uint32_t *elapsed_ms);
+
+/**
+ * @brief      make sure the chip is awake and in smbus mode
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *path pointer to a start path buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       probes with one pec checked tobj1 read first, only a failed probe runs mlx90614_pwm_to_smbus
+ *             and probes again, and only a second failure runs mlx90614_exit_sleep_mode,
+ *             valid data is ready when it returns
+ */
+uint8_t mlx90614_start(mlx90614_handle_t *handle, mlx90614_start_path_t *path);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mlx90614_field_driver mlx90614 field driver function
+ * @brief    mlx90614 field driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief      get a register field
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  field register field
+ * @param[out] *value pointer to a field value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get field failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 field is invalid
+ * @note       none
+ */
+uint8_t mlx90614_get_field(mlx90614_handle_t *handle, mlx90614_field_t field, uint16_t *value);
+
+/**
+ * @brief     set a register field
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] field register field
+ * @param[in] value field value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set field failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field is invalid
+ *            - 5 value is over the field width
+ *            - 6 field is read only
+ * @note      the eeprom cell is only written if the field changes
+ */
+uint8_t mlx90614_set_field(mlx90614_handle_t *handle, mlx90614_field_t field, uint16_t value);
+
+/**
+ * @brief      get many register fields
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  *field pointer to a register field buffer
+ * @param[out] *value pointer to a field value buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 get fields failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 field is invalid
+ * @note       every register is read once
+ */
+uint8_t mlx90614_get_fields(mlx90614_handle_t *handle, const mlx90614_field_t *field, uint16_t *value, uint8_t len);
+
+/**
+ * @brief     set many register fields
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *field pointer to a register field buffer
+ * @param[in] *value pointer to a field value buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 set fields failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 field is invalid
+ *            - 5 value is over the field width
+ *            - 6 field is read only
+ * @note      all fields are checked before the bus is touched, every register is read once and
+ *            written once if any of its fields changes, so n config1 fields cost one eeprom cycle
+ */
+uint8_t mlx90614_set_fields(mlx90614_handle_t *handle, const mlx90614_field_t *field, const uint16_t *value, uint8_t len);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mlx90614_nonblocking_driver mlx90614 nonblocking driver function
+ * @brief    mlx90614 nonblocking driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief     start the exit from sleep mode request
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 exit sleep mode start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      sda is left low, call mlx90614_exit_sleep_mode_stop after MLX90614_WAKE_PULSE_MS
+ *            and wait for the first valid data with mlx90614_wait_ready
+ */
+uint8_t mlx90614_exit_sleep_mode_start(mlx90614_handle_t *handle);
+
+/**
+ * @brief     stop the exit from sleep mode request
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 exit sleep mode stop failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mlx90614_exit_sleep_mode_stop(mlx90614_handle_t *handle);
+
+/**
+ * @brief     erase an eeprom cell without waiting
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] reg eeprom register address
+ * @return    status code
+ *            - 0 success
+ *            - 1 eeprom erase failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 reg is not an eeprom register
+ *            - 5 eeprom write budget is exceeded
+ * @note      the cell is busy for MLX90614_EEPROM_WRITE_MS after this call,
+ *            the erase counts as the write of the cell against the budget
+ */
+uint8_t mlx90614_eeprom_erase(mlx90614_handle_t *handle, uint8_t reg);
+
+/**
+ * @brief     program an erased eeprom cell without waiting
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] reg eeprom register address
+ * @param[in] data written data
+ * @return    status code
+ *            - 0 success
+ *            - 1 eeprom program failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 reg is not an eeprom register
+ * @note      the cell must be erased by mlx90614_eeprom_erase at least MLX90614_EEPROM_WRITE_MS before
+ *            and is busy for MLX90614_EEPROM_WRITE_MS after this call
+ */
+uint8_t mlx90614_eeprom_program(mlx90614_handle_t *handle, uint8_t reg, uint16_t data);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mlx90614_eeprom_driver mlx90614 eeprom image driver function
+ * @brief    mlx90614 eeprom image driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief      dump the whole eeprom
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *image pointer to an eeprom image structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom dump failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       32 pec checked reads, the pec of every read is kept in the image, a coalesced cell
+ *             is dumped as programmed in the chip and not as its pending value
+ */
+uint8_t mlx90614_eeprom_dump(mlx90614_handle_t *handle, mlx90614_eeprom_image_t *image);
+
+/**
+ * @brief     check an eeprom image
+ * @param[in] *image pointer to an eeprom image structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ *            - 4 magic or version is invalid
+ *            - 5 pec is invalid
+ *            - 6 id doesn't match the id cells
+ * @note      none
+ */
+uint8_t mlx90614_eeprom_image_check(const mlx90614_eeprom_image_t *image);
+
+/**
+ * @brief      restore an eeprom image with the fewest writes
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[in]  *image pointer to an eeprom image structure
+ * @param[in]  mask cells to restore, MLX90614_EEPROM_CELL bits
+ * @param[out] *written pointer to a written cell number buffer, NULL is allowed
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom restore failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 image is invalid
+ *             - 5 mask has factory cells
+ *             - 6 read back verify failed
+ * @note       only the cells that differ from the live eeprom are erased and written and every written cell
+ *             is read back, factory calibration and id cells are refused, the address cell only takes the
+ *             low byte and the new address is used after the next power on, the writes are never
+ *             coalesced, a write beyond the budget fails and a restored cell drops its pending value
+ */
+uint8_t mlx90614_eeprom_restore(mlx90614_handle_t *handle, const mlx90614_eeprom_image_t *image,
+                                uint32_t mask, uint8_t *written);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mlx90614_wear_driver mlx90614 eeprom wear driver function
+ * @brief    mlx90614 eeprom wear driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief     set the eeprom write budget
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] writes eeprom writes allowed in one window, 0 means no limit
+ * @param[in] window_ms budget window in ms
+ * @param[in] policy what to do with the writes beyond the budget
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the window restarts now, the window needs the get_time_ms link to restart by itself,
+ *            a coalesced cell reads back its pending value until mlx90614_eeprom_flush writes it
+ */
+uint8_t mlx90614_set_eeprom_budget(mlx90614_handle_t *handle, uint32_t writes, uint32_t window_ms,
+                                   mlx90614_eeprom_policy_t policy);
+
+/**
+ * @brief      get the eeprom wear stats
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *stats pointer to an eeprom stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get eeprom stats failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       one write is one erase and write cycle of a cell
+ */
+uint8_t mlx90614_get_eeprom_stats(mlx90614_handle_t *handle, mlx90614_eeprom_stats_t *stats);
+
+/**
+ * @brief     load persisted eeprom write counters
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *writes pointer to a write counter buffer of MLX90614_EEPROM_SIZE cells
+ * @return    status code
+ *            - 0 success
+ *            - 1 set eeprom wear failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      save mlx90614_eeprom_stats_t.writes before deinit and load it after init
+ */
+uint8_t mlx90614_set_eeprom_wear(mlx90614_handle_t *handle, const uint32_t *writes);
+
+/**
+ * @brief      write the coalesced eeprom cells within the budget
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *left pointer to a left cell number buffer, NULL is allowed
+ * @return     status code
+ *             - 0 success
+ *             - 1 eeprom flush failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       call it periodically, the cells that still don't fit the budget are kept, left is the
+ *             number of cells still pending, including a cell whose write failed
+ */
+uint8_t mlx90614_eeprom_flush(mlx90614_handle_t *handle, uint8_t *left);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mlx90614_log_driver mlx90614 log driver function
+ * @brief    mlx90614 log driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief     log an event
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] level log level
+ * @param[in] event event code
+ * @param[in] arg event argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 no output is linked
+ *            - 2 handle is NULL
+ * @note      the linked log_event sink gets the event code and the argument unformatted,
+ *            without a sink the message is passed to debug_print
+ */
+uint8_t mlx90614_log(mlx90614_handle_t *handle, uint8_t level, mlx90614_event_t event, uint32_t arg);
+
+/**
+ * @brief      get the message text of an event
+ * @param[in]  event event code
+ * @param[out] **text pointer to a text pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 event is invalid
+ *             - 5 texts are not built in
+ * @note       lets a log_event sink format the events later, out of the driver call path,
+ *             the text has no "mlx90614: " prefix and no line end
+ */
+uint8_t mlx90614_get_event_text(mlx90614_event_t event, const char **text);
+
 /**
  * @}
  */
@@ -0,0 +1,653 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614.hpp
+ * @brief     driver mlx90614 header only c++17 wrapper
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_HPP
+#define DRIVER_MLX90614_HPP
+
+#include "driver_mlx90614.h"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#if __has_include("driver_mlx90614_interface.h")
+#include "driver_mlx90614_interface.h"
+#define MLX90614_HPP_HAS_INTERFACE        1        /**< the platform interface is available */
+#endif
+
+/**
+ * @defgroup mlx90614_cpp_driver mlx90614 c++ driver function
+ * @brief    mlx90614 header only c++17 driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+namespace mlx90614
+{
+
+/**
+ * @brief mlx90614 error enumeration definition
+ */
+enum class Error : uint8_t
+{
+    Bus   = 0x01,        /**< the transport failed */
+    Pec   = 0x02,        /**< pec error after all retries */
+    Flag  = 0x03,        /**< the object data has the error flag */
+    Range = 0x04,        /**< a parameter is out of range */
+    Ready = 0x05,        /**< no valid data before the timeout */
+};
+
+/**
+ * @brief mlx90614 unexpected structure definition
+ */
+struct Unexpected
+{
+    Error error;        /**< error code */
+};
+
+/**
+ * @brief     make an unexpected result
+ * @param[in] e error code
+ * @return    unexpected structure
+ * @note      none
+ */
+constexpr Unexpected unexpected(Error e) noexcept
+{
+    return Unexpected{e};
+}
+
+/**
+ * @brief mlx90614 result class definition
+ * @note  a small std::expected for c++17, it holds a value or an error and never throws
+ */
+template <typename T>
+class Result
+{
+    public:
+        constexpr Result(T value) : m_value(std::move(value)), m_error(Error::Bus) {}
+        constexpr Result(Unexpected u) : m_value(), m_error(u.error) {}
+        constexpr bool has_value() const noexcept { return m_value.has_value(); }
+        constexpr explicit operator bool() const noexcept { return m_value.has_value(); }
+        constexpr T &value() & { return *m_value; }
+        constexpr const T &value() const & { return *m_value; }
+        constexpr T &&value() && { return std::move(*m_value); }
+        constexpr T &operator*() & { return *m_value; }
+        constexpr const T &operator*() const & { return *m_value; }
+        constexpr T *operator->() { return &*m_value; }
+        constexpr const T *operator->() const { return &*m_value; }
+        constexpr T value_or(T other) const { return m_value.has_value() ? *m_value : other; }
+        constexpr Error error() const noexcept { return m_error; }
+    
+    private:
+        std::optional<T> m_value;        /**< value */
+        Error m_error;                   /**< error code without a value */
+};
+
+/**
+ * @brief mlx90614 void result class definition
+ */
+template <>
+class Result<void>
+{
+    public:
+        constexpr Result() : m_ok(true), m_error(Error::Bus) {}
+        constexpr Result(Unexpected u) : m_ok(false), m_error(u.error) {}
+        constexpr bool has_value() const noexcept { return m_ok; }
+        constexpr explicit operator bool() const noexcept { return m_ok; }
+        constexpr Error error() const noexcept { return m_error; }
+    
+    private:
+        bool m_ok;            /**< success flag */
+        Error m_error;        /**< error code on failure */
+};
+
+/**
+ * @brief mlx90614 mode enumeration definition
+ * @note  the strongly typed enumerations keep the values of the c driver
+ */
+enum class Mode : uint8_t
+{
+    TaTobj1    = MLX90614_MODE_TA_TOBJ1,           /**< ta and tobj1 mode */
+    TaTobj2    = MLX90614_MODE_TA_TOBJ2,           /**< ta and tobj2 mode */
+    Tobj2      = MLX90614_MODE_TOBJ2,              /**< tobj2 mode */
+    Tobj1Tobj2 = MLX90614_MODE_TOBJ1_TOBJ2,        /**< tobj1 and tobj2 mode */
+};
+
+/**
+ * @brief mlx90614 gain enumeration definition
+ */
+enum class Gain : uint8_t
+{
+    G1    = MLX90614_GAIN_1,           /**< gain 1 */
+    G3    = MLX90614_GAIN_3,           /**< gain 3 */
+    G6    = MLX90614_GAIN_6,           /**< gain 6 */
+    G12p5 = MLX90614_GAIN_12P5,        /**< gain 12.5 */
+    G25   = MLX90614_GAIN_25,          /**< gain 25 */
+    G50   = MLX90614_GAIN_50,          /**< gain 50 */
+    G100  = MLX90614_GAIN_100,         /**< gain 100 */
+};
+
+/**
+ * @brief mlx90614 kt2 enumeration definition
+ */
+enum class Kt2 : uint8_t
+{
+    Positive = MLX90614_KT2_POSITIVE,        /**< positive */
+    Negative = MLX90614_KT2_NEGATIVE,        /**< negative */
+};
+
+/**
+ * @brief mlx90614 ks enumeration definition
+ */
+enum class Ks : uint8_t
+{
+    Positive = MLX90614_KS_POSITIVE,        /**< positive */
+    Negative = MLX90614_KS_NEGATIVE,        /**< negative */
+};
+
+/**
+ * @brief mlx90614 ir sensor enumeration definition
+ */
+enum class IrSensor : uint8_t
+{
+    Single = MLX90614_IR_SENSOR_SINGLE,        /**< single ir sensor */
+    Dual   = MLX90614_IR_SENSOR_DUAL,          /**< dual ir sensor */
+};
+
+/**
+ * @brief mlx90614 fir length enumeration definition
+ */
+enum class FirLength : uint8_t
+{
+    L8    = MLX90614_FIR_LENGTH_8,           /**< length 8 */
+    L16   = MLX90614_FIR_LENGTH_16,          /**< length 16 */
+    L32   = MLX90614_FIR_LENGTH_32,          /**< length 32 */
+    L64   = MLX90614_FIR_LENGTH_64,          /**< length 64 */
+    L128  = MLX90614_FIR_LENGTH_128,         /**< length 128 */
+    L256  = MLX90614_FIR_LENGTH_256,         /**< length 256 */
+    L512  = MLX90614_FIR_LENGTH_512,         /**< length 512 */
+    L1024 = MLX90614_FIR_LENGTH_1024,        /**< length 1024 */
+};
+
+/**
+ * @brief mlx90614 iir enumeration definition
+ */
+enum class Iir : uint8_t
+{
+    A1_0p5_B1_0p5     = MLX90614_IIR_A1_0P5_B1_0P5,            /**< a1 = 0.5 b1 = 0.5 */
+    A1_0p25_B1_0p75   = MLX90614_IIR_A1_0P25_B1_0P75,          /**< a1 = 0.25 b1 = 0.75 */
+    A1_0p166_B1_0p83  = MLX90614_IIR_A1_0P166_B1_0P83,         /**< a1 = 0.166 b1 = 0.83 */
+    A1_0p125_B1_0p875 = MLX90614_IIR_A1_0P125_B1_0P875,        /**< a1 = 0.125 b1 = 0.875 */
+    A1_1_B1_0         = MLX90614_IIR_A1_1_B1_0,                /**< a1 = 1 b1 = 0 */
+    A1_0p8_B1_0p2     = MLX90614_IIR_A1_0P8_B1_0P2,            /**< a1 = 0.8 b1 = 0.2 */
+    A1_0p666_B1_0p333 = MLX90614_IIR_A1_0P666_B1_0P333,        /**< a1 = 0.666 b1 = 0.333 */
+    A1_0p571_B1_0p428 = MLX90614_IIR_A1_0P571_B1_0P428,        /**< a1 = 0.571 b1 = 0.428 */
+};
+
+/**
+ * @brief mlx90614 sample structure definition
+ */
+struct Sample
+{
+    mlx90614_temperature_t ambient;        /**< ambient temperature */
+    mlx90614_temperature_t object;         /**< object temperature */
+};
+
+namespace detail
+{
+
+/**
+ * @brief mlx90614 register definition
+ */
+constexpr uint8_t REG_RAM_TA         = 0x06;        /**< ram ta register */
+constexpr uint8_t REG_RAM_TOBJ1      = 0x07;        /**< ram tobj1 register */
+constexpr uint8_t REG_RAM_TOBJ2      = 0x08;        /**< ram tobj2 register */
+constexpr uint8_t REG_EEPROM_CONFIG1 = 0x25;        /**< eeprom config1 register */
+constexpr uint8_t REG_EEPROM_ID1     = 0x3C;        /**< eeprom id1 number register */
+constexpr uint8_t COMMAND_SLEEP      = 0xFF;        /**< enter sleep command */
+
+/**
+ * @brief     calculate the smbus pec of one byte
+ * @param[in] crc current crc
+ * @param[in] byte input byte
+ * @return    next crc
+ * @note      crc-8 with the polynomial x^8 + x^2 + x + 1
+ */
+constexpr uint8_t crc8(uint8_t crc, uint8_t byte) noexcept
+{
+    crc = static_cast<uint8_t>(crc ^ byte);
+    for (int i = 0; i < 8; i++)
+    {
+        crc = static_cast<uint8_t>(((crc & 0x80U) != 0) ? ((crc << 1) ^ 0x07U) : (crc << 1));
+    }
+    
+    return crc;
+}
+
+/**
+ * @brief     convert a raw temperature to celsius
+ * @param[in] raw raw data
+ * @return    celsius
+ * @note      the same arithmetic as the c driver
+ */
+constexpr mlx90614_temperature_t to_celsius(uint16_t raw) noexcept
+{
+#ifdef MLX90614_FIXED_POINT
+    return static_cast<int32_t>(raw) * (MLX90614_FIXED_POINT / 50) - 27315 * (MLX90614_FIXED_POINT / 100);
+#else
+    return static_cast<float>(raw) * 0.02f - 273.15f;
+#endif
+}
+
+static_assert(crc8(crc8(crc8(crc8(crc8(0, 0xB4), 0x07), 0xB5), 0xD2), 0x3A) == 0x30, "the pec example of the datasheet");
+
+}
+
+#ifdef MLX90614_HPP_HAS_INTERFACE
+/**
+ * @brief mlx90614 interface transport structure definition
+ * @note  binds the platform interface functions at compile time
+ */
+struct InterfaceTransport
+{
+    static uint8_t iic_init() { return mlx90614_interface_iic_init(); }
+    static uint8_t iic_deinit() { return mlx90614_interface_iic_deinit(); }
+    static uint8_t iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len) { return mlx90614_interface_iic_read(addr, reg, buf, len); }
+    static uint8_t iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len) { return mlx90614_interface_iic_write(addr, reg, buf, len); }
+    static uint8_t scl_write(uint8_t v) { return mlx90614_interface_scl_write(v); }
+    static uint8_t sda_write(uint8_t v) { return mlx90614_interface_sda_write(v); }
+    static void delay_ms(uint32_t ms) { mlx90614_interface_delay_ms(ms); }
+};
+#endif
+
+/**
+ * @brief mlx90614 driver class definition
+ * @note  Transport is a policy type with the static functions iic_init, iic_deinit, iic_read, iic_write,
+ *        scl_write, sda_write and delay_ms of the c interface, every bus access is a direct call
+ *        the compiler can inline, the bus is inited by open and deinited by the destructor
+ */
+template <typename Transport>
+class Mlx90614
+{
+    public:
+        /**
+         * @brief     open a chip
+         * @param[in] addr iic address
+         * @return    driver object or Error::Bus
+         * @note      none
+         */
+        static Result<Mlx90614> open(uint8_t addr = MLX90614_ADDRESS_DEFAULT)
+        {
+            if (Transport::iic_init() != 0)
+            {
+                return unexpected(Error::Bus);
+            }
+            
+            return Mlx90614(addr);
+        }
+        
+        Mlx90614(const Mlx90614 &) = delete;
+        Mlx90614 &operator=(const Mlx90614 &) = delete;
+        
+        Mlx90614(Mlx90614 &&other) noexcept : m_addr(other.m_addr), m_open(std::exchange(other.m_open, false)) {}
+        
+        Mlx90614 &operator=(Mlx90614 &&other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                m_addr = other.m_addr;
+                m_open = std::exchange(other.m_open, false);
+            }
+            
+            return *this;
+        }
+        
+        ~Mlx90614()
+        {
+            close();
+        }
+        
+        /**
+         * @brief  get the iic address
+         * @return iic address
+         * @note   none
+         */
+        uint8_t address() const noexcept
+        {
+            return m_addr;
+        }
+        
+        /**
+         * @brief     read a register
+         * @param[in] command register address
+         * @return    register data, Error::Bus or Error::Pec
+         * @note      a pec error is retried 3 times like the c driver
+         */
+        Result<uint16_t> read_reg(uint8_t command) const
+        {
+            for (int times = 3; ; times--)
+            {
+                uint8_t buf[3] = {0, 0, 0};
+                
+                if (Transport::iic_read(m_addr, command, buf, 3) != 0)
+                {
+                    return unexpected(Error::Bus);
+                }
+                uint8_t pec = detail::crc8(detail::crc8(detail::crc8(0, m_addr), command), static_cast<uint8_t>(m_addr + 1));
+                pec = detail::crc8(detail::crc8(pec, buf[0]), buf[1]);
+                if (pec == buf[2])
+                {
+                    return static_cast<uint16_t>((static_cast<uint16_t>(buf[1]) << 8) | buf[0]);
+                }
+                if (times == 0)
+                {
+                    return unexpected(Error::Pec);
+                }
+                Transport::delay_ms(5);
+            }
+        }
+        
+        /**
+         * @brief     write a register word
+         * @param[in] command register address
+         * @param[in] data written data
+         * @return    nothing or Error::Bus
+         * @note      one bus write without any wait, an eeprom cell must be erased with 0 first
+         */
+        Result<void> write_word(uint8_t command, uint16_t data)
+        {
+            uint8_t buf[3];
+            
+            buf[0] = static_cast<uint8_t>(data & 0xFFU);
+            buf[1] = static_cast<uint8_t>(data >> 8);
+            buf[2] = detail::crc8(detail::crc8(detail::crc8(detail::crc8(0, m_addr), command), buf[0]), buf[1]);
+            if (Transport::iic_write(m_addr, command, buf, 3) != 0)
+            {
+                return unexpected(Error::Bus);
+            }
+            
+            return {};
+        }
+        
+        /**
+         * @brief     write an eeprom register
+         * @param[in] command register address
+         * @param[in] data written data
+         * @return    nothing or Error::Bus
+         * @note      erases the cell and writes it, each step waits MLX90614_EEPROM_WRITE_MS
+         */
+        Result<void> write_eeprom(uint8_t command, uint16_t data)
+        {
+            if (!write_word(command, 0x0000))
+            {
+                return unexpected(Error::Bus);
+            }
+            Transport::delay_ms(MLX90614_EEPROM_WRITE_MS);
+            if (!write_word(command, data))
+            {
+                return unexpected(Error::Bus);
+            }
+            Transport::delay_ms(MLX90614_EEPROM_WRITE_MS);
+            
+            return {};
+        }
+        
+        /**
+         * @brief  read the ambient temperature
+         * @return celsius or an error
+         * @note   none
+         */
+        Result<mlx90614_temperature_t> read_ambient() const
+        {
+            Result<uint16_t> raw = read_reg(detail::REG_RAM_TA);
+            
+            if (!raw)
+            {
+                return unexpected(raw.error());
+            }
+            
+            return detail::to_celsius(*raw);
+        }
+        
+        /**
+         * @brief  read the object1 temperature
+         * @return celsius or an error
+         * @note   none
+         */
+        Result<mlx90614_temperature_t> read_object1() const
+        {
+            return read_object(detail::REG_RAM_TOBJ1);
+        }
+        
+        /**
+         * @brief  read the object2 temperature
+         * @return celsius or an error
+         * @note   none
+         */
+        Result<mlx90614_temperature_t> read_object2() const
+        {
+            return read_object(detail::REG_RAM_TOBJ2);
+        }
+        
+        /**
+         * @brief  read the ambient and the object1 temperature
+         * @return sample or an error
+         * @note   the same bus traffic as mlx90614_basic_read
+         */
+        Result<Sample> read() const
+        {
+            Result<mlx90614_temperature_t> ambient = read_ambient();
+            
+            if (!ambient)
+            {
+                return unexpected(ambient.error());
+            }
+            Result<mlx90614_temperature_t> object = read_object1();
+            if (!object)
+            {
+                return unexpected(object.error());
+            }
+            
+            return Sample{*ambient, *object};
+        }
+        
+        /**
+         * @brief  read the chip id
+         * @return 4 id words or an error
+         * @note   none
+         */
+        Result<std::array<uint16_t, 4>> id() const
+        {
+            std::array<uint16_t, 4> out{};
+            
+            for (uint8_t i = 0; i < 4; i++)
+            {
+                Result<uint16_t> word = read_reg(static_cast<uint8_t>(detail::REG_EEPROM_ID1 + i));
+                
+                if (!word)
+                {
+                    return unexpected(word.error());
+                }
+                out[i] = *word;
+            }
+            
+            return out;
+        }
+        
+        Result<Mode> mode() const { return get_field<Mode, 4, 2>(); }
+        Result<void> set_mode(Mode v) { return set_field<Mode, 4, 2>(v); }
+        Result<IrSensor> ir_sensor() const { return get_field<IrSensor, 6, 1>(); }
+        Result<void> set_ir_sensor(IrSensor v) { return set_field<IrSensor, 6, 1>(v); }
+        Result<Ks> ks() const { return get_field<Ks, 7, 1>(); }
+        Result<void> set_ks(Ks v) { return set_field<Ks, 7, 1>(v); }
+        Result<FirLength> fir_length() const { return get_field<FirLength, 8, 3>(); }
+        Result<void> set_fir_length(FirLength v) { return set_field<FirLength, 8, 3>(v); }
+        Result<Iir> iir() const { return get_field<Iir, 0, 3>(); }
+        Result<void> set_iir(Iir v) { return set_field<Iir, 0, 3>(v); }
+        Result<Gain> gain() const { return get_field<Gain, 11, 3>(); }
+        Result<void> set_gain(Gain v) { return set_field<Gain, 11, 3>(v); }
+        Result<Kt2> kt2() const { return get_field<Kt2, 14, 1>(); }
+        Result<void> set_kt2(Kt2 v) { return set_field<Kt2, 14, 1>(v); }
+        
+        /**
+         * @brief  enter the sleep mode
+         * @return nothing or Error::Bus
+         * @note   none
+         */
+        Result<void> enter_sleep()
+        {
+            uint8_t pec = detail::crc8(detail::crc8(0, m_addr), detail::COMMAND_SLEEP);
+            
+            if (Transport::iic_write(m_addr, detail::COMMAND_SLEEP, &pec, 1) != 0)
+            {
+                return unexpected(Error::Bus);
+            }
+            
+            return {};
+        }
+        
+        /**
+         * @brief  exit the sleep mode
+         * @return nothing or an error
+         * @note   sends the wake up request and polls tobj1 until the first valid data
+         */
+        Result<void> exit_sleep()
+        {
+            if ((Transport::scl_write(1) != 0) || (Transport::sda_write(1) != 0))
+            {
+                return unexpected(Error::Bus);
+            }
+            Transport::delay_ms(1);
+            if (Transport::sda_write(0) != 0)
+            {
+                return unexpected(Error::Bus);
+            }
+            Transport::delay_ms(MLX90614_WAKE_PULSE_MS);
+            if (Transport::sda_write(1) != 0)
+            {
+                return unexpected(Error::Bus);
+            }
+            for (uint32_t elapsed = 0; elapsed <= MLX90614_READY_TIMEOUT_MS; elapsed += MLX90614_READY_POLL_MS)
+            {
+                Result<uint16_t> raw = read_reg(detail::REG_RAM_TOBJ1);
+                
+                if (raw && (*raw != 0) && ((*raw & 0x8000U) == 0))
+                {
+                    return {};
+                }
+                Transport::delay_ms(MLX90614_READY_POLL_MS);
+            }
+            
+            return unexpected(Error::Ready);
+        }
+    
+    private:
+        explicit Mlx90614(uint8_t addr) noexcept : m_addr(addr), m_open(true) {}
+        
+        void close() noexcept
+        {
+            if (m_open)
+            {
+                (void)Transport::iic_deinit();
+                m_open = false;
+            }
+        }
+        
+        Result<mlx90614_temperature_t> read_object(uint8_t command) const
+        {
+            Result<uint16_t> raw = read_reg(command);
+            
+            if (!raw)
+            {
+                return unexpected(raw.error());
+            }
+            if ((*raw & 0x8000U) != 0)
+            {
+                return unexpected(Error::Flag);
+            }
+            
+            return detail::to_celsius(*raw);
+        }
+        
+        template <typename E, unsigned Shift, unsigned Width>
+        Result<E> get_field() const
+        {
+            Result<uint16_t> reg = read_reg(detail::REG_EEPROM_CONFIG1);
+            
+            if (!reg)
+            {
+                return unexpected(reg.error());
+            }
+            
+            return static_cast<E>((*reg >> Shift) & ((1U << Width) - 1U));
+        }
+        
+        template <typename E, unsigned Shift, unsigned Width>
+        Result<void> set_field(E value)
+        {
+            constexpr uint16_t mask = static_cast<uint16_t>(((1U << Width) - 1U) << Shift);
+            Result<uint16_t> reg = read_reg(detail::REG_EEPROM_CONFIG1);
+            
+            if (static_cast<unsigned>(value) >= (1U << Width))
+            {
+                return unexpected(Error::Range);
+            }
+            if (!reg)
+            {
+                return unexpected(reg.error());
+            }
+            uint16_t data = static_cast<uint16_t>((*reg & ~mask) | (static_cast<unsigned>(value) << Shift));
+            if (data == *reg)
+            {
+                return {};
+            }
+            
+            return write_eeprom(detail::REG_EEPROM_CONFIG1, data);
+        }
+        
+        uint8_t m_addr;        /**< iic address */
+        bool m_open;           /**< the object owns the bus */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
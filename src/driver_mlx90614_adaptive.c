@@ -0,0 +1,283 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_adaptive.c
+ * @brief     driver mlx90614 adaptive sampling source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_adaptive.h"
+
+/**
+ * @brief      get the default adaptive sampling config
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get default failed
+ * @note       none
+ */
+uint8_t mlx90614_adaptive_config_default(mlx90614_adaptive_config_t *config)
+{
+    if (config == NULL)                                                           /* check the config */
+    {
+        return 1;                                                                 /* return error */
+    }
+    
+    config->min_period_ms = MLX90614_ADAPTIVE_DEFAULT_MIN_PERIOD_MS;              /* set the fastest period */
+    config->max_period_ms = MLX90614_ADAPTIVE_DEFAULT_MAX_PERIOD_MS;              /* set the slowest period */
+    config->read_us = MLX90614_ADAPTIVE_DEFAULT_READ_US;                          /* set the read time */
+    config->rate = MLX90614_ADAPTIVE_DEFAULT_RATE;                                /* set the rate threshold */
+    config->deviation = MLX90614_ADAPTIVE_DEFAULT_DEVIATION;                      /* set the deviation threshold */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     init the adaptive sampler
+ * @param[in] *adaptive pointer to an adaptive sampling structure
+ * @param[in] *handle pointer to an inited mlx90614 handle structure
+ * @param[in] *config pointer to a config, NULL means the defaults
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 config is invalid
+ * @note      reads the fir and iir setting once, the floor is the conversion time of the chip,
+ *            sampling faster would only read the same data again
+ */
+uint8_t mlx90614_adaptive_init(mlx90614_adaptive_t *adaptive, mlx90614_handle_t *handle, const mlx90614_adaptive_config_t *config)
+{
+    uint8_t frames;
+    uint32_t ms;
+    mlx90614_fir_length_t len;
+    mlx90614_iir_t iir;
+    
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                      /* check handle initialization */
+    {
+        return 3;                                                                 /* return error */
+    }
+    if (adaptive == NULL)                                                         /* check adaptive */
+    {
+        return 1;                                                                 /* return error */
+    }
+    
+    memset(adaptive, 0, sizeof(mlx90614_adaptive_t));                             /* clear the sampler */
+    if (config != NULL)                                                           /* check the config */
+    {
+        adaptive->config = *config;                                               /* save the config */
+    }
+    else
+    {
+        (void)mlx90614_adaptive_config_default(&adaptive->config);                /* set the defaults */
+    }
+    if ((adaptive->config.min_period_ms == 0) ||
+        (adaptive->config.max_period_ms < adaptive->config.min_period_ms) ||
+        (adaptive->config.rate <= 0) || (adaptive->config.deviation <= 0))        /* check the config */
+    {
+        return 4;                                                                 /* return error */
+    }
+    
+    if (mlx90614_get_fir_length(handle, &len) != 0)                               /* get the fir length */
+    {
+        return 1;                                                                 /* return error */
+    }
+    if (mlx90614_get_iir(handle, &iir) != 0)                                      /* get the iir */
+    {
+        return 1;                                                                 /* return error */
+    }
+    if (mlx90614_settling_model(handle, len, iir, &frames, &ms) != 0)             /* get the settling model */
+    {
+        return 1;                                                                 /* return error */
+    }
+    adaptive->handle = handle;                                                    /* save the handle */
+    adaptive->refresh_ms = (frames != 0) ? (ms / frames) : ms;                    /* one conversion */
+    adaptive->floor_ms = adaptive->config.min_period_ms;                          /* set the floor */
+    if (adaptive->floor_ms < adaptive->refresh_ms)                                /* not faster than the chip */
+    {
+        adaptive->floor_ms = adaptive->refresh_ms;                                /* raise the floor */
+    }
+    if (adaptive->config.max_period_ms < adaptive->floor_ms)                      /* check the max period */
+    {
+        adaptive->config.max_period_ms = adaptive->floor_ms;                      /* raise the max period */
+    }
+    adaptive->period_ms = adaptive->floor_ms;                                     /* start fast */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      read one sample and get the time to the next one
+ * @param[in]  *adaptive pointer to an adaptive sampling structure
+ * @param[out] *ambient_raw pointer to an ambient raw data buffer
+ * @param[out] *ambient pointer to an ambient temperature buffer
+ * @param[out] *object_raw pointer to an object raw data buffer
+ * @param[out] *object pointer to an object temperature buffer
+ * @param[out] *next_ms pointer to a next period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample failed
+ *             - 4 object data has the error flag
+ * @note       a rate of change over the rate threshold or a deviation over the deviation threshold
+ *             drops the period to the floor, a stable sample grows it by 1/4 up to the max period,
+ *             the caller waits next_ms before the next call, a failed sample keeps the period
+ */
+uint8_t mlx90614_adaptive_sample(mlx90614_adaptive_t *adaptive, uint16_t *ambient_raw, mlx90614_temperature_t *ambient,
+                                 uint16_t *object_raw, mlx90614_temperature_t *object, uint32_t *next_ms)
+{
+    uint8_t res;
+    uint8_t fast;
+#ifdef MLX90614_FIXED_POINT
+    int64_t d;
+    int64_t rate;
+    int64_t limit;
+#else
+    float d;
+    float rate;
+#endif
+    
+    if ((adaptive == NULL) || (adaptive->handle == NULL) || (next_ms == NULL))    /* check the sampler */
+    {
+        return 1;                                                                 /* return error */
+    }
+    
+    *next_ms = adaptive->period_ms;                                               /* keep the period on failure */
+    if ((adaptive->samples != 0) || (adaptive->failures != 0))                    /* a period was waited */
+    {
+        adaptive->elapsed_ms += adaptive->period_ms;                              /* count the time */
+    }
+    res = mlx90614_read_ambient(adaptive->handle, ambient_raw, ambient);          /* read the ambient */
+    if (res == 0)
+    {
+        res = mlx90614_read_object1(adaptive->handle, object_raw, object);        /* read the object */
+    }
+    if (res != 0)                                                                 /* check the result */
+    {
+        adaptive->failures++;                                                     /* count the failure */
+        
+        return (res == 4) ? 4 : 1;                                                /* return error */
+    }
+    
+    if (adaptive->samples == 0)                                                   /* first sample */
+    {
+        adaptive->mean = *object;                                                 /* start the mean */
+        adaptive->var = 0;                                                        /* no variance */
+        fast = 1;                                                                 /* stay at the floor */
+    }
+    else
+    {
+#ifdef MLX90614_FIXED_POINT
+        d = (int64_t)(*object) - (int64_t)adaptive->last;                         /* step since the last sample */
+        rate = ((d < 0) ? -d : d) * 1000 / adaptive->period_ms;                   /* rate per second */
+        d = (int64_t)(*object) - adaptive->mean;                                  /* deviation from the mean */
+        adaptive->mean += d / 8;                                                  /* update the mean */
+        adaptive->var = adaptive->var - adaptive->var / 8 + d * d / 8;            /* update the variance */
+        limit = (int64_t)adaptive->config.deviation * adaptive->config.deviation; /* deviation squared */
+        fast = (uint8_t)((rate > adaptive->config.rate) || (adaptive->var > limit)); /* check the thresholds */
+#else
+        d = *object - adaptive->last;                                             /* step since the last sample */
+        rate = ((d < 0.0f) ? -d : d) * 1000.0f / (float)adaptive->period_ms;      /* rate per second */
+        d = *object - adaptive->mean;                                             /* deviation from the mean */
+        adaptive->mean += d * 0.125f;                                             /* update the mean */
+        adaptive->var = adaptive->var - adaptive->var * 0.125f + d * d * 0.125f;  /* update the variance */
+        fast = (uint8_t)((rate > adaptive->config.rate) ||
+                         (adaptive->var > adaptive->config.deviation * adaptive->config.deviation)); /* check the thresholds */
+#endif
+    }
+    adaptive->last = *object;                                                     /* save the sample */
+    adaptive->samples++;                                                          /* count the sample */
+    
+    if (fast != 0)                                                                /* signal moves */
+    {
+        if (adaptive->samples > 1)                                                /* not the first sample */
+        {
+            adaptive->triggers++;                                                 /* count the trigger */
+        }
+        adaptive->period_ms = adaptive->floor_ms;                                 /* sample at the floor */
+    }
+    else                                                                          /* signal is stable */
+    {
+        adaptive->period_ms += adaptive->period_ms / 4 + 1;                       /* back off */
+        if (adaptive->period_ms > adaptive->config.max_period_ms)                 /* check the max period */
+        {
+            adaptive->period_ms = adaptive->config.max_period_ms;                 /* limit the period */
+        }
+    }
+    *next_ms = adaptive->period_ms;                                               /* set the next period */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the adaptive sampling stats
+ * @param[in]  *adaptive pointer to an adaptive sampling structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       the saving is counted against sampling at the floor period for the same time,
+ *             both start with one sample, one sample is two word reads
+ */
+uint8_t mlx90614_adaptive_get_stats(mlx90614_adaptive_t *adaptive, mlx90614_adaptive_stats_t *stats)
+{
+    uint64_t taken;
+    
+    if ((adaptive == NULL) || (stats == NULL) || (adaptive->floor_ms == 0))       /* check the params */
+    {
+        return 1;                                                                 /* return error */
+    }
+    
+    memset(stats, 0, sizeof(mlx90614_adaptive_stats_t));                          /* clear the stats */
+    stats->samples = adaptive->samples;                                           /* set the samples */
+    stats->failures = adaptive->failures;                                         /* set the failures */
+    stats->triggers = adaptive->triggers;                                         /* set the triggers */
+    stats->refresh_ms = adaptive->refresh_ms;                                     /* set the refresh period */
+    stats->floor_ms = adaptive->floor_ms;                                         /* set the floor */
+    stats->period_ms = adaptive->period_ms;                                       /* set the period */
+    taken = (uint64_t)adaptive->samples + adaptive->failures;                     /* samples taken */
+    if (taken != 0)                                                               /* check the samples */
+    {
+        stats->fixed_samples = adaptive->elapsed_ms / adaptive->floor_ms + 1;     /* first sample and one a floor period */
+    }
+    if (stats->fixed_samples > taken)                                             /* check the saving */
+    {
+        stats->saved_samples = stats->fixed_samples - taken;                      /* samples not taken */
+        stats->saved_bus_us = stats->saved_samples * 2 * adaptive->config.read_us; /* two reads a sample */
+        stats->saved_ppm = (uint32_t)(stats->saved_samples * 1000000 / stats->fixed_samples); /* saved share */
+    }
+    
+    return 0;                                                                     /* success return 0 */
+}
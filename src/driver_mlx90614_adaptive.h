@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_adaptive.h
+ * @brief     driver mlx90614 adaptive sampling header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_ADAPTIVE_H
+#define DRIVER_MLX90614_ADAPTIVE_H
+
+#include "driver_mlx90614.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_adaptive_driver mlx90614 adaptive sampling driver function
+ * @brief    mlx90614 adaptive sampling driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 adaptive sampling default definition
+ * @note  a word read is about 57 bit times, 570 us at 100 kHz
+ */
+#define MLX90614_ADAPTIVE_DEFAULT_MIN_PERIOD_MS        100         /**< fastest period in ms */
+#define MLX90614_ADAPTIVE_DEFAULT_MAX_PERIOD_MS        5000        /**< slowest period in ms */
+#define MLX90614_ADAPTIVE_DEFAULT_READ_US              570         /**< bus time of one word read in us */
+#ifdef MLX90614_FIXED_POINT
+#define MLX90614_ADAPTIVE_DEFAULT_RATE                 (MLX90614_FIXED_POINT / 2)         /**< 0.5 C/s */
+#define MLX90614_ADAPTIVE_DEFAULT_DEVIATION            (MLX90614_FIXED_POINT / 5)         /**< 0.2 C */
+#else
+#define MLX90614_ADAPTIVE_DEFAULT_RATE                 0.5f        /**< 0.5 C/s */
+#define MLX90614_ADAPTIVE_DEFAULT_DEVIATION            0.2f        /**< 0.2 C */
+#endif
+
+/**
+ * @brief mlx90614 adaptive sampling config structure definition
+ */
+typedef struct mlx90614_adaptive_config_s
+{
+    uint32_t min_period_ms;                         /**< fastest period in ms, raised to the chip refresh period */
+    uint32_t max_period_ms;                         /**< slowest period in ms */
+    uint32_t read_us;                               /**< bus time of one word read in us */
+    mlx90614_temperature_t rate;                    /**< object rate of change threshold per second */
+    mlx90614_temperature_t deviation;               /**< object standard deviation threshold */
+} mlx90614_adaptive_config_t;
+
+/**
+ * @brief mlx90614 adaptive sampling structure definition
+ */
+typedef struct mlx90614_adaptive_s
+{
+    mlx90614_handle_t *handle;                      /**< sensor handle */
+    mlx90614_adaptive_config_t config;              /**< config */
+    uint32_t refresh_ms;                            /**< chip refresh period in ms */
+    uint32_t floor_ms;                              /**< fastest period in ms */
+    uint32_t period_ms;                             /**< current period in ms */
+    mlx90614_temperature_t last;                    /**< last object temperature */
+#ifdef MLX90614_FIXED_POINT
+    int64_t mean;                                   /**< object mean */
+    int64_t var;                                    /**< object variance */
+#else
+    float mean;                                     /**< object mean */
+    float var;                                      /**< object variance */
+#endif
+    uint32_t samples;                               /**< valid samples */
+    uint32_t failures;                              /**< failed samples */
+    uint32_t triggers;                              /**< samples over a threshold */
+    uint64_t elapsed_ms;                            /**< time waited between the samples in ms */
+} mlx90614_adaptive_t;
+
+/**
+ * @brief mlx90614 adaptive sampling stats structure definition
+ */
+typedef struct mlx90614_adaptive_stats_s
+{
+    uint32_t samples;                               /**< valid samples */
+    uint32_t failures;                              /**< failed samples */
+    uint32_t triggers;                              /**< samples over a threshold */
+    uint32_t refresh_ms;                            /**< chip refresh period in ms */
+    uint32_t floor_ms;                              /**< fastest period in ms */
+    uint32_t period_ms;                             /**< current period in ms */
+    uint64_t fixed_samples;                         /**< samples a fixed floor period would take */
+    uint64_t saved_samples;                         /**< samples not taken */
+    uint64_t saved_bus_us;                          /**< bus time saved in us */
+    uint32_t saved_ppm;                             /**< saved share of the fixed bus time in ppm */
+} mlx90614_adaptive_stats_t;
+
+/**
+ * @brief      get the default adaptive sampling config
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get default failed
+ * @note       none
+ */
+uint8_t mlx90614_adaptive_config_default(mlx90614_adaptive_config_t *config);
+
+/**
+ * @brief     init the adaptive sampler
+ * @param[in] *adaptive pointer to an adaptive sampling structure
+ * @param[in] *handle pointer to an inited mlx90614 handle structure
+ * @param[in] *config pointer to a config, NULL means the defaults
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 config is invalid
+ * @note      reads the fir and iir setting once, the floor is the conversion time of the chip,
+ *            sampling faster would only read the same data again
+ */
+uint8_t mlx90614_adaptive_init(mlx90614_adaptive_t *adaptive, mlx90614_handle_t *handle, const mlx90614_adaptive_config_t *config);
+
+/**
+ * @brief      read one sample and get the time to the next one
+ * @param[in]  *adaptive pointer to an adaptive sampling structure
+ * @param[out] *ambient_raw pointer to an ambient raw data buffer
+ * @param[out] *ambient pointer to an ambient temperature buffer
+ * @param[out] *object_raw pointer to an object raw data buffer
+ * @param[out] *object pointer to an object temperature buffer
+ * @param[out] *next_ms pointer to a next period buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample failed
+ *             - 4 object data has the error flag
+ * @note       a rate of change over the rate threshold or a deviation over the deviation threshold
+ *             drops the period to the floor, a stable sample grows it by 1/4 up to the max period,
+ *             the caller waits next_ms before the next call, a failed sample keeps the period
+ */
+uint8_t mlx90614_adaptive_sample(mlx90614_adaptive_t *adaptive, uint16_t *ambient_raw, mlx90614_temperature_t *ambient,
+                                 uint16_t *object_raw, mlx90614_temperature_t *object, uint32_t *next_ms);
+
+/**
+ * @brief      get the adaptive sampling stats
+ * @param[in]  *adaptive pointer to an adaptive sampling structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       the saving is counted against sampling at the floor period for the same time,
+ *             both start with one sample, one sample is two word reads
+ */
+uint8_t mlx90614_adaptive_get_stats(mlx90614_adaptive_t *adaptive, mlx90614_adaptive_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
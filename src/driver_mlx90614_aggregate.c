@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_aggregate.c
+ * @brief     driver mlx90614 aggregate source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_aggregate.h"
+
+/**
+ * @brief     emit the window that ends with the current pane
+ * @param[in] *aggregate pointer to an aggregate structure
+ * @param[in] index window index
+ * @note      nothing is emitted for a window without samples
+ */
+static void a_mlx90614_aggregate_emit(mlx90614_aggregate_t *aggregate, uint8_t index)
+{
+    uint8_t i;
+    uint8_t p;
+    uint64_t sum;
+    mlx90614_aggregate_window_t *w;
+    mlx90614_aggregate_pane_t *pane;
+    mlx90614_aggregate_record_t record;
+    
+    w = &aggregate->window[index];
+    sum = 0;
+    memset(&record, 0, sizeof(mlx90614_aggregate_record_t));                       /* clear the record */
+    for (i = 1; i <= w->panes; i++)                                                /* oldest pane first */
+    {
+        p = (uint8_t)((w->pos + i) % w->panes);                                    /* pane index */
+        pane = &w->pane[p];
+        if (pane->count == 0)                                                      /* empty pane */
+        {
+            continue;                                                              /* next pane */
+        }
+        if ((record.count == 0) || (pane->min < record.min))                       /* check the min */
+        {
+            record.min = pane->min;                                                /* set the min */
+        }
+        if ((record.count == 0) || (pane->max > record.max))                       /* check the max */
+        {
+            record.max = pane->max;                                                /* set the max */
+        }
+        record.last = pane->last;                                                  /* newest last wins */
+        record.count += pane->count;                                               /* add the samples */
+        sum += pane->sum;                                                          /* add the sum */
+    }
+    if (record.count == 0)                                                         /* no samples */
+    {
+        return;                                                                    /* nothing to emit */
+    }
+    record.mean = (uint16_t)((sum + record.count / 2) / record.count);             /* rounded mean */
+    record.start_ms = w->start_ms + w->step_ms - w->length_ms;                     /* window start */
+    record.window = index;                                                         /* set the window */
+    aggregate->records++;                                                          /* one more record */
+    aggregate->callback(aggregate->arg, &record);                                  /* run the callback */
+}
+
+/**
+ * @brief     init the aggregator
+ * @param[in] *aggregate pointer to an aggregate structure
+ * @param[in] *callback pointer to a record callback function
+ * @param[in] *arg callback argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t mlx90614_aggregate_init(mlx90614_aggregate_t *aggregate,
+                                void (*callback)(void *arg, const mlx90614_aggregate_record_t *record), void *arg)
+{
+    if ((aggregate == NULL) || (callback == NULL))                                 /* check the params */
+    {
+        return 1;                                                                  /* return error */
+    }
+    
+    memset(aggregate, 0, sizeof(mlx90614_aggregate_t));                            /* clear the aggregator */
+    aggregate->callback = callback;                                                /* save the callback */
+    aggregate->arg = arg;                                                          /* save the argument */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      add a window
+ * @param[in]  *aggregate pointer to an aggregate structure
+ * @param[in]  length_ms window length in ms
+ * @param[in]  step_ms window step in ms, equal to length_ms for a tumbling window
+ * @param[out] *index pointer to a window index buffer, NULL means unused
+ * @return     status code
+ *             - 0 success
+ *             - 1 add window failed
+ *             - 4 no free window
+ *             - 5 length or step is invalid
+ * @note       step_ms > 0, length_ms is a multiple of step_ms and length_ms / step_ms <= MLX90614_AGGREGATE_PANE_MAX,
+ *             a sliding window emits a record every step_ms
+ */
+uint8_t mlx90614_aggregate_add_window(mlx90614_aggregate_t *aggregate, uint32_t length_ms, uint32_t step_ms, uint8_t *index)
+{
+    mlx90614_aggregate_window_t *w;
+    
+    if (aggregate == NULL)                                                         /* check aggregate */
+    {
+        return 1;                                                                  /* return error */
+    }
+    if (aggregate->windows >= MLX90614_AGGREGATE_WINDOW_MAX)                       /* check the windows */
+    {
+        return 4;                                                                  /* return error */
+    }
+    if ((step_ms == 0) || (length_ms < step_ms) || ((length_ms % step_ms) != 0) ||
+        ((length_ms / step_ms) > MLX90614_AGGREGATE_PANE_MAX))                     /* check the length and step */
+    {
+        return 5;                                                                  /* return error */
+    }
+    
+    w = &aggregate->window[aggregate->windows];
+    memset(w, 0, sizeof(mlx90614_aggregate_window_t));                             /* clear the window */
+    w->length_ms = length_ms;                                                      /* set the length */
+    w->step_ms = step_ms;                                                          /* set the step */
+    w->panes = (uint8_t)(length_ms / step_ms);                                     /* set the panes */
+    if (index != NULL)                                                             /* check the index */
+    {
+        *index = aggregate->windows;                                               /* set the index */
+    }
+    aggregate->windows++;                                                          /* one more window */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     feed one sample to every window
+ * @param[in] *aggregate pointer to an aggregate structure
+ * @param[in] time_ms sample time in ms
+ * @param[in] raw sample raw from a ram register read
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ *            - 4 raw has the error flag
+ * @note      the windows are aligned to multiples of the step, a sample in a new step closes the
+ *            windows that end before it and emits their records, a sample older than the current
+ *            step counts in the current step, a raw with the 0x8000 error flag is counted in
+ *            rejected and changes no window
+ */
+uint8_t mlx90614_aggregate_update(mlx90614_aggregate_t *aggregate, uint32_t time_ms, uint16_t raw)
+{
+    uint8_t i;
+    uint8_t steps;
+    uint32_t elapsed;
+    mlx90614_aggregate_window_t *w;
+    mlx90614_aggregate_pane_t *pane;
+    
+    if (aggregate == NULL)                                                         /* check aggregate */
+    {
+        return 1;                                                                  /* return error */
+    }
+    if ((raw & 0x8000U) != 0)                                                      /* check the error flag */
+    {
+        aggregate->rejected++;                                                     /* count the rejected sample */
+        
+        return 4;                                                                  /* return error */
+    }
+    
+    for (i = 0; i < aggregate->windows; i++)                                       /* one pass over the windows */
+    {
+        w = &aggregate->window[i];
+        if (w->started == 0)                                                       /* first sample */
+        {
+            w->start_ms = time_ms - (time_ms % w->step_ms);                        /* align the pane */
+            w->pos = 0;                                                            /* first pane */
+            w->started = 1;                                                        /* set started */
+        }
+        steps = 0;
+        elapsed = time_ms - w->start_ms;
+        while ((elapsed >= w->step_ms) && (elapsed < 0x80000000U))                 /* sample is in a later step */
+        {
+            a_mlx90614_aggregate_emit(aggregate, i);                               /* close the window */
+            w->start_ms += w->step_ms;                                             /* next step */
+            w->pos = (uint8_t)((w->pos + 1) % w->panes);                           /* next pane */
+            memset(&w->pane[w->pos], 0, sizeof(mlx90614_aggregate_pane_t));        /* drop the oldest pane */
+            steps++;
+            if (steps >= w->panes)                                                 /* every pane is empty */
+            {
+                w->start_ms = time_ms - (time_ms % w->step_ms);                    /* skip the gap */
+                
+                break;                                                             /* break */
+            }
+            elapsed = time_ms - w->start_ms;
+        }
+        pane = &w->pane[w->pos];
+        if ((pane->count == 0) || (raw < pane->min))                               /* check the min */
+        {
+            pane->min = raw;                                                       /* set the min */
+        }
+        if ((pane->count == 0) || (raw > pane->max))                               /* check the max */
+        {
+            pane->max = raw;                                                       /* set the max */
+        }
+        pane->last = raw;                                                          /* set the last */
+        pane->sum += raw;                                                          /* add to the sum */
+        pane->count++;                                                             /* one more sample */
+    }
+    aggregate->samples++;                                                          /* one more sample */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     emit the open windows
+ * @param[in] *aggregate pointer to an aggregate structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      emits a record for every window with samples and clears the windows, the next sample
+ *            starts them again
+ */
+uint8_t mlx90614_aggregate_flush(mlx90614_aggregate_t *aggregate)
+{
+    uint8_t i;
+    mlx90614_aggregate_window_t *w;
+    
+    if (aggregate == NULL)                                                         /* check aggregate */
+    {
+        return 1;                                                                  /* return error */
+    }
+    
+    for (i = 0; i < aggregate->windows; i++)                                       /* every window */
+    {
+        w = &aggregate->window[i];
+        if (w->started == 0)                                                       /* not started */
+        {
+            continue;                                                              /* next window */
+        }
+        a_mlx90614_aggregate_emit(aggregate, i);                                   /* emit the window */
+        memset(w->pane, 0, sizeof(w->pane));                                       /* clear the panes */
+        w->started = 0;                                                            /* clear started */
+    }
+    
+    return 0;                                                                      /* success return 0 */
+}
@@ -0,0 +1,185 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_aggregate.h
+ * @brief     driver mlx90614 aggregate header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_AGGREGATE_H
+#define DRIVER_MLX90614_AGGREGATE_H
+
+#include "driver_mlx90614.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_aggregate_driver mlx90614 aggregate driver function
+ * @brief    mlx90614 aggregate driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 aggregate max definition
+ */
+#ifndef MLX90614_AGGREGATE_WINDOW_MAX
+#define MLX90614_AGGREGATE_WINDOW_MAX        4        /**< max windows fed by one pass */
+#endif
+#ifndef MLX90614_AGGREGATE_PANE_MAX
+#define MLX90614_AGGREGATE_PANE_MAX          8        /**< max steps in one sliding window */
+#endif
+
+/**
+ * @brief mlx90614 aggregate pane structure definition
+ * @note  the partial aggregate of one step, the values are raw in 0.02 K
+ */
+typedef struct mlx90614_aggregate_pane_s
+{
+    uint32_t count;                                                            /**< samples */
+    uint16_t min;                                                              /**< min raw */
+    uint16_t max;                                                              /**< max raw */
+    uint16_t last;                                                             /**< last raw */
+    uint64_t sum;                                                              /**< raw sum */
+} mlx90614_aggregate_pane_t;
+
+/**
+ * @brief mlx90614 aggregate window structure definition
+ * @note  length_ms / step_ms panes, the memory does not grow with the samples
+ */
+typedef struct mlx90614_aggregate_window_s
+{
+    uint32_t length_ms;                                                        /**< window length in ms */
+    uint32_t step_ms;                                                          /**< window step in ms, equal to the length for a tumbling window */
+    uint8_t panes;                                                             /**< panes in the window */
+    uint8_t pos;                                                               /**< current pane */
+    uint8_t started;                                                           /**< current pane is set */
+    uint32_t start_ms;                                                         /**< current pane start in ms */
+    mlx90614_aggregate_pane_t pane[MLX90614_AGGREGATE_PANE_MAX];               /**< panes in arrival order */
+} mlx90614_aggregate_window_t;
+
+/**
+ * @brief mlx90614 aggregate record structure definition
+ * @note  the values are raw in 0.02 K like the ram registers, celsius = raw * 0.02 - 273.15
+ */
+typedef struct mlx90614_aggregate_record_s
+{
+    uint32_t start_ms;                                                         /**< window start in ms */
+    uint32_t count;                                                            /**< samples in the window */
+    uint16_t min;                                                              /**< min raw */
+    uint16_t max;                                                              /**< max raw */
+    uint16_t mean;                                                             /**< rounded mean raw */
+    uint16_t last;                                                             /**< last raw */
+    uint8_t window;                                                            /**< window index */
+} mlx90614_aggregate_record_t;
+
+/**
+ * @brief mlx90614 aggregate structure definition
+ */
+typedef struct mlx90614_aggregate_s
+{
+    void (*callback)(void *arg, const mlx90614_aggregate_record_t *record);    /**< record callback */
+    void *arg;                                                                 /**< callback argument */
+    uint8_t windows;                                                           /**< window number */
+    uint32_t samples;                                                          /**< samples fed */
+    uint32_t rejected;                                                         /**< samples with the error flag */
+    uint32_t records;                                                          /**< records emitted */
+    mlx90614_aggregate_window_t window[MLX90614_AGGREGATE_WINDOW_MAX];         /**< windows */
+} mlx90614_aggregate_t;
+
+/**
+ * @brief     init the aggregator
+ * @param[in] *aggregate pointer to an aggregate structure
+ * @param[in] *callback pointer to a record callback function
+ * @param[in] *arg callback argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t mlx90614_aggregate_init(mlx90614_aggregate_t *aggregate,
+                                void (*callback)(void *arg, const mlx90614_aggregate_record_t *record), void *arg);
+
+/**
+ * @brief      add a window
+ * @param[in]  *aggregate pointer to an aggregate structure
+ * @param[in]  length_ms window length in ms
+ * @param[in]  step_ms window step in ms, equal to length_ms for a tumbling window
+ * @param[out] *index pointer to a window index buffer, NULL means unused
+ * @return     status code
+ *             - 0 success
+ *             - 1 add window failed
+ *             - 4 no free window
+ *             - 5 length or step is invalid
+ * @note       step_ms > 0, length_ms is a multiple of step_ms and length_ms / step_ms <= MLX90614_AGGREGATE_PANE_MAX,
+ *             a sliding window emits a record every step_ms
+ */
+uint8_t mlx90614_aggregate_add_window(mlx90614_aggregate_t *aggregate, uint32_t length_ms, uint32_t step_ms, uint8_t *index);
+
+/**
+ * @brief     feed one sample to every window
+ * @param[in] *aggregate pointer to an aggregate structure
+ * @param[in] time_ms sample time in ms
+ * @param[in] raw sample raw from a ram register read
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ *            - 4 raw has the error flag
+ * @note      the windows are aligned to multiples of the step, a sample in a new step closes the
+ *            windows that end before it and emits their records, a sample older than the current
+ *            step counts in the current step, a raw with the 0x8000 error flag is counted in
+ *            rejected and changes no window
+ */
+uint8_t mlx90614_aggregate_update(mlx90614_aggregate_t *aggregate, uint32_t time_ms, uint16_t raw);
+
+/**
+ * @brief     emit the open windows
+ * @param[in] *aggregate pointer to an aggregate structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 flush failed
+ * @note      emits a record for every window with samples and clears the windows, the next sample
+ *            starts them again
+ */
+uint8_t mlx90614_aggregate_flush(mlx90614_aggregate_t *aggregate);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
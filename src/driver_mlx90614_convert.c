@@ -0,0 +1,441 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_convert.c
+ * @brief     driver mlx90614 convert source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_convert.h"
+
+/**
+ * @brief simd path definition
+ */
+#if !defined(MLX90614_CONVERT_NO_SIMD) && defined(__AVX2__)
+    #include <immintrin.h>
+    #define MLX90614_CONVERT_AVX2        /**< avx2 path */
+#elif !defined(MLX90614_CONVERT_NO_SIMD) && defined(__SSE2__)
+    #include <emmintrin.h>
+    #define MLX90614_CONVERT_SSE2        /**< sse2 path */
+#elif !defined(MLX90614_CONVERT_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #include <arm_neon.h>
+    #define MLX90614_CONVERT_NEON        /**< neon path */
+#endif
+
+/**
+ * @brief unit coefficient definition
+ */
+#ifndef MLX90614_FIXED_POINT
+static const float gs_scale[3] = {0.02f, 0.02f, 0.036f};                     /**< float scale of celsius, kelvin and fahrenheit */
+static const float gs_offset[3] = {-273.15f, 0.0f, -459.67f};                /**< float offset of celsius, kelvin and fahrenheit */
+#endif
+static const uint16_t gs_milli_scale[3] = {20, 20, 36};                      /**< millidegree scale of celsius, kelvin and fahrenheit */
+static const int32_t gs_milli_offset[3] = {-273150, 0, -459670};             /**< millidegree offset of celsius, kelvin and fahrenheit */
+
+/**
+ * @brief      save 8 error flags
+ * @param[out] *mask pointer to an error mask buffer
+ * @param[in]  index first sample index, a multiple of 8
+ * @param[in]  bits error flags
+ * @return     set flag number
+ * @note       none
+ */
+static inline uint32_t a_mlx90614_convert_mask(uint8_t *mask, uint32_t index, uint32_t bits)
+{
+    if (mask != NULL)
+    {
+        mask[index >> 3] = (uint8_t)bits;
+    }
+    bits = bits - ((bits >> 1) & 0x55);
+    bits = (bits & 0x33) + ((bits >> 2) & 0x33);
+    
+    return (bits + (bits >> 4)) & 0x0F;
+}
+
+/**
+ * @brief      convert the samples left by the simd code
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a float buffer, NULL means unused
+ * @param[out] *milli pointer to a millidegree buffer, NULL means unused
+ * @param[in]  start first sample index, a multiple of 8
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer
+ * @return     set flag number
+ * @note       none
+ */
+static uint32_t a_mlx90614_convert_scalar(const uint16_t *raw, float *out, int32_t *milli, uint32_t start,
+                                          uint32_t len, mlx90614_convert_unit_t unit, uint8_t *mask)
+{
+    uint32_t i;
+    uint32_t bits = 0;
+    uint32_t error = 0;
+    
+#ifdef MLX90614_FIXED_POINT
+    (void)out;
+#endif
+    for (i = start; i < len; i++)
+    {
+#ifndef MLX90614_FIXED_POINT
+        if (out != NULL)
+        {
+            out[i] = (float)raw[i] * gs_scale[unit] + gs_offset[unit];
+        }
+        else
+#endif
+        {
+            milli[i] = (int32_t)raw[i] * gs_milli_scale[unit] + gs_milli_offset[unit];
+        }
+        bits |= (uint32_t)(raw[i] >> 15) << (i & 7);
+        if (((i & 7) == 7) || (i == len - 1))
+        {
+            error += a_mlx90614_convert_mask(mask, i & ~7U, bits);
+            bits = 0;
+        }
+    }
+    
+    return error;
+}
+
+#if defined(MLX90614_CONVERT_AVX2)
+
+#ifndef MLX90614_FIXED_POINT
+/**
+ * @brief      convert 16 samples per step to floats
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a float buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer
+ * @param[out] *error pointer to an error number buffer
+ * @return     converted sample number
+ * @note       none
+ */
+static uint32_t a_mlx90614_convert_float_simd(const uint16_t *raw, float *out, uint32_t len,
+                                              mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error)
+{
+    uint32_t i;
+    const __m256 s = _mm256_set1_ps(gs_scale[unit]);
+    const __m256 o = _mm256_set1_ps(gs_offset[unit]);
+    
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(raw + i));
+        __m128i l = _mm256_castsi256_si128(v);
+        __m128i h = _mm256_extracti128_si256(v, 1);
+        uint32_t bits = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(l, h));
+        
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(l)), s), o));
+        _mm256_storeu_ps(out + i + 8, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(h)), s), o));
+        *error += a_mlx90614_convert_mask(mask, i, bits & 0xFF);
+        *error += a_mlx90614_convert_mask(mask, i + 8, bits >> 8);
+    }
+    
+    return i;
+}
+#endif
+
+/**
+ * @brief      convert 16 samples per step to millidegrees
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a millidegree buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer
+ * @param[out] *error pointer to an error number buffer
+ * @return     converted sample number
+ * @note       none
+ */
+static uint32_t a_mlx90614_convert_milli_simd(const uint16_t *raw, int32_t *out, uint32_t len,
+                                              mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error)
+{
+    uint32_t i;
+    const __m256i s = _mm256_set1_epi32(gs_milli_scale[unit]);
+    const __m256i o = _mm256_set1_epi32(gs_milli_offset[unit]);
+    
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(raw + i));
+        __m128i l = _mm256_castsi256_si128(v);
+        __m128i h = _mm256_extracti128_si256(v, 1);
+        uint32_t bits = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(l, h));
+        
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_add_epi32(_mm256_mullo_epi32(_mm256_cvtepu16_epi32(l), s), o));
+        _mm256_storeu_si256((__m256i *)(out + i + 8), _mm256_add_epi32(_mm256_mullo_epi32(_mm256_cvtepu16_epi32(h), s), o));
+        *error += a_mlx90614_convert_mask(mask, i, bits & 0xFF);
+        *error += a_mlx90614_convert_mask(mask, i + 8, bits >> 8);
+    }
+    
+    return i;
+}
+
+#elif defined(MLX90614_CONVERT_SSE2)
+
+#ifndef MLX90614_FIXED_POINT
+/**
+ * @brief      convert 8 samples per step to floats
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a float buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer
+ * @param[out] *error pointer to an error number buffer
+ * @return     converted sample number
+ * @note       none
+ */
+static uint32_t a_mlx90614_convert_float_simd(const uint16_t *raw, float *out, uint32_t len,
+                                              mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error)
+{
+    uint32_t i;
+    const __m128i z = _mm_setzero_si128();
+    const __m128 s = _mm_set1_ps(gs_scale[unit]);
+    const __m128 o = _mm_set1_ps(gs_offset[unit]);
+    
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(raw + i));
+        
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, z)), s), o));
+        _mm_storeu_ps(out + i + 4, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, z)), s), o));
+        *error += a_mlx90614_convert_mask(mask, i, (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(v, z)));
+    }
+    
+    return i;
+}
+#endif
+
+/**
+ * @brief      convert 8 samples per step to millidegrees
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a millidegree buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer
+ * @param[out] *error pointer to an error number buffer
+ * @return     converted sample number
+ * @note       sse2 has no 32 bits mullo, the products are built from 16 bits halves
+ */
+static uint32_t a_mlx90614_convert_milli_simd(const uint16_t *raw, int32_t *out, uint32_t len,
+                                              mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error)
+{
+    uint32_t i;
+    const __m128i z = _mm_setzero_si128();
+    const __m128i s = _mm_set1_epi16((short)gs_milli_scale[unit]);
+    const __m128i o = _mm_set1_epi32(gs_milli_offset[unit]);
+    
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(raw + i));
+        __m128i l = _mm_mullo_epi16(v, s);
+        __m128i h = _mm_mulhi_epu16(v, s);
+        
+        _mm_storeu_si128((__m128i *)(out + i), _mm_add_epi32(_mm_unpacklo_epi16(l, h), o));
+        _mm_storeu_si128((__m128i *)(out + i + 4), _mm_add_epi32(_mm_unpackhi_epi16(l, h), o));
+        *error += a_mlx90614_convert_mask(mask, i, (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(v, z)));
+    }
+    
+    return i;
+}
+
+#elif defined(MLX90614_CONVERT_NEON)
+
+/**
+ * @brief     get 8 error flags
+ * @param[in] v raw data vector
+ * @return    error flags
+ * @note      none
+ */
+static inline uint32_t a_mlx90614_convert_neon_bits(uint16x8_t v)
+{
+    static const uint16_t weight[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+    uint16x8_t t = vandq_u16(vtstq_u16(v, vdupq_n_u16(0x8000)), vld1q_u16(weight));
+#if defined(__aarch64__)
+    return vaddvq_u16(t);
+#else
+    uint16x4_t p = vadd_u16(vget_low_u16(t), vget_high_u16(t));
+    
+    p = vpadd_u16(p, p);
+    p = vpadd_u16(p, p);
+    
+    return vget_lane_u16(p, 0);
+#endif
+}
+
+#ifndef MLX90614_FIXED_POINT
+/**
+ * @brief      convert 8 samples per step to floats
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a float buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer
+ * @param[out] *error pointer to an error number buffer
+ * @return     converted sample number
+ * @note       multiply and add are kept apart to match the scalar rounding
+ */
+static uint32_t a_mlx90614_convert_float_simd(const uint16_t *raw, float *out, uint32_t len,
+                                              mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error)
+{
+    uint32_t i;
+    const float32x4_t s = vdupq_n_f32(gs_scale[unit]);
+    const float32x4_t o = vdupq_n_f32(gs_offset[unit]);
+    
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        uint16x8_t v = vld1q_u16(raw + i);
+        
+        vst1q_f32(out + i, vaddq_f32(vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), s), o));
+        vst1q_f32(out + i + 4, vaddq_f32(vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))), s), o));
+        *error += a_mlx90614_convert_mask(mask, i, a_mlx90614_convert_neon_bits(v));
+    }
+    
+    return i;
+}
+#endif
+
+/**
+ * @brief      convert 8 samples per step to millidegrees
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a millidegree buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer
+ * @param[out] *error pointer to an error number buffer
+ * @return     converted sample number
+ * @note       none
+ */
+static uint32_t a_mlx90614_convert_milli_simd(const uint16_t *raw, int32_t *out, uint32_t len,
+                                              mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error)
+{
+    uint32_t i;
+    const uint16x4_t s = vdup_n_u16(gs_milli_scale[unit]);
+    const int32x4_t o = vdupq_n_s32(gs_milli_offset[unit]);
+    
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        uint16x8_t v = vld1q_u16(raw + i);
+        
+        vst1q_s32(out + i, vaddq_s32(vreinterpretq_s32_u32(vmull_u16(vget_low_u16(v), s)), o));
+        vst1q_s32(out + i + 4, vaddq_s32(vreinterpretq_s32_u32(vmull_u16(vget_high_u16(v), s)), o));
+        *error += a_mlx90614_convert_mask(mask, i, a_mlx90614_convert_neon_bits(v));
+    }
+    
+    return i;
+}
+
+#endif
+
+/**
+ * @brief  get the simd path chosen at compile time
+ * @return simd path
+ * @note   define MLX90614_CONVERT_NO_SIMD to force the scalar code
+ */
+mlx90614_convert_simd_t mlx90614_convert_get_simd(void)
+{
+#if defined(MLX90614_CONVERT_AVX2)
+    return MLX90614_CONVERT_SIMD_AVX2;
+#elif defined(MLX90614_CONVERT_SSE2)
+    return MLX90614_CONVERT_SIMD_SSE2;
+#elif defined(MLX90614_CONVERT_NEON)
+    return MLX90614_CONVERT_SIMD_NEON;
+#else
+    return MLX90614_CONVERT_SIMD_NONE;
+#endif
+}
+
+#ifndef MLX90614_FIXED_POINT
+/**
+ * @brief      convert raw data to temperatures in bulk
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a temperature buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer, NULL means unused
+ * @param[out] *error pointer to an error number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert failed
+ * @note       bit (i % 8) of mask[i / 8] is set when raw[i] has the 0x8000 error flag,
+ *             mask needs (len + 7) / 8 bytes and out[i] of a flagged raw[i] is meaningless
+ */
+uint8_t mlx90614_convert_to_float(const uint16_t *raw, float *out, uint32_t len,
+                                  mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error)
+{
+    uint32_t i = 0;
+    
+    if ((raw == NULL) || (out == NULL) || (error == NULL) || (unit > MLX90614_CONVERT_UNIT_FAHRENHEIT))     /* check the params */
+    {
+        return 1;                                                                                          /* return error */
+    }
+    
+    *error = 0;                                                                                            /* init 0 */
+#if defined(MLX90614_CONVERT_AVX2) || defined(MLX90614_CONVERT_SSE2) || defined(MLX90614_CONVERT_NEON)
+    i = a_mlx90614_convert_float_simd(raw, out, len, unit, mask, error);                                   /* simd part */
+#endif
+    *error += a_mlx90614_convert_scalar(raw, out, NULL, i, len, unit, mask);                               /* scalar tail */
+    
+    return 0;                                                                                              /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      convert raw data to integer millidegrees in bulk
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a millidegree buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer, NULL means unused
+ * @param[out] *error pointer to an error number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert failed
+ * @note       the results are exact, one raw lsb is 20 millikelvin or 36 millifahrenheit,
+ *             the mask is laid out as in mlx90614_convert_to_float
+ */
+uint8_t mlx90614_convert_to_milli(const uint16_t *raw, int32_t *out, uint32_t len,
+                                  mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error)
+{
+    uint32_t i = 0;
+    
+    if ((raw == NULL) || (out == NULL) || (error == NULL) || (unit > MLX90614_CONVERT_UNIT_FAHRENHEIT))     /* check the params */
+    {
+        return 1;                                                                                          /* return error */
+    }
+    
+    *error = 0;                                                                                            /* init 0 */
+#if defined(MLX90614_CONVERT_AVX2) || defined(MLX90614_CONVERT_SSE2) || defined(MLX90614_CONVERT_NEON)
+    i = a_mlx90614_convert_milli_simd(raw, out, len, unit, mask, error);                                   /* simd part */
+#endif
+    *error += a_mlx90614_convert_scalar(raw, NULL, out, i, len, unit, mask);                               /* scalar tail */
+    
+    return 0;                                                                                              /* success return 0 */
+}
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_convert.h
+ * @brief     driver mlx90614 convert header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_CONVERT_H
+#define DRIVER_MLX90614_CONVERT_H
+
+#include "driver_mlx90614.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_convert_driver mlx90614 convert driver function
+ * @brief    mlx90614 convert driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 convert unit enumeration definition
+ */
+typedef enum
+{
+    MLX90614_CONVERT_UNIT_CELSIUS    = 0x00,        /**< degree celsius */
+    MLX90614_CONVERT_UNIT_KELVIN     = 0x01,        /**< kelvin */
+    MLX90614_CONVERT_UNIT_FAHRENHEIT = 0x02,        /**< degree fahrenheit */
+} mlx90614_convert_unit_t;
+
+/**
+ * @brief mlx90614 convert simd enumeration definition
+ */
+typedef enum
+{
+    MLX90614_CONVERT_SIMD_NONE = 0x00,        /**< scalar code */
+    MLX90614_CONVERT_SIMD_SSE2 = 0x01,        /**< x86 sse2 */
+    MLX90614_CONVERT_SIMD_AVX2 = 0x02,        /**< x86 avx2 */
+    MLX90614_CONVERT_SIMD_NEON = 0x03,        /**< arm neon */
+} mlx90614_convert_simd_t;
+
+/**
+ * @brief  get the simd path chosen at compile time
+ * @return simd path
+ * @note   define MLX90614_CONVERT_NO_SIMD to force the scalar code
+ */
+mlx90614_convert_simd_t mlx90614_convert_get_simd(void);
+
+#ifndef MLX90614_FIXED_POINT
+/**
+ * @brief      convert raw data to temperatures in bulk
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a temperature buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer, NULL means unused
+ * @param[out] *error pointer to an error number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert failed
+ * @note       bit (i % 8) of mask[i / 8] is set when raw[i] has the 0x8000 error flag,
+ *             mask needs (len + 7) / 8 bytes and out[i] of a flagged raw[i] is meaningless
+ */
+uint8_t mlx90614_convert_to_float(const uint16_t *raw, float *out, uint32_t len,
+                                  mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error);
+#endif
+
+/**
+ * @brief      convert raw data to integer millidegrees in bulk
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to a millidegree buffer
+ * @param[in]  len buffer length
+ * @param[in]  unit temperature unit
+ * @param[out] *mask pointer to an error mask buffer, NULL means unused
+ * @param[out] *error pointer to an error number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert failed
+ * @note       the results are exact, one raw lsb is 20 millikelvin or 36 millifahrenheit,
+ *             the mask is laid out as in mlx90614_convert_to_float
+ */
+uint8_t mlx90614_convert_to_milli(const uint16_t *raw, int32_t *out, uint32_t len,
+                                  mlx90614_convert_unit_t unit, uint8_t *mask, uint32_t *error);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,480 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_coro.hpp
+ * @brief     driver mlx90614 c++20 coroutine header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_CORO_HPP
+#define DRIVER_MLX90614_CORO_HPP
+
+#include "driver_mlx90614.hpp"
+#include <algorithm>
+#include <coroutine>
+#include <exception>
+#include <vector>
+
+/**
+ * @defgroup mlx90614_coro_driver mlx90614 coroutine driver function
+ * @brief    mlx90614 c++20 coroutine driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+namespace mlx90614::coro
+{
+
+template <typename T>
+class Task;
+
+namespace detail
+{
+
+/**
+ * @brief mlx90614 task promise base structure definition
+ * @note  a task starts suspended and resumes its awaiter when it finishes
+ */
+struct PromiseBase
+{
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept { return h.promise().continuation; }
+        void await_resume() const noexcept {}
+    };
+    
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() const noexcept { std::terminate(); }
+    
+    std::coroutine_handle<> continuation = std::noop_coroutine();        /**< awaiter to resume at the end */
+};
+
+/**
+ * @brief     compare two wrapping ms times
+ * @param[in] a first time
+ * @param[in] b second time
+ * @return    true if a is before b
+ * @note      valid while the times are less than 24 days apart
+ */
+constexpr bool before(uint32_t a, uint32_t b) noexcept
+{
+    return static_cast<int32_t>(a - b) < 0;
+}
+
+}
+
+/**
+ * @brief mlx90614 task class definition
+ * @note  a lazy coroutine, it runs when it is awaited or spawned on an executor
+ */
+template <typename T>
+class Task
+{
+    public:
+        struct promise_type : detail::PromiseBase
+        {
+            Task get_return_object() noexcept { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            void return_value(T v) { value.emplace(std::move(v)); }
+            
+            std::optional<T> value;        /**< returned value */
+        };
+        
+        Task(Task &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+        Task(const Task &) = delete;
+        Task &operator=(const Task &) = delete;
+        Task &operator=(Task &&other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_handle)
+                {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            
+            return *this;
+        }
+        ~Task() { if (m_handle) { m_handle.destroy(); } }
+        
+        bool await_ready() const noexcept { return m_handle.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+        {
+            m_handle.promise().continuation = awaiter;
+            
+            return m_handle;
+        }
+        T await_resume() { return std::move(*m_handle.promise().value); }
+    
+    private:
+        explicit Task(std::coroutine_handle<promise_type> h) noexcept : m_handle(h) {}
+        
+        std::coroutine_handle<promise_type> m_handle;        /**< coroutine handle */
+};
+
+/**
+ * @brief mlx90614 void task class definition
+ */
+template <>
+class Task<void>
+{
+    public:
+        struct promise_type : detail::PromiseBase
+        {
+            Task get_return_object() noexcept { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            void return_void() const noexcept {}
+        };
+        
+        Task(Task &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+        Task(const Task &) = delete;
+        Task &operator=(const Task &) = delete;
+        Task &operator=(Task &&other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_handle)
+                {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            
+            return *this;
+        }
+        ~Task() { if (m_handle) { m_handle.destroy(); } }
+        
+        bool await_ready() const noexcept { return m_handle.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept
+        {
+            m_handle.promise().continuation = awaiter;
+            
+            return m_handle;
+        }
+        void await_resume() const noexcept {}
+        
+        /**
+         * @brief  check the task
+         * @return true if the task has finished
+         * @note   none
+         */
+        bool done() const noexcept { return m_handle.done(); }
+        
+        /**
+         * @brief  run the task until its first suspension
+         * @note   used by the executor
+         */
+        void start() { m_handle.resume(); }
+    
+    private:
+        explicit Task(std::coroutine_handle<promise_type> h) noexcept : m_handle(h) {}
+        
+        std::coroutine_handle<promise_type> m_handle;        /**< coroutine handle */
+};
+
+/**
+ * @brief mlx90614 executor class definition
+ * @note  a single thread timer executor, an event loop or an rtos tick calls poll with the current ms time,
+ *        run drives a virtual clock that jumps to the next deadline
+ */
+class Executor
+{
+    public:
+        /**
+         * @brief     make an executor
+         * @param[in] now_ms start time
+         * @note      none
+         */
+        explicit Executor(uint32_t now_ms = 0) noexcept : m_now(now_ms), m_seq(0) {}
+        
+        /**
+         * @brief  get the executor time
+         * @return time in ms of the last poll
+         * @note   none
+         */
+        uint32_t now() const noexcept
+        {
+            return m_now;
+        }
+        
+        /**
+         * @brief     start a task and keep it until it finishes
+         * @param[in] task started task
+         * @note      the task runs until its first suspension before spawn returns
+         */
+        void spawn(Task<void> task)
+        {
+            m_tasks.push_back(std::move(task));
+            m_tasks.back().start();
+            reap();
+        }
+        
+        /**
+         * @brief     resume every coroutine whose deadline has passed
+         * @param[in] now_ms current time in ms
+         * @return    true while any spawned task is left
+         * @note      none
+         */
+        bool poll(uint32_t now_ms)
+        {
+            m_now = now_ms;
+            while (!m_timers.empty() && !detail::before(m_now, m_timers.front().deadline))
+            {
+                std::pop_heap(m_timers.begin(), m_timers.end(), later);
+                std::coroutine_handle<> h = m_timers.back().handle;
+                m_timers.pop_back();
+                h.resume();
+            }
+            reap();
+            
+            return !m_tasks.empty();
+        }
+        
+        /**
+         * @brief      get the next deadline
+         * @param[out] *deadline_ms pointer to a deadline buffer
+         * @return     false if no coroutine waits for a timer
+         * @note       an event loop can arm its timer with it
+         */
+        bool next_deadline(uint32_t *deadline_ms) const noexcept
+        {
+            if (m_timers.empty())
+            {
+                return false;
+            }
+            *deadline_ms = m_timers.front().deadline;
+            
+            return true;
+        }
+        
+        /**
+         * @brief  run the spawned tasks on the virtual clock
+         * @return time in ms when the last task finished
+         * @note   the clock jumps from deadline to deadline, nothing sleeps
+         */
+        uint32_t run()
+        {
+            uint32_t deadline;
+            
+            while (next_deadline(&deadline))
+            {
+                (void)poll(deadline);
+            }
+            
+            return m_now;
+        }
+        
+        /**
+         * @brief     sleep in a coroutine
+         * @param[in] ms sleep time
+         * @return    awaitable
+         * @note      a zero time does not suspend
+         */
+        auto sleep_for(uint32_t ms) noexcept
+        {
+            struct Awaiter
+            {
+                Executor *ex;
+                uint32_t ms;
+                
+                bool await_ready() const noexcept { return ms == 0; }
+                void await_suspend(std::coroutine_handle<> h) { ex->add_timer(ex->m_now + ms, h); }
+                void await_resume() const noexcept {}
+            };
+            
+            return Awaiter{this, ms};
+        }
+    
+    private:
+        struct Timer
+        {
+            uint32_t deadline;                    /**< resume time */
+            uint32_t seq;                         /**< fifo order of equal deadlines */
+            std::coroutine_handle<> handle;       /**< sleeping coroutine */
+        };
+        
+        static bool later(const Timer &a, const Timer &b) noexcept
+        {
+            if (a.deadline != b.deadline)
+            {
+                return detail::before(b.deadline, a.deadline);
+            }
+            
+            return detail::before(b.seq, a.seq);
+        }
+        
+        void add_timer(uint32_t deadline, std::coroutine_handle<> h)
+        {
+            m_timers.push_back(Timer{deadline, m_seq++, h});
+            std::push_heap(m_timers.begin(), m_timers.end(), later);
+        }
+        
+        void reap()
+        {
+            m_tasks.erase(std::remove_if(m_tasks.begin(), m_tasks.end(), [](const Task<void> &t) { return t.done(); }), m_tasks.end());
+        }
+        
+        uint32_t m_now;                      /**< time of the last poll */
+        uint32_t m_seq;                      /**< timer sequence */
+        std::vector<Timer> m_timers;         /**< timer heap */
+        std::vector<Task<void>> m_tasks;     /**< spawned tasks */
+};
+
+/**
+ * @brief mlx90614 asynchronous driver class definition
+ * @note  wraps a Mlx90614 object, the waits of the slow operations are executor sleeps instead of delay_ms,
+ *        so many sensors progress in one thread
+ */
+template <typename Transport>
+class AsyncMlx90614
+{
+    public:
+        /**
+         * @brief     make an asynchronous driver
+         * @param[in] &ex executor of the waits
+         * @param[in] &chip opened driver object
+         * @note      both must outlive the asynchronous driver
+         */
+        AsyncMlx90614(Executor &ex, Mlx90614<Transport> &chip) noexcept : m_ex(ex), m_chip(chip) {}
+        
+        /**
+         * @brief  read the ambient and the object1 temperature
+         * @return task of the sample or an error
+         * @note   the bus reads themselves are short and run inline
+         */
+        Task<Result<Sample>> read()
+        {
+            co_return m_chip.read();
+        }
+        
+        /**
+         * @brief     write an eeprom register
+         * @param[in] command register address
+         * @param[in] data written data
+         * @return    task of the status
+         * @note      the erase and the write each wait MLX90614_EEPROM_WRITE_MS on the executor
+         */
+        Task<Result<void>> write_eeprom(uint8_t command, uint16_t data)
+        {
+            Result<void> res = m_chip.write_word(command, 0x0000);
+            
+            if (!res)
+            {
+                co_return res;
+            }
+            co_await m_ex.sleep_for(MLX90614_EEPROM_WRITE_MS);
+            res = m_chip.write_word(command, data);
+            if (!res)
+            {
+                co_return res;
+            }
+            co_await m_ex.sleep_for(MLX90614_EEPROM_WRITE_MS);
+            
+            co_return Result<void>();
+        }
+        
+        /**
+         * @brief     wait for the first valid object data
+         * @param[in] timeout_ms timeout in ms
+         * @return    task of the status, Error::Ready on timeout
+         * @note      polls tobj1 every MLX90614_READY_POLL_MS
+         */
+        Task<Result<void>> wait_ready(uint32_t timeout_ms = MLX90614_READY_TIMEOUT_MS)
+        {
+            uint32_t start = m_ex.now();
+            
+            while (true)
+            {
+                Result<uint16_t> raw = m_chip.read_reg(mlx90614::detail::REG_RAM_TOBJ1);
+                
+                if (raw && (*raw != 0) && ((*raw & 0x8000U) == 0))
+                {
+                    co_return Result<void>();
+                }
+                if ((m_ex.now() - start) >= timeout_ms)
+                {
+                    co_return unexpected(Error::Ready);
+                }
+                co_await m_ex.sleep_for(MLX90614_READY_POLL_MS);
+            }
+        }
+        
+        /**
+         * @brief  exit the sleep mode
+         * @return task of the status
+         * @note   holds sda low for MLX90614_WAKE_PULSE_MS and waits for the first valid data,
+         *         the pulse wakes every chip on the bus
+         */
+        Task<Result<void>> exit_sleep()
+        {
+            if ((Transport::scl_write(1) != 0) || (Transport::sda_write(1) != 0))
+            {
+                co_return unexpected(Error::Bus);
+            }
+            co_await m_ex.sleep_for(1);
+            if (Transport::sda_write(0) != 0)
+            {
+                co_return unexpected(Error::Bus);
+            }
+            co_await m_ex.sleep_for(MLX90614_WAKE_PULSE_MS);
+            if (Transport::sda_write(1) != 0)
+            {
+                co_return unexpected(Error::Bus);
+            }
+            
+            co_return co_await wait_ready();
+        }
+        
+        /**
+         * @brief  enter the sleep mode
+         * @return task of the status
+         * @note   none
+         */
+        Task<Result<void>> enter_sleep()
+        {
+            co_return m_chip.enter_sleep();
+        }
+    
+    private:
+        Executor &m_ex;                     /**< executor */
+        Mlx90614<Transport> &m_chip;        /**< driver object */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
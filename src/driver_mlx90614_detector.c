@@ -0,0 +1,343 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_detector.c
+ * @brief     driver mlx90614 event detector source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_detector.h"
+
+/**
+ * @brief     queue and report an event
+ * @param[in] *detector pointer to an event detector structure
+ * @param[in] *event pointer to an event structure
+ * @note      a full queue drops the oldest event
+ */
+static void a_mlx90614_detector_emit(mlx90614_detector_t *detector, const mlx90614_detector_event_t *event)
+{
+    if (detector->count == MLX90614_DETECTOR_QUEUE_SIZE)                                  /* queue is full */
+    {
+        detector->head = (uint8_t)((detector->head + 1) % MLX90614_DETECTOR_QUEUE_SIZE);  /* drop the oldest event */
+        detector->count--;                                                                /* one less event */
+        detector->dropped++;                                                              /* count the dropped event */
+    }
+    detector->queue[(detector->head + detector->count) % MLX90614_DETECTOR_QUEUE_SIZE] = *event; /* queue the event */
+    detector->count++;                                                                    /* one more event */
+    if (detector->callback != NULL)                                                       /* check the callback */
+    {
+        detector->callback(detector->arg, event);                                         /* run the callback */
+    }
+}
+
+/**
+ * @brief     sample hook of the handle
+ * @param[in] *arg pointer to an event detector structure
+ * @param[in] reg sample register
+ * @param[in] celsius sample temperature
+ * @note      none
+ */
+static void a_mlx90614_detector_hook(void *arg, uint8_t reg, mlx90614_temperature_t celsius)
+{
+    (void)mlx90614_detector_evaluate((mlx90614_detector_t *)arg, (mlx90614_detector_source_t)reg, celsius); /* evaluate the sample */
+}
+
+/**
+ * @brief     init the event detector and hook it into the reads of the handle
+ * @param[in] *detector pointer to an event detector structure
+ * @param[in] *handle pointer to an inited mlx90614 handle structure
+ * @param[in] *callback pointer to a callback function, NULL means the queue only
+ * @param[in] *arg callback argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      sets the sample hook of the handle, every valid ambient and object read is evaluated
+ *            before the read returns
+ */
+uint8_t mlx90614_detector_init(mlx90614_detector_t *detector, mlx90614_handle_t *handle,
+                               void (*callback)(void *arg, const mlx90614_detector_event_t *event), void *arg)
+{
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        return 3;                                                                         /* return error */
+    }
+    if (detector == NULL)                                                                 /* check detector */
+    {
+        return 1;                                                                         /* return error */
+    }
+    
+    memset(detector, 0, sizeof(mlx90614_detector_t));                                     /* clear the detector */
+    detector->handle = handle;                                                            /* save the handle */
+    detector->callback = callback;                                                        /* save the callback */
+    detector->arg = arg;                                                                  /* save the argument */
+    
+    return mlx90614_set_sample_hook(handle, a_mlx90614_detector_hook, detector);          /* hook the reads */
+}
+
+/**
+ * @brief     remove the event detector from the handle
+ * @param[in] *detector pointer to an event detector structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mlx90614_detector_deinit(mlx90614_detector_t *detector)
+{
+    if ((detector == NULL) || (detector->handle == NULL))                                 /* check detector */
+    {
+        return 1;                                                                         /* return error */
+    }
+    
+    if (detector->handle->sample_hook_arg == detector)                                    /* still hooked */
+    {
+        (void)mlx90614_set_sample_hook(detector->handle, NULL, NULL);                     /* remove the hook */
+    }
+    detector->handle = NULL;                                                              /* clear the handle */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      add a rule
+ * @param[in]  *detector pointer to an event detector structure
+ * @param[in]  *rule pointer to a rule structure
+ * @param[out] *index pointer to a rule index buffer, NULL means unused
+ * @return     status code
+ *             - 0 success
+ *             - 1 add rule failed
+ *             - 4 no free rule
+ *             - 5 rule is invalid
+ * @note       a rate rule or a hold time needs get_time_ms linked to the handle
+ */
+uint8_t mlx90614_detector_add_rule(mlx90614_detector_t *detector, const mlx90614_detector_rule_t *rule, uint8_t *index)
+{
+    if ((detector == NULL) || (detector->handle == NULL) || (rule == NULL))               /* check the params */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (detector->rules >= MLX90614_DETECTOR_RULE_MAX)                                    /* check the rules */
+    {
+        return 4;                                                                         /* return error */
+    }
+    if ((rule->source < MLX90614_DETECTOR_SOURCE_AMBIENT) || (rule->source > MLX90614_DETECTOR_SOURCE_OBJECT2) ||
+        (rule->type > MLX90614_DETECTOR_TYPE_RATE) || (rule->hysteresis < 0))             /* check the rule */
+    {
+        MLX90614_LOG_WARNING(detector->handle, MLX90614_EVENT_PARAM_INVALID, 0);          /* param is invalid */
+        
+        return 5;                                                                         /* return error */
+    }
+    if (((rule->type == MLX90614_DETECTOR_TYPE_RATE) || (rule->hold_ms != 0)) &&
+        (detector->handle->get_time_ms == NULL))                                          /* check the clock */
+    {
+        MLX90614_LOG_WARNING(detector->handle, MLX90614_EVENT_PARAM_INVALID, 0);          /* param is invalid */
+        
+        return 5;                                                                         /* return error */
+    }
+    
+    memset(&detector->state[detector->rules], 0, sizeof(mlx90614_detector_state_t));      /* clear the state */
+    detector->state[detector->rules].rule = *rule;                                        /* save the rule */
+    if (index != NULL)                                                                    /* check the index */
+    {
+        *index = detector->rules;                                                         /* set the index */
+    }
+    detector->rules++;                                                                    /* one more rule */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     evaluate one sample
+ * @param[in] *detector pointer to an event detector structure
+ * @param[in] source sample source
+ * @param[in] celsius sample temperature
+ * @return    status code
+ *            - 0 success
+ *            - 1 evaluate failed
+ * @note      the hook calls it after each read, call it directly to feed samples from another path
+ */
+uint8_t mlx90614_detector_evaluate(mlx90614_detector_t *detector, mlx90614_detector_source_t source, mlx90614_temperature_t celsius)
+{
+    uint8_t i;
+    uint8_t target;
+    uint32_t now;
+    mlx90614_temperature_t v;
+    mlx90614_detector_state_t *s;
+    mlx90614_detector_event_t event;
+    
+    if ((detector == NULL) || (detector->handle == NULL))                                 /* check detector */
+    {
+        return 1;                                                                         /* return error */
+    }
+    
+    now = (detector->handle->get_time_ms != NULL) ? detector->handle->get_time_ms() : 0;  /* get the time */
+    for (i = 0; i < detector->rules; i++)                                                 /* run the rules of the source */
+    {
+        s = &detector->state[i];
+        if (s->rule.source != source)                                                     /* other source */
+        {
+            continue;                                                                     /* next rule */
+        }
+        if (s->rule.type == MLX90614_DETECTOR_TYPE_RATE)                                  /* rate rule */
+        {
+            if ((s->has_last == 0) || (now == s->last_ms))                                /* no time step yet */
+            {
+                s->last = celsius;                                                        /* save the sample */
+                s->last_ms = now;                                                         /* save the time */
+                s->has_last = 1;                                                          /* set valid */
+                
+                continue;                                                                 /* next rule */
+            }
+#ifdef MLX90614_FIXED_POINT
+            v = (mlx90614_temperature_t)((((int64_t)celsius - s->last) * 1000) / (int64_t)(now - s->last_ms)); /* rate per second */
+#else
+            v = (celsius - s->last) * 1000.0f / (float)(now - s->last_ms);                /* rate per second */
+#endif
+            v = (v < 0) ? -v : v;                                                         /* absolute rate */
+            s->last = celsius;                                                            /* save the sample */
+            s->last_ms = now;                                                             /* save the time */
+        }
+        else
+        {
+            v = celsius;                                                                  /* temperature */
+        }
+        
+        if (s->active == 0)                                                               /* cleared */
+        {
+            if (s->rule.type == MLX90614_DETECTOR_TYPE_LOW)
+            {
+                target = (uint8_t)(v < s->rule.limit);                                    /* under the limit */
+            }
+            else
+            {
+                target = (uint8_t)(v > s->rule.limit);                                    /* over the limit */
+            }
+        }
+        else                                                                              /* active */
+        {
+            if (s->rule.type == MLX90614_DETECTOR_TYPE_LOW)
+            {
+                target = (uint8_t)(!(v > s->rule.limit + s->rule.hysteresis));            /* over the hysteresis band */
+            }
+            else
+            {
+                target = (uint8_t)(!(v < s->rule.limit - s->rule.hysteresis));            /* under the hysteresis band */
+            }
+        }
+        if (target == s->active)                                                          /* no change */
+        {
+            s->pending = 0;                                                               /* drop a pending change */
+            
+            continue;                                                                     /* next rule */
+        }
+        if (s->pending == 0)                                                              /* new change */
+        {
+            s->pending = 1;                                                               /* set pending */
+            s->pending_ms = now;                                                          /* save the time */
+        }
+        if ((now - s->pending_ms) >= s->rule.hold_ms)                                     /* the change held */
+        {
+            s->active = target;                                                           /* set the state */
+            s->pending = 0;                                                               /* clear pending */
+            event.rule = i;                                                               /* set the rule */
+            event.source = (uint8_t)source;                                               /* set the source */
+            event.type = (uint8_t)s->rule.type;                                           /* set the type */
+            event.active = target;                                                        /* set the state */
+            event.value = v;                                                              /* set the value */
+            event.time_ms = now;                                                          /* set the time */
+            a_mlx90614_detector_emit(detector, &event);                                   /* report the change */
+        }
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      pop the oldest queued event
+ * @param[in]  *detector pointer to an event detector structure
+ * @param[out] *event pointer to an event buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 pop failed
+ *             - 4 queue is empty
+ * @note       a full queue drops the oldest event and counts it in dropped
+ */
+uint8_t mlx90614_detector_pop(mlx90614_detector_t *detector, mlx90614_detector_event_t *event)
+{
+    if ((detector == NULL) || (event == NULL))                                            /* check the params */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (detector->count == 0)                                                             /* check the queue */
+    {
+        return 4;                                                                         /* return error */
+    }
+    
+    *event = detector->queue[detector->head];                                             /* get the oldest event */
+    detector->head = (uint8_t)((detector->head + 1) % MLX90614_DETECTOR_QUEUE_SIZE);      /* next event */
+    detector->count--;                                                                    /* one less event */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the state of a rule
+ * @param[in]  *detector pointer to an event detector structure
+ * @param[in]  index rule index
+ * @param[out] *active pointer to an active buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get state failed
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t mlx90614_detector_get_state(mlx90614_detector_t *detector, uint8_t index, uint8_t *active)
+{
+    if ((detector == NULL) || (active == NULL))                                           /* check the params */
+    {
+        return 1;                                                                         /* return error */
+    }
+    if (index >= detector->rules)                                                         /* check the index */
+    {
+        return 4;                                                                         /* return error */
+    }
+    
+    *active = detector->state[index].active;                                              /* get the state */
+    
+    return 0;                                                                             /* success return 0 */
+}
@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_detector.h
+ * @brief     driver mlx90614 event detector header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_DETECTOR_H
+#define DRIVER_MLX90614_DETECTOR_H
+
+#include "driver_mlx90614.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_detector_driver mlx90614 event detector driver function
+ * @brief    mlx90614 event detector driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 event detector max definition
+ */
+#ifndef MLX90614_DETECTOR_RULE_MAX
+#define MLX90614_DETECTOR_RULE_MAX          8        /**< max rules of a detector */
+#endif
+#ifndef MLX90614_DETECTOR_QUEUE_SIZE
+#define MLX90614_DETECTOR_QUEUE_SIZE        8        /**< queued events */
+#endif
+
+/**
+ * @brief mlx90614 event detector source enumeration definition
+ */
+typedef enum
+{
+    MLX90614_DETECTOR_SOURCE_AMBIENT = 0x06,        /**< ambient, ram ta */
+    MLX90614_DETECTOR_SOURCE_OBJECT1 = 0x07,        /**< object1, ram tobj1 */
+    MLX90614_DETECTOR_SOURCE_OBJECT2 = 0x08,        /**< object2, ram tobj2 */
+} mlx90614_detector_source_t;
+
+/**
+ * @brief mlx90614 event detector rule type enumeration definition
+ */
+typedef enum
+{
+    MLX90614_DETECTOR_TYPE_HIGH = 0x00,        /**< over limit, clears under limit - hysteresis */
+    MLX90614_DETECTOR_TYPE_LOW  = 0x01,        /**< under limit, clears over limit + hysteresis */
+    MLX90614_DETECTOR_TYPE_RATE = 0x02,        /**< rate of change per second over limit, clears under limit - hysteresis */
+} mlx90614_detector_type_t;
+
+/**
+ * @brief mlx90614 event detector rule structure definition
+ */
+typedef struct mlx90614_detector_rule_s
+{
+    mlx90614_detector_source_t source;            /**< watched temperature */
+    mlx90614_detector_type_t type;                /**< rule type */
+    mlx90614_temperature_t limit;                 /**< limit, per second for a rate rule */
+    mlx90614_temperature_t hysteresis;            /**< hysteresis, >= 0 */
+    uint32_t hold_ms;                             /**< time a new state must hold before it is reported */
+} mlx90614_detector_rule_t;
+
+/**
+ * @brief mlx90614 event detector event structure definition
+ */
+typedef struct mlx90614_detector_event_s
+{
+    uint8_t rule;                                 /**< rule index */
+    uint8_t source;                               /**< watched temperature */
+    uint8_t type;                                 /**< rule type */
+    uint8_t active;                               /**< 1 the rule is active, 0 it is cleared */
+    mlx90614_temperature_t value;                 /**< temperature or rate that changed the state */
+    uint32_t time_ms;                             /**< time of the change in ms */
+} mlx90614_detector_event_t;
+
+/**
+ * @brief mlx90614 event detector rule state structure definition
+ */
+typedef struct mlx90614_detector_state_s
+{
+    mlx90614_detector_rule_t rule;                /**< rule */
+    uint8_t active;                               /**< reported state */
+    uint8_t pending;                              /**< the other state is seen and held */
+    uint8_t has_last;                             /**< last sample is valid */
+    uint32_t pending_ms;                          /**< time the other state was first seen */
+    uint32_t last_ms;                             /**< time of the last sample */
+    mlx90614_temperature_t last;                  /**< last sample */
+} mlx90614_detector_state_t;
+
+/**
+ * @brief mlx90614 event detector structure definition
+ */
+typedef struct mlx90614_detector_s
+{
+    mlx90614_handle_t *handle;                                              /**< sensor handle */
+    void (*callback)(void *arg, const mlx90614_detector_event_t *event);    /**< state change callback, optional */
+    void *arg;                                                              /**< callback argument */
+    mlx90614_detector_state_t state[MLX90614_DETECTOR_RULE_MAX];            /**< rules and their states */
+    uint8_t rules;                                                          /**< rule number */
+    uint8_t head;                                                           /**< oldest queued event */
+    uint8_t count;                                                          /**< queued events */
+    uint32_t dropped;                                                       /**< events lost to a full queue */
+    mlx90614_detector_event_t queue[MLX90614_DETECTOR_QUEUE_SIZE];          /**< event queue */
+} mlx90614_detector_t;
+
+/**
+ * @brief     init the event detector and hook it into the reads of the handle
+ * @param[in] *detector pointer to an event detector structure
+ * @param[in] *handle pointer to an inited mlx90614 handle structure
+ * @param[in] *callback pointer to a callback function, NULL means the queue only
+ * @param[in] *arg callback argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      sets the sample hook of the handle, every valid ambient and object read is evaluated
+ *            before the read returns
+ */
+uint8_t mlx90614_detector_init(mlx90614_detector_t *detector, mlx90614_handle_t *handle,
+                               void (*callback)(void *arg, const mlx90614_detector_event_t *event), void *arg);
+
+/**
+ * @brief     remove the event detector from the handle
+ * @param[in] *detector pointer to an event detector structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mlx90614_detector_deinit(mlx90614_detector_t *detector);
+
+/**
+ * @brief      add a rule
+ * @param[in]  *detector pointer to an event detector structure
+ * @param[in]  *rule pointer to a rule structure
+ * @param[out] *index pointer to a rule index buffer, NULL means unused
+ * @return     status code
+ *             - 0 success
+ *             - 1 add rule failed
+ *             - 4 no free rule
+ *             - 5 rule is invalid
+ * @note       a rate rule or a hold time needs get_time_ms linked to the handle
+ */
+uint8_t mlx90614_detector_add_rule(mlx90614_detector_t *detector, const mlx90614_detector_rule_t *rule, uint8_t *index);
+
+/**
+ * @brief     evaluate one sample
+ * @param[in] *detector pointer to an event detector structure
+ * @param[in] source sample source
+ * @param[in] celsius sample temperature
+ * @return    status code
+ *            - 0 success
+ *            - 1 evaluate failed
+ * @note      the hook calls it after each read, call it directly to feed samples from another path
+ */
+uint8_t mlx90614_detector_evaluate(mlx90614_detector_t *detector, mlx90614_detector_source_t source, mlx90614_temperature_t celsius);
+
+/**
+ * @brief      pop the oldest queued event
+ * @param[in]  *detector pointer to an event detector structure
+ * @param[out] *event pointer to an event buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 pop failed
+ *             - 4 queue is empty
+ * @note       a full queue drops the oldest event and counts it in dropped
+ */
+uint8_t mlx90614_detector_pop(mlx90614_detector_t *detector, mlx90614_detector_event_t *event);
+
+/**
+ * @brief      get the state of a rule
+ * @param[in]  *detector pointer to an event detector structure
+ * @param[in]  index rule index
+ * @param[out] *active pointer to an active buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get state failed
+ *             - 4 index is invalid
+ * @note       none
+ */
+uint8_t mlx90614_detector_get_state(mlx90614_detector_t *detector, uint8_t index, uint8_t *active);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
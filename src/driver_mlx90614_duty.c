@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_duty.c
+ * @brief     driver mlx90614 duty cycle source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_duty.h"
+
+/**
+ * @brief     init the duty cycle scheduler
+ * @param[in] *duty pointer to a duty cycle structure
+ * @param[in] *handle pointer to an inited mlx90614 handle structure
+ * @param[in] period_ms sample period in ms
+ * @param[in] *power pointer to a power model, NULL means the defaults
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the sensor must be in sleep mode or be put there before the first sample
+ */
+uint8_t mlx90614_duty_init(mlx90614_duty_t *duty, mlx90614_handle_t *handle, uint32_t period_ms,
+                           const mlx90614_duty_power_t *power)
+{
+    if (handle == NULL)                                                 /* check handle */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (handle->inited != 1)                                            /* check handle initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+    if (duty == NULL)                                                   /* check duty */
+    {
+        return 1;                                                       /* return error */
+    }
+    
+    memset(duty, 0, sizeof(mlx90614_duty_t));                           /* clear the scheduler */
+    duty->handle = handle;                                              /* save the handle */
+    duty->period_ms = period_ms;                                        /* save the period */
+    duty->step_ms = MLX90614_READY_POLL_MS;                             /* set the poll step */
+    duty->timeout_ms = MLX90614_DUTY_DEFAULT_TIMEOUT_MS;                /* set the timeout */
+    duty->latency_ms = MLX90614_WAKE_SETTLE_MS;                         /* start from the datasheet latency */
+    duty->latency_min_ms = 0xFFFFFFFFU;                                 /* no min yet */
+    if (power != NULL)                                                  /* check the power model */
+    {
+        duty->power = *power;                                           /* save the power model */
+    }
+    else
+    {
+        duty->power.supply_mv = MLX90614_DUTY_DEFAULT_SUPPLY_MV;        /* set the default supply */
+        duty->power.active_ua = MLX90614_DUTY_DEFAULT_ACTIVE_UA;        /* set the default active current */
+        duty->power.sleep_na = MLX90614_DUTY_DEFAULT_SLEEP_NA;          /* set the default sleep current */
+    }
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      run one wake, read and sleep cycle
+ * @param[in]  *duty pointer to a duty cycle structure
+ * @param[out] *ambient_raw pointer to an ambient raw data buffer
+ * @param[out] *ambient pointer to an ambient temperature buffer
+ * @param[out] *object_raw pointer to an object raw data buffer
+ * @param[out] *object pointer to an object temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample failed
+ *             - 4 no valid data before the timeout
+ * @note       the first poll is placed one step before the learned latency, a cycle whose first poll
+ *             is already valid lowers the latency by 1/8 or at least one step, a later valid poll sets it to the
+ *             measured time, so the latency converges to the real one of this chip and filter setting
+ *             the caller sleeps for the rest of the period, it is counted as sleep time in the stats
+ */
+uint8_t mlx90614_duty_sample(mlx90614_duty_t *duty, uint16_t *ambient_raw, mlx90614_temperature_t *ambient,
+                             uint16_t *object_raw, mlx90614_temperature_t *object)
+{
+    uint8_t res;
+    uint32_t polls;
+    uint32_t first;
+    uint32_t elapsed;
+    uint32_t awake;
+    mlx90614_handle_t *handle;
+    
+    if ((duty == NULL) || (duty->handle == NULL))                                   /* check the scheduler */
+    {
+        return 1;                                                                   /* return error */
+    }
+    handle = duty->handle;                                                          /* get the handle */
+    
+    /* wake up */
+    if (mlx90614_exit_sleep_mode_start(handle) != 0)                                /* pull sda low */
+    {
+        duty->failures++;                                                           /* count the failure */
+        
+        return 1;                                                                   /* return error */
+    }
+    handle->delay_ms(MLX90614_WAKE_PULSE_MS);                                       /* hold the wake up request */
+    if (mlx90614_exit_sleep_mode_stop(handle) != 0)                                 /* release sda */
+    {
+        duty->failures++;                                                           /* count the failure */
+        
+        return 1;                                                                   /* return error */
+    }
+    awake = MLX90614_WAKE_PULSE_MS;                                                 /* count the request */
+    
+    /* wait for the first valid data */
+    first = (duty->latency_ms > duty->step_ms) ? (duty->latency_ms - duty->step_ms) : 0;        /* first poll */
+    if (first != 0)                                                                 /* check the first wait */
+    {
+        handle->delay_ms(first);                                                    /* sleep until the first poll */
+    }
+    res = mlx90614_wait_ready(handle, 0, (duty->timeout_ms > first) ?
+                              (duty->timeout_ms - first) : 0, &elapsed);            /* poll for valid data */
+    polls = elapsed / MLX90614_READY_POLL_MS + 1;                                   /* get the polls */
+    elapsed += first;                                                               /* get the latency */
+    duty->polls += polls;                                                           /* save the polls */
+    awake += elapsed;                                                               /* count the wait */
+    
+    if (res == 0)                                                                   /* learn the latency */
+    {
+        if (polls == 1)                                                             /* valid at the first poll */
+        {
+            uint32_t down = (duty->latency_ms / 8 > duty->step_ms) ?
+                            (duty->latency_ms / 8) : duty->step_ms;                 /* get the probe step */
+            
+            duty->latency_ms = (duty->latency_ms > down) ? (duty->latency_ms - down) : 0;        /* try earlier */
+        }
+        else
+        {
+            duty->latency_ms = elapsed;                                             /* save the measured latency */
+            if (elapsed < duty->latency_min_ms)                                     /* check the min */
+            {
+                duty->latency_min_ms = elapsed;                                     /* save the min */
+            }
+            if (elapsed > duty->latency_max_ms)                                     /* check the max */
+            {
+                duty->latency_max_ms = elapsed;                                     /* save the max */
+            }
+        }
+        res = mlx90614_read_object1(handle, object_raw, object);                    /* read the object */
+        if (res == 0)                                                               /* check result */
+        {
+            res = mlx90614_read_ambient(handle, ambient_raw, ambient);              /* read the ambient */
+        }
+        res = (res != 0) ? 1 : 0;                                                   /* map the result */
+    }
+    else
+    {
+        MLX90614_LOG_WARNING(handle, MLX90614_EVENT_WAKE_UP_TIMEOUT, 0);            /* wake up timeout */
+        res = 4;                                                                    /* timeout */
+    }
+    
+    /* back to sleep */
+    if (mlx90614_enter_sleep_mode(handle) != 0)                                     /* enter sleep mode */
+    {
+        res = 1;                                                                    /* return error */
+    }
+    duty->awake_ms += awake;                                                        /* save the awake time */
+    duty->sleep_ms += (duty->period_ms > awake) ? (duty->period_ms - awake) : 0;    /* save the sleep time */
+    if (res != 0)                                                                   /* check the result */
+    {
+        duty->failures++;                                                           /* count the failure */
+        
+        return (res == 4) ? 4 : 1;                                                  /* return error */
+    }
+    duty->samples++;                                                                /* count the sample */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      get the duty cycle stats
+ * @param[in]  *duty pointer to a duty cycle structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       the awake time is counted from the delays of the cycle, the bus transfers are not counted
+ */
+uint8_t mlx90614_duty_get_stats(mlx90614_duty_t *duty, mlx90614_duty_stats_t *stats)
+{
+    uint64_t total;
+    uint64_t energy_nj;
+    
+    if ((duty == NULL) || (stats == NULL))                                                     /* check the params */
+    {
+        return 1;                                                                              /* return error */
+    }
+    
+    memset(stats, 0, sizeof(mlx90614_duty_stats_t));                                           /* clear the stats */
+    stats->samples = duty->samples;                                                            /* save the samples */
+    stats->failures = duty->failures;                                                          /* save the failures */
+    stats->latency_ms = duty->latency_ms;                                                      /* save the latency */
+    stats->latency_min_ms = (duty->latency_max_ms != 0) ? duty->latency_min_ms : 0;            /* save the min */
+    stats->latency_max_ms = duty->latency_max_ms;                                              /* save the max */
+    total = duty->awake_ms + duty->sleep_ms;                                                   /* get the total time */
+    if (total == 0)                                                                            /* no cycle yet */
+    {
+        return 0;                                                                              /* success return 0 */
+    }
+    
+    stats->duty_ppm = (uint32_t)(duty->awake_ms * 1000000ULL / total);                         /* get the duty cycle */
+    stats->average_na = (uint32_t)(((uint64_t)duty->power.active_ua * 1000U * duty->awake_ms +
+                                    (uint64_t)duty->power.sleep_na * duty->sleep_ms) / total); /* get the average current */
+    energy_nj = (uint64_t)duty->power.supply_mv * duty->power.active_ua * duty->awake_ms / 1000U +
+                (uint64_t)duty->power.supply_mv * duty->power.sleep_na * duty->sleep_ms / 1000000U;        /* mV * uA * ms is pJ */
+    if (duty->samples != 0)                                                                    /* check the samples */
+    {
+        stats->polls_per_sample_x100 = (uint32_t)((uint64_t)duty->polls * 100U / duty->samples);        /* get the polls */
+        stats->energy_per_sample_uj = (uint32_t)(energy_nj / 1000U / duty->samples);           /* get the energy */
+    }
+    
+    return 0;                                                                                  /* success return 0 */
+}
@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_duty.h
+ * @brief     driver mlx90614 duty cycle header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_DUTY_H
+#define DRIVER_MLX90614_DUTY_H
+
+#include "driver_mlx90614.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_duty_driver mlx90614 duty cycle driver function
+ * @brief    mlx90614 duty cycle driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 duty cycle default definition
+ * @note  the power figures are defaults for the 5 V parts, measure the board for real numbers
+ */
+#define MLX90614_DUTY_DEFAULT_TIMEOUT_MS         1000       /**< wake to valid timeout in ms */
+#define MLX90614_DUTY_DEFAULT_SUPPLY_MV          5000       /**< supply voltage in mV */
+#define MLX90614_DUTY_DEFAULT_ACTIVE_UA          1300       /**< active supply current in uA */
+#define MLX90614_DUTY_DEFAULT_SLEEP_NA           2500       /**< sleep supply current in nA */
+
+/**
+ * @brief mlx90614 duty cycle power structure definition
+ */
+typedef struct mlx90614_duty_power_s
+{
+    uint32_t supply_mv;        /**< supply voltage in mV */
+    uint32_t active_ua;        /**< active supply current in uA */
+    uint32_t sleep_na;         /**< sleep supply current in nA */
+} mlx90614_duty_power_t;
+
+/**
+ * @brief mlx90614 duty cycle structure definition
+ */
+typedef struct mlx90614_duty_s
+{
+    mlx90614_handle_t *handle;           /**< sensor handle */
+    mlx90614_duty_power_t power;         /**< power model */
+    uint32_t period_ms;                  /**< sample period in ms */
+    uint32_t step_ms;                    /**< poll step in ms, MLX90614_READY_POLL_MS */
+    uint32_t timeout_ms;                 /**< wake to valid timeout in ms */
+    uint32_t latency_ms;                 /**< learned wake to valid latency in ms */
+    uint32_t latency_min_ms;             /**< min measured latency in ms */
+    uint32_t latency_max_ms;             /**< max measured latency in ms */
+    uint32_t samples;                    /**< valid samples */
+    uint32_t failures;                   /**< failed cycles */
+    uint32_t polls;                      /**< readiness polls */
+    uint64_t awake_ms;                   /**< total awake time in ms */
+    uint64_t sleep_ms;                   /**< total sleep time in ms */
+} mlx90614_duty_t;
+
+/**
+ * @brief mlx90614 duty cycle stats structure definition
+ */
+typedef struct mlx90614_duty_stats_s
+{
+    uint32_t samples;                    /**< valid samples */
+    uint32_t failures;                   /**< failed cycles */
+    uint32_t latency_ms;                 /**< learned wake to valid latency in ms */
+    uint32_t latency_min_ms;             /**< min measured latency in ms */
+    uint32_t latency_max_ms;             /**< max measured latency in ms */
+    uint32_t polls_per_sample_x100;      /**< readiness polls per sample x 100 */
+    uint32_t duty_ppm;                   /**< awake time share in ppm */
+    uint32_t average_na;                 /**< average supply current in nA */
+    uint32_t energy_per_sample_uj;       /**< energy per sample in uJ */
+} mlx90614_duty_stats_t;
+
+/**
+ * @brief     init the duty cycle scheduler
+ * @param[in] *duty pointer to a duty cycle structure
+ * @param[in] *handle pointer to an inited mlx90614 handle structure
+ * @param[in] period_ms sample period in ms
+ * @param[in] *power pointer to a power model, NULL means the defaults
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the sensor must be in sleep mode or be put there before the first sample
+ */
+uint8_t mlx90614_duty_init(mlx90614_duty_t *duty, mlx90614_handle_t *handle, uint32_t period_ms,
+                           const mlx90614_duty_power_t *power);
+
+/**
+ * @brief      run one wake, read and sleep cycle
+ * @param[in]  *duty pointer to a duty cycle structure
+ * @param[out] *ambient_raw pointer to an ambient raw data buffer
+ * @param[out] *ambient pointer to an ambient temperature buffer
+ * @param[out] *object_raw pointer to an object raw data buffer
+ * @param[out] *object pointer to an object temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sample failed
+ *             - 4 no valid data before the timeout
+ * @note       the first poll is placed one step before the learned latency, a cycle whose first poll
+ *             is already valid lowers the latency by 1/8 or at least one step, a later valid poll sets it to the
+ *             measured time, so the latency converges to the real one of this chip and filter setting
+ *             the caller sleeps for the rest of the period, it is counted as sleep time in the stats
+ */
+uint8_t mlx90614_duty_sample(mlx90614_duty_t *duty, uint16_t *ambient_raw, mlx90614_temperature_t *ambient,
+                             uint16_t *object_raw, mlx90614_temperature_t *object);
+
+/**
+ * @brief      get the duty cycle stats
+ * @param[in]  *duty pointer to a duty cycle structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get stats failed
+ * @note       the awake time is counted from the delays of the cycle, the bus transfers are not counted
+ */
+uint8_t mlx90614_duty_get_stats(mlx90614_duty_t *duty, mlx90614_duty_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
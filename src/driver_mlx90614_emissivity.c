@@ -0,0 +1,231 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_emissivity.c
+ * @brief     driver mlx90614 emissivity source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_emissivity.h"
+
+#ifndef MLX90614_FIXED_POINT
+
+#include <math.h>
+
+/**
+ * @brief      get the kelvin and its fourth power of a raw data
+ * @param[in]  raw raw data
+ * @param[out] *t4 pointer to a fourth power buffer
+ * @note       none
+ */
+static inline void a_mlx90614_emissivity_pow4(uint16_t raw, float *t4)
+{
+    float t = (float)raw * 0.02f;
+    
+    t = t * t;
+    *t4 = t * t;
+}
+
+/**
+ * @brief     get the fourth root with the lookup table
+ * @param[in] *engine pointer to an mlx90614 emissivity engine structure
+ * @param[in] x positive normal float
+ * @return    fourth root of x
+ * @note      x = 2^(4q + r) * m, so x^(1/4) = 2^q * (2^r * m)^(1/4)
+ */
+static inline float a_mlx90614_emissivity_root4(mlx90614_emissivity_engine_t *engine, float x)
+{
+    union
+    {
+        float f;
+        uint32_t u;
+    } v;
+    int32_t e;
+    int32_t q;
+    uint32_t r;
+    uint32_t index;
+    float frac;
+    const float *row;
+    
+    v.f = x;
+    e = (int32_t)((v.u >> 23) & 0xFF) - 127;                                                        /* exponent */
+    q = (e >= 0) ? (e / 4) : -((3 - e) / 4);                                                        /* floor(e / 4) */
+    r = (uint32_t)(e - q * 4);                                                                      /* 0 - 3 */
+    index = (v.u & 0x7FFFFF) >> (23 - MLX90614_EMISSIVITY_LUT_BITS);                                /* mantissa index */
+    frac = (float)(v.u & ((1U << (23 - MLX90614_EMISSIVITY_LUT_BITS)) - 1)) *
+           (1.0f / (float)(1U << (23 - MLX90614_EMISSIVITY_LUT_BITS)));                             /* mantissa fraction */
+    row = engine->lut[r];
+    v.u = (uint32_t)(q + 127) << 23;                                                                /* 2^q */
+    
+    return (row[index] + (row[index + 1] - row[index]) * frac) * v.f;
+}
+
+/**
+ * @brief     init the emissivity engine
+ * @param[in] *engine pointer to an mlx90614 emissivity engine structure
+ * @param[in] factory_reg emissivity correction coefficient register of the chip
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      factory_reg is read with mlx90614_get_emissivity_correction_coefficient
+ */
+uint8_t mlx90614_emissivity_init(mlx90614_emissivity_engine_t *engine, uint16_t factory_reg)
+{
+    uint32_t r;
+    uint32_t i;
+    
+    if ((engine == NULL) || (factory_reg == 0))                                  /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    engine->factory = (float)factory_reg / 65535.0f;                             /* set the factory emissivity */
+    for (r = 0; r < 4; r++)                                                      /* build the lut */
+    {
+        for (i = 0; i <= MLX90614_EMISSIVITY_LUT_SIZE; i++)
+        {
+            engine->lut[r][i] = (float)pow((double)(1U << r) * (1.0 + (double)i / MLX90614_EMISSIVITY_LUT_SIZE), 0.25);
+        }
+    }
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      compensate the object temperature for one emissivity
+ * @param[in]  *engine pointer to an mlx90614 emissivity engine structure
+ * @param[in]  ambient_raw ambient raw data
+ * @param[in]  object_raw object raw data measured with the factory emissivity
+ * @param[in]  emissivity target emissivity in (0.0, 1.0]
+ * @param[out] *celsius pointer to a celsius data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 compensate failed
+ *             - 4 object raw data has the error flag
+ *             - 5 emissivity is invalid
+ *             - 6 result is out of range
+ * @note       t^4 = ta^4 + factory / emissivity * (tobj^4 - ta^4) in kelvin
+ */
+uint8_t mlx90614_emissivity_compensate(mlx90614_emissivity_engine_t *engine, uint16_t ambient_raw, uint16_t object_raw,
+                                       float emissivity, float *celsius)
+{
+    float ta4;
+    float to4;
+    float x;
+    
+    if ((engine == NULL) || (celsius == NULL))                                   /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    if ((object_raw & 0x8000) != 0)                                              /* check the error flag */
+    {
+        return 4;                                                                /* return error */
+    }
+    if (!((emissivity > 0.0f) && (emissivity <= 1.0f)))                          /* check the emissivity */
+    {
+        return 5;                                                                /* return error */
+    }
+    
+    a_mlx90614_emissivity_pow4(ambient_raw, &ta4);                               /* ta^4 */
+    a_mlx90614_emissivity_pow4(object_raw, &to4);                                /* tobj^4 */
+    x = ta4 + engine->factory / emissivity * (to4 - ta4);                        /* compensated t^4 */
+    if (!(x > 0.0f))                                                             /* check the range */
+    {
+        return 6;                                                                /* return error */
+    }
+    *celsius = sqrtf(sqrtf(x)) - 273.15f;                                        /* get celsius */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      compensate the object temperature for many emissivities
+ * @param[in]  *engine pointer to an mlx90614 emissivity engine structure
+ * @param[in]  ambient_raw ambient raw data
+ * @param[in]  object_raw object raw data measured with the factory emissivity
+ * @param[in]  *emissivity pointer to a target emissivity buffer
+ * @param[out] *celsius pointer to a celsius data buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 compensate failed
+ *             - 4 object raw data has the error flag
+ *             - 6 some results are invalid
+ * @note       uses the lookup table fourth root, the error is below 0.01C from -70C to 380C,
+ *             invalid emissivities and out of range results are set to NAN
+ */
+uint8_t mlx90614_emissivity_compensate_batch(mlx90614_emissivity_engine_t *engine, uint16_t ambient_raw, uint16_t object_raw,
+                                             const float *emissivity, float *celsius, uint32_t len)
+{
+    uint8_t res = 0;
+    uint32_t i;
+    float ta4;
+    float diff;
+    
+    if ((engine == NULL) || (emissivity == NULL) || (celsius == NULL))           /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    if ((object_raw & 0x8000) != 0)                                              /* check the error flag */
+    {
+        return 4;                                                                /* return error */
+    }
+    
+    a_mlx90614_emissivity_pow4(ambient_raw, &ta4);                               /* ta^4 */
+    a_mlx90614_emissivity_pow4(object_raw, &diff);                               /* tobj^4 */
+    diff = (diff - ta4) * engine->factory;                                       /* shared by all targets */
+    for (i = 0; i < len; i++)                                                    /* one division and one lookup per target */
+    {
+        float x;
+        
+        if (!((emissivity[i] > 0.0f) && (emissivity[i] <= 1.0f)))
+        {
+            celsius[i] = NAN;
+            res = 6;
+            
+            continue;
+        }
+        x = ta4 + diff / emissivity[i];
+        if (!(x > 0.0f))
+        {
+            celsius[i] = NAN;
+            res = 6;
+            
+            continue;
+        }
+        celsius[i] = a_mlx90614_emissivity_root4(engine, x) - 273.15f;
+    }
+    
+    return res;                                                                  /* return the result */
+}
+
+#endif
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_emissivity.h
+ * @brief     driver mlx90614 emissivity header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_EMISSIVITY_H
+#define DRIVER_MLX90614_EMISSIVITY_H
+
+#include "driver_mlx90614.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#ifndef MLX90614_FIXED_POINT
+
+/**
+ * @defgroup mlx90614_emissivity_driver mlx90614 emissivity driver function
+ * @brief    mlx90614 emissivity driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 emissivity lut definition
+ */
+#define MLX90614_EMISSIVITY_LUT_BITS        6                                     /**< mantissa index bits */
+#define MLX90614_EMISSIVITY_LUT_SIZE        (1 << MLX90614_EMISSIVITY_LUT_BITS)   /**< mantissa steps */
+
+/**
+ * @brief mlx90614 emissivity engine structure definition
+ */
+typedef struct mlx90614_emissivity_engine_s
+{
+    float factory;                                                    /**< emissivity the chip computes tobj with */
+    float lut[4][MLX90614_EMISSIVITY_LUT_SIZE + 1];                   /**< fourth root of (2^r * mantissa) */
+} mlx90614_emissivity_engine_t;
+
+/**
+ * @brief     init the emissivity engine
+ * @param[in] *engine pointer to an mlx90614 emissivity engine structure
+ * @param[in] factory_reg emissivity correction coefficient register of the chip
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      factory_reg is read with mlx90614_get_emissivity_correction_coefficient
+ */
+uint8_t mlx90614_emissivity_init(mlx90614_emissivity_engine_t *engine, uint16_t factory_reg);
+
+/**
+ * @brief      compensate the object temperature for one emissivity
+ * @param[in]  *engine pointer to an mlx90614 emissivity engine structure
+ * @param[in]  ambient_raw ambient raw data
+ * @param[in]  object_raw object raw data measured with the factory emissivity
+ * @param[in]  emissivity target emissivity in (0.0, 1.0]
+ * @param[out] *celsius pointer to a celsius data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 compensate failed
+ *             - 4 object raw data has the error flag
+ *             - 5 emissivity is invalid
+ *             - 6 result is out of range
+ * @note       t^4 = ta^4 + factory / emissivity * (tobj^4 - ta^4) in kelvin
+ */
+uint8_t mlx90614_emissivity_compensate(mlx90614_emissivity_engine_t *engine, uint16_t ambient_raw, uint16_t object_raw,
+                                       float emissivity, float *celsius);
+
+/**
+ * @brief      compensate the object temperature for many emissivities
+ * @param[in]  *engine pointer to an mlx90614 emissivity engine structure
+ * @param[in]  ambient_raw ambient raw data
+ * @param[in]  object_raw object raw data measured with the factory emissivity
+ * @param[in]  *emissivity pointer to a target emissivity buffer
+ * @param[out] *celsius pointer to a celsius data buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 compensate failed
+ *             - 4 object raw data has the error flag
+ *             - 6 some results are invalid
+ * @note       uses the lookup table fourth root, the error is below 0.01C from -70C to 380C,
+ *             invalid emissivities and out of range results are set to NAN
+ */
+uint8_t mlx90614_emissivity_compensate_batch(mlx90614_emissivity_engine_t *engine, uint16_t ambient_raw, uint16_t object_raw,
+                                             const float *emissivity, float *celsius, uint32_t len);
+
+/**
+ * @}
+ */
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
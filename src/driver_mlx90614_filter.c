@@ -0,0 +1,521 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_filter.c
+ * @brief     driver mlx90614 filter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_filter.h"
+#include <string.h>
+
+/**
+ * @brief     get the mean of two samples
+ * @param[in] a first sample
+ * @param[in] b second sample
+ * @return    mean
+ * @note      none
+ */
+static inline mlx90614_temperature_t a_mlx90614_filter_mean2(mlx90614_temperature_t a, mlx90614_temperature_t b)
+{
+#ifdef MLX90614_FIXED_POINT
+    return (mlx90614_temperature_t)(((int64_t)a + (int64_t)b) / 2);
+#else
+    return (a + b) * 0.5f;
+#endif
+}
+
+/**
+ * @brief     init the common part of a filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] type filter type
+ * @param[in] len window length
+ * @note      none
+ */
+static void a_mlx90614_filter_init(mlx90614_filter_t *filter, mlx90614_filter_type_t type, uint8_t len)
+{
+    memset(filter, 0, sizeof(mlx90614_filter_t));                                /* clear the filter */
+    filter->type = type;                                                         /* set the type */
+    filter->len = len;                                                           /* set the window length */
+}
+
+/**
+ * @brief      run the running median
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @note       the oldest sample is taken out of the sorted window and the new one is put in,
+ *             one pass over at most len samples
+ */
+static void a_mlx90614_filter_median(mlx90614_filter_t *filter, mlx90614_temperature_t in, mlx90614_temperature_t *out)
+{
+    uint8_t i;
+    uint8_t n;
+    
+    n = filter->count;
+    if (n == filter->len)                                                        /* window is full */
+    {
+        mlx90614_temperature_t old = filter->ring[filter->pos];
+        
+        for (i = 0; i < n; i++)                                                  /* find the oldest sample */
+        {
+            if (filter->sorted[i] == old)
+            {
+                break;
+            }
+        }
+        for (; (i + 1) < n; i++)                                                 /* take it out */
+        {
+            filter->sorted[i] = filter->sorted[i + 1];
+        }
+        n--;
+    }
+    else
+    {
+        filter->count++;                                                         /* one more sample */
+    }
+    filter->ring[filter->pos] = in;                                              /* save the new sample */
+    filter->pos = (uint8_t)((filter->pos + 1) % filter->len);                    /* next oldest sample */
+    i = n;
+    while ((i > 0) && (filter->sorted[i - 1] > in))                              /* put the new sample in */
+    {
+        filter->sorted[i] = filter->sorted[i - 1];
+        i--;
+    }
+    filter->sorted[i] = in;
+    n++;
+    if ((n % 2) != 0)                                                            /* odd window */
+    {
+        *out = filter->sorted[n / 2];                                            /* middle sample */
+    }
+    else
+    {
+        *out = a_mlx90614_filter_mean2(filter->sorted[n / 2 - 1], filter->sorted[n / 2]); /* mean of the middle samples */
+    }
+}
+
+/**
+ * @brief      run the box moving average
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @note       none
+ */
+static void a_mlx90614_filter_box(mlx90614_filter_t *filter, mlx90614_temperature_t in, mlx90614_temperature_t *out)
+{
+    uint8_t i;
+    
+    if (filter->count == filter->len)                                            /* window is full */
+    {
+        filter->sum -= filter->ring[filter->pos];                                /* drop the oldest sample */
+    }
+    else
+    {
+        filter->count++;                                                         /* one more sample */
+    }
+    filter->ring[filter->pos] = in;                                              /* save the new sample */
+    filter->sum += in;                                                           /* add it to the sum */
+    filter->pos = (uint8_t)((filter->pos + 1) % filter->len);                    /* next oldest sample */
+    if ((filter->pos == 0) && (filter->count == filter->len))                    /* once per window */
+    {
+        filter->sum = 0;
+        for (i = 0; i < filter->len; i++)                                        /* rebuild the sum */
+        {
+            filter->sum += filter->ring[i];
+        }
+    }
+#ifdef MLX90614_FIXED_POINT
+    *out = (mlx90614_temperature_t)(filter->sum / filter->count);                /* get the mean */
+#else
+    *out = filter->sum / (float)filter->count;                                   /* get the mean */
+#endif
+}
+
+/**
+ * @brief      run the exponential moving average
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @note       the fixed point state keeps 8 more bits, so the output has no rounding bias
+ */
+static void a_mlx90614_filter_ema(mlx90614_filter_t *filter, mlx90614_temperature_t in, mlx90614_temperature_t *out)
+{
+#ifdef MLX90614_FIXED_POINT
+    if (filter->count == 0)                                                      /* first sample */
+    {
+        filter->state = (int64_t)in * 256;                                       /* start from it */
+        filter->count = 1;                                                       /* set started */
+    }
+    else
+    {
+        filter->state += (((int64_t)in * 256 - filter->state) * filter->alpha) / 256; /* y += a * (x - y) */
+    }
+    *out = (mlx90614_temperature_t)((filter->state + ((filter->state >= 0) ? 128 : -128)) / 256); /* round the output */
+#else
+    if (filter->count == 0)                                                      /* first sample */
+    {
+        filter->state = in;                                                      /* start from it */
+        filter->count = 1;                                                       /* set started */
+    }
+    else
+    {
+        filter->state += (in - filter->state) * ((float)filter->alpha / 256.0f); /* y += a * (x - y) */
+    }
+    *out = filter->state;                                                        /* set the output */
+#endif
+}
+
+#ifndef MLX90614_FIXED_POINT
+/**
+ * @brief      run the 1-d kalman filter
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @note       none
+ */
+static void a_mlx90614_filter_kalman(mlx90614_filter_t *filter, mlx90614_temperature_t in, mlx90614_temperature_t *out)
+{
+    float k;
+    
+    if (filter->count == 0)                                                      /* first sample */
+    {
+        filter->state = in;                                                      /* start from it */
+        filter->p = filter->r;                                                   /* with the measurement variance */
+        filter->count = 1;                                                       /* set started */
+    }
+    else
+    {
+        filter->p += filter->q;                                                  /* predict */
+        k = filter->p / (filter->p + filter->r);                                 /* kalman gain */
+        filter->state += k * (in - filter->state);                               /* correct */
+        filter->p *= 1.0f - k;                                                   /* update the variance */
+    }
+    *out = filter->state;                                                        /* set the output */
+}
+#endif
+
+/**
+ * @brief     init a running median filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] len window length
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 len is invalid
+ * @note      1 <= len <= MLX90614_FILTER_WINDOW_MAX, an update moves at most len samples,
+ *            an even window returns the mean of the two middle samples
+ */
+uint8_t mlx90614_filter_median_init(mlx90614_filter_t *filter, uint8_t len)
+{
+    if (filter == NULL)                                                          /* check the filter */
+    {
+        return 1;                                                                /* return error */
+    }
+    if ((len == 0) || (len > MLX90614_FILTER_WINDOW_MAX))                        /* check the len */
+    {
+        return 4;                                                                /* return error */
+    }
+    
+    a_mlx90614_filter_init(filter, MLX90614_FILTER_TYPE_MEDIAN, len);            /* init the filter */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     init a box moving average filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] len window length
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 len is invalid
+ * @note      1 <= len <= MLX90614_FILTER_WINDOW_MAX, the running sum is rebuilt once per window
+ *            so float rounding does not build up
+ */
+uint8_t mlx90614_filter_box_init(mlx90614_filter_t *filter, uint8_t len)
+{
+    if (filter == NULL)                                                          /* check the filter */
+    {
+        return 1;                                                                /* return error */
+    }
+    if ((len == 0) || (len > MLX90614_FILTER_WINDOW_MAX))                        /* check the len */
+    {
+        return 4;                                                                /* return error */
+    }
+    
+    a_mlx90614_filter_init(filter, MLX90614_FILTER_TYPE_BOX, len);               /* init the filter */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     init an exponential moving average filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] alpha weight of a new sample in 1 / 256
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 alpha is invalid
+ * @note      1 <= alpha <= 256, the time constant is about 256 / alpha samples
+ */
+uint8_t mlx90614_filter_ema_init(mlx90614_filter_t *filter, uint16_t alpha)
+{
+    if (filter == NULL)                                                          /* check the filter */
+    {
+        return 1;                                                                /* return error */
+    }
+    if ((alpha == 0) || (alpha > 256))                                           /* check the alpha */
+    {
+        return 4;                                                                /* return error */
+    }
+    
+    a_mlx90614_filter_init(filter, MLX90614_FILTER_TYPE_EMA, 1);                 /* init the filter */
+    filter->alpha = alpha;                                                       /* set the alpha */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+#ifndef MLX90614_FIXED_POINT
+/**
+ * @brief     init a 1-d kalman filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] q process noise variance per sample in celsius^2
+ * @param[in] r measurement noise variance in celsius^2
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 q or r is invalid
+ * @note      random walk model, q >= 0 and r > 0, a larger q / r follows faster
+ */
+uint8_t mlx90614_filter_kalman_init(mlx90614_filter_t *filter, float q, float r)
+{
+    if (filter == NULL)                                                          /* check the filter */
+    {
+        return 1;                                                                /* return error */
+    }
+    if (!(q >= 0.0f) || !(r > 0.0f))                                             /* check the variances */
+    {
+        return 4;                                                                /* return error */
+    }
+    
+    a_mlx90614_filter_init(filter, MLX90614_FILTER_TYPE_KALMAN, 1);              /* init the filter */
+    filter->q = q;                                                               /* set the process noise */
+    filter->r = r;                                                               /* set the measurement noise */
+    
+    return 0;                                                                    /* success return 0 */
+}
+#endif
+
+/**
+ * @brief     reset a filter
+ * @param[in] *filter pointer to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 reset failed
+ * @note      clears the history and keeps the settings, the next sample starts the filter again
+ */
+uint8_t mlx90614_filter_reset(mlx90614_filter_t *filter)
+{
+    if ((filter == NULL) || (filter->type == MLX90614_FILTER_TYPE_NONE))         /* check the filter */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    filter->count = 0;                                                           /* clear the count */
+    filter->pos = 0;                                                             /* clear the position */
+    filter->sum = 0;                                                             /* clear the sum */
+    filter->state = 0;                                                           /* clear the state */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      filter one sample
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ * @note       the first sample passes through, the windows use the samples they have until they are full
+ */
+uint8_t mlx90614_filter_update(mlx90614_filter_t *filter, mlx90614_temperature_t in, mlx90614_temperature_t *out)
+{
+    if ((filter == NULL) || (out == NULL))                                       /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    switch (filter->type)                                                        /* run the filter */
+    {
+        case MLX90614_FILTER_TYPE_MEDIAN :
+        {
+            a_mlx90614_filter_median(filter, in, out);                           /* running median */
+            
+            return 0;                                                            /* success return 0 */
+        }
+        case MLX90614_FILTER_TYPE_BOX :
+        {
+            a_mlx90614_filter_box(filter, in, out);                              /* box moving average */
+            
+            return 0;                                                            /* success return 0 */
+        }
+        case MLX90614_FILTER_TYPE_EMA :
+        {
+            a_mlx90614_filter_ema(filter, in, out);                              /* exponential moving average */
+            
+            return 0;                                                            /* success return 0 */
+        }
+#ifndef MLX90614_FIXED_POINT
+        case MLX90614_FILTER_TYPE_KALMAN :
+        {
+            a_mlx90614_filter_kalman(filter, in, out);                           /* 1-d kalman filter */
+            
+            return 0;                                                            /* success return 0 */
+        }
+#endif
+        default :
+        {
+            return 1;                                                            /* return error */
+        }
+    }
+}
+
+/**
+ * @brief     init a filter pipeline
+ * @param[in] *pipeline pointer to a filter pipeline structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t mlx90614_filter_pipeline_init(mlx90614_filter_pipeline_t *pipeline)
+{
+    if (pipeline == NULL)                                                        /* check the pipeline */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    memset(pipeline, 0, sizeof(mlx90614_filter_pipeline_t));                     /* clear the pipeline */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     add a stage to a filter pipeline
+ * @param[in] *pipeline pointer to a filter pipeline structure
+ * @param[in] *filter pointer to an inited filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ *            - 4 pipeline is full
+ * @note      the stages run in the order they are added, a median before an average removes the spikes first
+ */
+uint8_t mlx90614_filter_pipeline_add(mlx90614_filter_pipeline_t *pipeline, mlx90614_filter_t *filter)
+{
+    if ((pipeline == NULL) || (filter == NULL))                                  /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    if (filter->type == MLX90614_FILTER_TYPE_NONE)                               /* check the filter */
+    {
+        return 1;                                                                /* return error */
+    }
+    if (pipeline->len >= MLX90614_FILTER_STAGE_MAX)                              /* check the stages */
+    {
+        return 4;                                                                /* return error */
+    }
+    
+    pipeline->stage[pipeline->len] = filter;                                     /* add the stage */
+    pipeline->len++;                                                             /* one more stage */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      filter one sample through all stages
+ * @param[in]  *pipeline pointer to a filter pipeline structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ * @note       an empty pipeline passes the sample through
+ */
+uint8_t mlx90614_filter_pipeline_update(mlx90614_filter_pipeline_t *pipeline, mlx90614_temperature_t in, mlx90614_temperature_t *out)
+{
+    uint8_t i;
+    
+    if ((pipeline == NULL) || (out == NULL))                                     /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    for (i = 0; i < pipeline->len; i++)                                          /* run the stages in order */
+    {
+        if (mlx90614_filter_update(pipeline->stage[i], in, &in) != 0)
+        {
+            return 1;                                                            /* return error */
+        }
+    }
+    *out = in;                                                                   /* set the output */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     reset all stages of a filter pipeline
+ * @param[in] *pipeline pointer to a filter pipeline structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 reset failed
+ * @note      none
+ */
+uint8_t mlx90614_filter_pipeline_reset(mlx90614_filter_pipeline_t *pipeline)
+{
+    uint8_t i;
+    
+    if (pipeline == NULL)                                                        /* check the pipeline */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    for (i = 0; i < pipeline->len; i++)                                          /* reset the stages */
+    {
+        if (mlx90614_filter_reset(pipeline->stage[i]) != 0)
+        {
+            return 1;                                                            /* return error */
+        }
+    }
+    
+    return 0;                                                                    /* success return 0 */
+}
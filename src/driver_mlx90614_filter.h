@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_filter.h
+ * @brief     driver mlx90614 filter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_FILTER_H
+#define DRIVER_MLX90614_FILTER_H
+
+#include "driver_mlx90614.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_filter_driver mlx90614 filter driver function
+ * @brief    mlx90614 filter driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 filter max definition
+ */
+#ifndef MLX90614_FILTER_WINDOW_MAX
+#define MLX90614_FILTER_WINDOW_MAX        16        /**< max median and box window length */
+#endif
+#ifndef MLX90614_FILTER_STAGE_MAX
+#define MLX90614_FILTER_STAGE_MAX         4         /**< max stages of a pipeline */
+#endif
+
+/**
+ * @brief mlx90614 filter type enumeration definition
+ */
+typedef enum
+{
+    MLX90614_FILTER_TYPE_NONE   = 0x00,        /**< not inited */
+    MLX90614_FILTER_TYPE_MEDIAN = 0x01,        /**< running median */
+    MLX90614_FILTER_TYPE_BOX    = 0x02,        /**< box moving average */
+    MLX90614_FILTER_TYPE_EMA    = 0x03,        /**< exponential moving average */
+    MLX90614_FILTER_TYPE_KALMAN = 0x04,        /**< 1-d kalman filter */
+} mlx90614_filter_type_t;
+
+/**
+ * @brief mlx90614 filter structure definition
+ * @note  one stage, the memory is fixed by MLX90614_FILTER_WINDOW_MAX
+ */
+typedef struct mlx90614_filter_s
+{
+    mlx90614_filter_type_t type;                                   /**< filter type */
+    uint8_t len;                                                   /**< window length */
+    uint8_t count;                                                 /**< samples in the window */
+    uint8_t pos;                                                   /**< oldest sample of the window */
+    mlx90614_temperature_t ring[MLX90614_FILTER_WINDOW_MAX];       /**< window samples in arrival order */
+    mlx90614_temperature_t sorted[MLX90614_FILTER_WINDOW_MAX];     /**< median window samples in order */
+#ifdef MLX90614_FIXED_POINT
+    int64_t sum;                                                   /**< box window sum */
+    int64_t state;                                                 /**< ema output x 256 */
+#else
+    float sum;                                                     /**< box window sum */
+    float state;                                                   /**< ema output */
+    float q;                                                       /**< kalman process noise variance */
+    float r;                                                       /**< kalman measurement noise variance */
+    float p;                                                       /**< kalman estimate variance */
+#endif
+    uint16_t alpha;                                                /**< ema weight in 1 / 256 */
+} mlx90614_filter_t;
+
+/**
+ * @brief mlx90614 filter pipeline structure definition
+ */
+typedef struct mlx90614_filter_pipeline_s
+{
+    mlx90614_filter_t *stage[MLX90614_FILTER_STAGE_MAX];           /**< stages in order */
+    uint8_t len;                                                   /**< stage number */
+} mlx90614_filter_pipeline_t;
+
+/**
+ * @brief     init a running median filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] len window length
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 len is invalid
+ * @note      1 <= len <= MLX90614_FILTER_WINDOW_MAX, an update moves at most len samples,
+ *            an even window returns the mean of the two middle samples
+ */
+uint8_t mlx90614_filter_median_init(mlx90614_filter_t *filter, uint8_t len);
+
+/**
+ * @brief     init a box moving average filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] len window length
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 len is invalid
+ * @note      1 <= len <= MLX90614_FILTER_WINDOW_MAX, the running sum is rebuilt once per window
+ *            so float rounding does not build up
+ */
+uint8_t mlx90614_filter_box_init(mlx90614_filter_t *filter, uint8_t len);
+
+/**
+ * @brief     init an exponential moving average filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] alpha weight of a new sample in 1 / 256
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 alpha is invalid
+ * @note      1 <= alpha <= 256, the time constant is about 256 / alpha samples
+ */
+uint8_t mlx90614_filter_ema_init(mlx90614_filter_t *filter, uint16_t alpha);
+
+#ifndef MLX90614_FIXED_POINT
+/**
+ * @brief     init a 1-d kalman filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] q process noise variance per sample in celsius^2
+ * @param[in] r measurement noise variance in celsius^2
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 q or r is invalid
+ * @note      random walk model, q >= 0 and r > 0, a larger q / r follows faster
+ */
+uint8_t mlx90614_filter_kalman_init(mlx90614_filter_t *filter, float q, float r);
+#endif
+
+/**
+ * @brief     reset a filter
+ * @param[in] *filter pointer to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 reset failed
+ * @note      clears the history and keeps the settings, the next sample starts the filter again
+ */
+uint8_t mlx90614_filter_reset(mlx90614_filter_t *filter);
+
+/**
+ * @brief      filter one sample
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ * @note       the first sample passes through, the windows use the samples they have until they are full
+ */
+uint8_t mlx90614_filter_update(mlx90614_filter_t *filter, mlx90614_temperature_t in, mlx90614_temperature_t *out);
+
+/**
+ * @brief     init a filter pipeline
+ * @param[in] *pipeline pointer to a filter pipeline structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t mlx90614_filter_pipeline_init(mlx90614_filter_pipeline_t *pipeline);
+
+/**
+ * @brief     add a stage to a filter pipeline
+ * @param[in] *pipeline pointer to a filter pipeline structure
+ * @param[in] *filter pointer to an inited filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ *            - 4 pipeline is full
+ * @note      the stages run in the order they are added, a median before an average removes the spikes first
+ */
+uint8_t mlx90614_filter_pipeline_add(mlx90614_filter_pipeline_t *pipeline, mlx90614_filter_t *filter);
+
+/**
+ * @brief      filter one sample through all stages
+ * @param[in]  *pipeline pointer to a filter pipeline structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 update failed
+ * @note       an empty pipeline passes the sample through
+ */
+uint8_t mlx90614_filter_pipeline_update(mlx90614_filter_pipeline_t *pipeline, mlx90614_temperature_t in, mlx90614_temperature_t *out);
+
+/**
+ * @brief     reset all stages of a filter pipeline
+ * @param[in] *pipeline pointer to a filter pipeline structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 reset failed
+ * @note      none
+ */
+uint8_t mlx90614_filter_pipeline_reset(mlx90614_filter_pipeline_t *pipeline);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
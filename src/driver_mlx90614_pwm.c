@@ -0,0 +1,411 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_pwm.c
+ * @brief     driver mlx90614 pwm source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_pwm.h"
+
+/**
+ * @brief pwm decoder state definition
+ */
+#define MLX90614_PWM_STATE_WAIT_RISE        0        /**< wait the first rising edge */
+#define MLX90614_PWM_STATE_WAIT_FALL        1        /**< wait the falling edge */
+#define MLX90614_PWM_STATE_WAIT_END         2        /**< wait the rising edge that ends the period */
+#define MLX90614_PWM_STATE_WAIT_SYNC        3        /**< wait the rising edge after a glitch, the phase is kept */
+
+/**
+ * @brief     check if two periods match within 1/8
+ * @param[in] a first period
+ * @param[in] b second period
+ * @return    1 if matched else 0
+ * @note      none
+ */
+static uint8_t a_mlx90614_pwm_match(uint64_t a, uint64_t b)
+{
+    uint64_t diff;
+    
+    diff = (a > b) ? (a - b) : (b - a);        /* get the difference */
+    
+    return (uint8_t)(diff <= (b / 8));         /* check the tolerance */
+}
+
+/**
+ * @brief     get the nominal periods between two frame starts
+ * @param[in] elapsed time since the last frame start
+ * @param[in] period nominal period
+ * @return    periods, 0 if the edge is not on a period boundary
+ * @note      the boundary tolerance is 1/8 period like the period match
+ */
+static uint32_t a_mlx90614_pwm_periods(uint64_t elapsed, uint64_t period)
+{
+    uint64_t n;
+    uint64_t diff;
+    
+    if (period == 0)                                            /* check the period */
+    {
+        return 0;                                               /* unknown period */
+    }
+    n = (elapsed + period / 2) / period;                        /* round to the nearest boundary */
+    if ((n == 0) || (n > 0xFFFFFFFFU))                          /* check the range */
+    {
+        return 0;                                               /* not a boundary */
+    }
+    diff = (elapsed > n * period) ? (elapsed - n * period) : (n * period - elapsed);        /* get the difference */
+    
+    return (diff <= (period / 8)) ? (uint32_t)n : 0;            /* check the tolerance */
+}
+
+/**
+ * @brief     advance the frame to a rising edge
+ * @param[in] *decoder pointer to a decoder structure
+ * @param[in] timestamp_ns rising edge timestamp in ns
+ * @note      an edge off the period boundaries keeps the frame and the frame start
+ */
+static void a_mlx90614_pwm_advance(mlx90614_pwm_decoder_t *decoder, uint64_t timestamp_ns)
+{
+    uint32_t n;
+    
+    n = a_mlx90614_pwm_periods(timestamp_ns - decoder->frame_ns, decoder->period_ns);        /* get the periods */
+    if (n != 0)                                                                             /* on a boundary */
+    {
+        decoder->frame = (uint8_t)((decoder->frame + n % decoder->frames) % decoder->frames);    /* advance the frame */
+        decoder->frame_ns = timestamp_ns;                                                   /* save the frame start */
+    }
+}
+
+/**
+ * @brief      load the decoder config from the eeprom
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *config pointer to a decoder config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 load failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       run it in smbus mode before the chip is put back to pwm by a power cycle
+ */
+uint8_t mlx90614_pwm_decoder_load(mlx90614_handle_t *handle, mlx90614_pwm_decoder_config_t *config)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if (config == NULL)                                                             /* check config */
+    {
+        return 1;                                                                   /* return error */
+    }
+    
+    res = mlx90614_get_pwm_ctrl(handle, &config->ctrl);                             /* get pwm ctrl */
+    if (res != 0)                                                                   /* check result */
+    {
+        return 1;                                                                   /* return error */
+    }
+    res = mlx90614_get_mode(handle, &config->mode);                                 /* get mode */
+    if (res != 0)                                                                   /* check result */
+    {
+        return 1;                                                                   /* return error */
+    }
+    res = mlx90614_get_to_min(handle, &config->to_min);                             /* get to min */
+    if (res != 0)                                                                   /* check result */
+    {
+        return 1;                                                                   /* return error */
+    }
+    res = mlx90614_get_to_max(handle, &config->to_max);                             /* get to max */
+    if (res != 0)                                                                   /* check result */
+    {
+        return 1;                                                                   /* return error */
+    }
+    res = mlx90614_get_ta_range(handle, &config->ta_min, &config->ta_max);          /* get ta range */
+    if (res != 0)                                                                   /* check result */
+    {
+        return 1;                                                                   /* return error */
+    }
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     init the decoder
+ * @param[in] *decoder pointer to a decoder structure
+ * @param[in] *config pointer to a decoder config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 output is the thermal relay
+ *            - 5 scale range is invalid
+ * @note      the next complete period is taken as the first frame, align the phase of the extended pwm
+ *            as described at mlx90614_pwm_decoder_reset
+ */
+uint8_t mlx90614_pwm_decoder_init(mlx90614_pwm_decoder_t *decoder, const mlx90614_pwm_decoder_config_t *config)
+{
+    uint8_t i;
+    
+    if ((decoder == NULL) || (config == NULL))                                      /* check the params */
+    {
+        return 1;                                                                   /* return error */
+    }
+    if (config->ctrl.output == MLX90614_PWM_OUTPUT_THERMAL_RELAY)                   /* check the output */
+    {
+        return 4;                                                                   /* return error */
+    }
+    
+    if (config->ctrl.mode == MLX90614_PWM_MODE_SINGLE)                              /* single pwm */
+    {
+        decoder->frames = 1;                                                        /* one frame */
+        decoder->source[0] = (config->mode == MLX90614_MODE_TOBJ2) ?
+                              MLX90614_PWM_SOURCE_TOBJ2 : MLX90614_PWM_SOURCE_TOBJ1;  /* set the source */
+        decoder->source[1] = decoder->source[0];                                    /* unused */
+    }
+    else                                                                            /* extended pwm */
+    {
+        decoder->frames = 2;                                                        /* two frames */
+        switch (config->mode)                                                       /* the mode selects the frames */
+        {
+            case MLX90614_MODE_TA_TOBJ1 :
+            {
+                decoder->source[0] = MLX90614_PWM_SOURCE_TA;                        /* ta */
+                decoder->source[1] = MLX90614_PWM_SOURCE_TOBJ1;                     /* tobj1 */
+                
+                break;
+            }
+            case MLX90614_MODE_TA_TOBJ2 :
+            {
+                decoder->source[0] = MLX90614_PWM_SOURCE_TA;                        /* ta */
+                decoder->source[1] = MLX90614_PWM_SOURCE_TOBJ2;                     /* tobj2 */
+                
+                break;
+            }
+            case MLX90614_MODE_TOBJ1_TOBJ2 :
+            {
+                decoder->source[0] = MLX90614_PWM_SOURCE_TOBJ1;                     /* tobj1 */
+                decoder->source[1] = MLX90614_PWM_SOURCE_TOBJ2;                     /* tobj2 */
+                
+                break;
+            }
+            default :
+            {
+                decoder->frames = 1;                                                /* tobj2 only */
+                decoder->source[0] = MLX90614_PWM_SOURCE_TOBJ2;                     /* tobj2 */
+                decoder->source[1] = MLX90614_PWM_SOURCE_TOBJ2;                     /* unused */
+                
+                break;
+            }
+        }
+    }
+    
+    for (i = 0; i < 2; i++)                                                         /* set the scale of each frame */
+    {
+        if (decoder->source[i] == MLX90614_PWM_SOURCE_TA)                           /* ta range */
+        {
+            decoder->min[i] = (int32_t)config->ta_min * 64 - 3820 + 27315;          /* 0.64 degC from -38.2 degC */
+            decoder->range[i] = ((int32_t)config->ta_max - (int32_t)config->ta_min) * 64;        /* set the range */
+        }
+        else                                                                        /* to range */
+        {
+            decoder->min[i] = (int32_t)config->to_min;                              /* 0.01 K */
+            decoder->range[i] = (int32_t)config->to_max - (int32_t)config->to_min;  /* set the range */
+        }
+        if (decoder->range[i] <= 0)                                                 /* check the range */
+        {
+            return 5;                                                               /* return error */
+        }
+    }
+    decoder->period_ns = 0;                                                         /* unknown period */
+    decoder->candidate_ns = 0;                                                      /* no candidate */
+    decoder->glitches = 0;                                                          /* clear the glitches */
+    
+    return mlx90614_pwm_decoder_reset(decoder);                                     /* reset the phase */
+}
+
+/**
+ * @brief     reset the decoder phase
+ * @param[in] *decoder pointer to a decoder structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 reset failed
+ * @note      the next complete period is taken as the first frame, the waveform does not tell the frames of
+ *            the extended pwm apart, so the caller aligns the phase by a reset before the first period after
+ *            the power on or by checking the decoded sources against the expected values
+ */
+uint8_t mlx90614_pwm_decoder_reset(mlx90614_pwm_decoder_t *decoder)
+{
+    if (decoder == NULL)                                    /* check the decoder */
+    {
+        return 1;                                           /* return error */
+    }
+    
+    decoder->state = MLX90614_PWM_STATE_WAIT_RISE;          /* wait the first rising edge */
+    decoder->frame = 0;                                     /* first frame */
+    decoder->rise_ns = 0;                                   /* clear the rising edge */
+    decoder->fall_ns = 0;                                   /* clear the falling edge */
+    decoder->frame_ns = 0;                                  /* clear the frame start */
+    
+    return 0;                                               /* success return 0 */
+}
+
+/**
+ * @brief      push an edge to the decoder
+ * @param[in]  *decoder pointer to a decoder structure
+ * @param[in]  timestamp_ns edge timestamp in ns
+ * @param[in]  level level after the edge
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 a sample is decoded
+ *             - 1 push failed
+ *             - 4 no sample yet
+ *             - 5 period is rejected as a glitch
+ *             - 6 output is in the error band
+ * @note       a sample is decoded at the rising edge that ends a period, a period that differs
+ *             by more than 1/8 from the last one is rejected, the frame keeps advancing by the nominal
+ *             periods that elapsed since the last frame start, so a glitch or a lost period does not swap
+ *             the sources of the extended pwm, two rejected periods of the same length are taken as the new period
+ */
+uint8_t mlx90614_pwm_decoder_push(mlx90614_pwm_decoder_t *decoder, uint64_t timestamp_ns, uint8_t level,
+                                  mlx90614_pwm_sample_t *sample)
+{
+    uint8_t frame;
+    uint64_t period;
+    uint64_t high;
+    uint64_t start;
+    uint64_t span;
+    int64_t data;
+    int32_t centi_kelvin;
+    
+    if ((decoder == NULL) || (sample == NULL))                                      /* check the params */
+    {
+        return 1;                                                                   /* return error */
+    }
+    
+    if (level == 0)                                                                 /* falling edge */
+    {
+        if (decoder->state == MLX90614_PWM_STATE_WAIT_FALL)                         /* the end of the high level */
+        {
+            decoder->fall_ns = timestamp_ns;                                        /* save the falling edge */
+            decoder->state = MLX90614_PWM_STATE_WAIT_END;                           /* wait the period end */
+        }
+        else if (decoder->state == MLX90614_PWM_STATE_WAIT_END)                     /* a second falling edge */
+        {
+            decoder->glitches++;                                                    /* count the glitch */
+            decoder->state = MLX90614_PWM_STATE_WAIT_SYNC;                          /* restart, keep the phase */
+            
+            return 5;                                                               /* return the glitch */
+        }
+        else
+        {
+            /* the level before the first rising edge */
+        }
+        
+        return 4;                                                                   /* no sample yet */
+    }
+    
+    if (decoder->state != MLX90614_PWM_STATE_WAIT_END)                              /* no complete period */
+    {
+        if (decoder->state == MLX90614_PWM_STATE_WAIT_RISE)                         /* the first rising edge */
+        {
+            decoder->frame_ns = timestamp_ns;                                       /* the first frame starts */
+        }
+        else
+        {
+            a_mlx90614_pwm_advance(decoder, timestamp_ns);                          /* keep the phase */
+        }
+        decoder->rise_ns = timestamp_ns;                                            /* save the rising edge */
+        decoder->state = MLX90614_PWM_STATE_WAIT_FALL;                              /* wait the falling edge */
+        
+        return 4;                                                                   /* no sample yet */
+    }
+    
+    period = timestamp_ns - decoder->rise_ns;                                       /* get the period */
+    high = decoder->fall_ns - decoder->rise_ns;                                     /* get the high time */
+    decoder->rise_ns = timestamp_ns;                                                /* this edge starts the next period */
+    decoder->state = MLX90614_PWM_STATE_WAIT_FALL;                                  /* wait the falling edge */
+    if ((decoder->period_ns != 0) && (a_mlx90614_pwm_match(period, decoder->period_ns) == 0))        /* check the period */
+    {
+        if ((decoder->candidate_ns != 0) && (a_mlx90614_pwm_match(period, decoder->candidate_ns) != 0))
+        {
+            decoder->period_ns = period;                                            /* adopt the new period */
+        }
+        else
+        {
+            decoder->candidate_ns = period;                                         /* remember the candidate */
+            decoder->glitches++;                                                    /* count the glitch */
+            a_mlx90614_pwm_advance(decoder, timestamp_ns);                          /* keep the phase */
+            
+            return 5;                                                               /* return the glitch */
+        }
+    }
+    decoder->period_ns = period;                                                    /* save the period */
+    decoder->candidate_ns = 0;                                                      /* clear the candidate */
+    if (a_mlx90614_pwm_periods(timestamp_ns - decoder->frame_ns, period) == 0)      /* the frame start is off the grid */
+    {
+        decoder->frame_ns = timestamp_ns - period;                                  /* this period starts a frame */
+    }
+    a_mlx90614_pwm_advance(decoder, timestamp_ns);                                  /* advance the frame */
+    frame = (uint8_t)((decoder->frame + decoder->frames - 1) % decoder->frames);    /* frame of this period */
+    
+    start = period / MLX90614_PWM_START_BAND_DIV;                                   /* start band */
+    span = period * MLX90614_PWM_DATA_BAND_NUM / MLX90614_PWM_DATA_BAND_DIV;        /* data band */
+    if (high > start + span + start / 4)                                            /* the error band with 1/32 margin */
+    {
+        return 6;                                                                   /* return error */
+    }
+    data = (int64_t)high - (int64_t)start;                                          /* get the data band time */
+    if (data < 0)                                                                   /* clamp the jitter */
+    {
+        data = 0;                                                                   /* set the min */
+    }
+    if (data > (int64_t)span)                                                       /* clamp the jitter */
+    {
+        data = (int64_t)span;                                                       /* set the max */
+    }
+    centi_kelvin = decoder->min[frame] +
+                   (int32_t)((data * decoder->range[frame] + (int64_t)(span / 2)) / (int64_t)span);        /* scale */
+    
+    sample->timestamp_ns = timestamp_ns;                                            /* save the timestamp */
+    sample->source = decoder->source[frame];                                        /* save the source */
+    sample->raw = (uint16_t)((centi_kelvin + 1) / 2);                               /* 0.02 K */
+#ifdef MLX90614_FIXED_POINT
+    sample->celsius = (centi_kelvin - 27315) * (MLX90614_FIXED_POINT / 100);        /* convert to celsius */
+#else
+    sample->celsius = (float)(centi_kelvin - 27315) * 0.01f;                        /* convert to celsius */
+#endif
+    
+    return 0;                                                                       /* success return 0 */
+}
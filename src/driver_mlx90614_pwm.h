@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_pwm.h
+ * @brief     driver mlx90614 pwm header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_PWM_H
+#define DRIVER_MLX90614_PWM_H
+
+#include "driver_mlx90614.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_pwm_driver mlx90614 pwm driver function
+ * @brief    mlx90614 pwm driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 pwm frame definition
+ * @note  every period starts with a high start band of 1/8 period, the data band spans 3/4 period
+ *        and the last 1/8 period is the error band, a full scale output ends the high level at 7/8
+ */
+#define MLX90614_PWM_START_BAND_DIV        8        /**< start band is period / 8 */
+#define MLX90614_PWM_DATA_BAND_NUM         3        /**< data band is period * 3 / 4 */
+#define MLX90614_PWM_DATA_BAND_DIV         4        /**< data band is period * 3 / 4 */
+
+/**
+ * @brief mlx90614 pwm source enumeration definition
+ */
+typedef enum
+{
+    MLX90614_PWM_SOURCE_TA    = 0x00,        /**< ambient temperature */
+    MLX90614_PWM_SOURCE_TOBJ1 = 0x01,        /**< object 1 temperature */
+    MLX90614_PWM_SOURCE_TOBJ2 = 0x02,        /**< object 2 temperature */
+} mlx90614_pwm_source_t;
+
+/**
+ * @brief mlx90614 pwm decoder config structure definition
+ */
+typedef struct mlx90614_pwm_decoder_config_s
+{
+    mlx90614_pwm_ctrl_t ctrl;        /**< pwm ctrl */
+    mlx90614_mode_t mode;            /**< config1 mode, selects the output sources */
+    uint16_t to_min;                 /**< to min register, 0.01 K */
+    uint16_t to_max;                 /**< to max register, 0.01 K */
+    uint8_t ta_min;                  /**< ta range min register */
+    uint8_t ta_max;                  /**< ta range max register */
+} mlx90614_pwm_decoder_config_t;
+
+/**
+ * @brief mlx90614 pwm sample structure definition
+ */
+typedef struct mlx90614_pwm_sample_s
+{
+    uint64_t timestamp_ns;                /**< timestamp of the period end in ns */
+    mlx90614_pwm_source_t source;         /**< output source */
+    uint16_t raw;                         /**< value in the 0.02 K ram register format */
+    mlx90614_temperature_t celsius;       /**< temperature */
+} mlx90614_pwm_sample_t;
+
+/**
+ * @brief mlx90614 pwm decoder structure definition
+ */
+typedef struct mlx90614_pwm_decoder_s
+{
+    mlx90614_pwm_source_t source[2];        /**< source of each frame */
+    uint8_t frames;                         /**< frames per cycle, 1 single pwm or 2 extended pwm */
+    uint8_t frame;                          /**< next frame */
+    uint8_t state;                          /**< 0 wait rise, 1 wait fall, 2 wait rise of the next period, 3 wait rise after a glitch */
+    int32_t min[2];                         /**< scale min of each frame in 0.01 K */
+    int32_t range[2];                       /**< scale range of each frame in 0.01 K */
+    uint64_t rise_ns;                       /**< last rising edge */
+    uint64_t fall_ns;                       /**< last falling edge */
+    uint64_t frame_ns;                      /**< rising edge that starts the next frame */
+    uint64_t period_ns;                     /**< last accepted period, 0 means unknown */
+    uint64_t candidate_ns;                  /**< last rejected period, adopted when it repeats */
+    uint32_t glitches;                      /**< rejected periods */
+} mlx90614_pwm_decoder_t;
+
+/**
+ * @brief      load the decoder config from the eeprom
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *config pointer to a decoder config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 load failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       run it in smbus mode before the chip is put back to pwm by a power cycle
+ */
+uint8_t mlx90614_pwm_decoder_load(mlx90614_handle_t *handle, mlx90614_pwm_decoder_config_t *config);
+
+/**
+ * @brief     init the decoder
+ * @param[in] *decoder pointer to a decoder structure
+ * @param[in] *config pointer to a decoder config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 output is the thermal relay
+ *            - 5 scale range is invalid
+ * @note      the next complete period is taken as the first frame, align the phase of the extended pwm
+ *            as described at mlx90614_pwm_decoder_reset
+ */
+uint8_t mlx90614_pwm_decoder_init(mlx90614_pwm_decoder_t *decoder, const mlx90614_pwm_decoder_config_t *config);
+
+/**
+ * @brief     reset the decoder phase
+ * @param[in] *decoder pointer to a decoder structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 reset failed
+ * @note      the next complete period is taken as the first frame, the waveform does not tell the frames of
+ *            the extended pwm apart, so the caller aligns the phase by a reset before the first period after
+ *            the power on or by checking the decoded sources against the expected values
+ */
+uint8_t mlx90614_pwm_decoder_reset(mlx90614_pwm_decoder_t *decoder);
+
+/**
+ * @brief      push an edge to the decoder
+ * @param[in]  *decoder pointer to a decoder structure
+ * @param[in]  timestamp_ns edge timestamp in ns
+ * @param[in]  level level after the edge
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 a sample is decoded
+ *             - 1 push failed
+ *             - 4 no sample yet
+ *             - 5 period is rejected as a glitch
+ *             - 6 output is in the error band
+ * @note       a sample is decoded at the rising edge that ends a period, a period that differs
+ *             by more than 1/8 from the last one is rejected, the frame keeps advancing by the nominal
+ *             periods that elapsed since the last frame start, so a glitch or a lost period does not swap
+ *             the sources of the extended pwm, two rejected periods of the same length are taken as the new period
+ */
+uint8_t mlx90614_pwm_decoder_push(mlx90614_pwm_decoder_t *decoder, uint64_t timestamp_ns, uint8_t level,
+                                  mlx90614_pwm_sample_t *sample);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,688 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_registry.c
+ * @brief     driver mlx90614 registry source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_registry.h"
+#include <string.h>
+
+/**
+ * @brief registry register definition
+ */
+#define MLX90614_REGISTRY_REG_CONFIG1        0x25        /**< eeprom config1 register */
+#define MLX90614_REGISTRY_REG_EMISSIVITY     0x24        /**< eeprom emissivity register */
+
+/**
+ * @brief     get the fnv-1a checksum
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len buffer length
+ * @return    checksum
+ * @note      none
+ */
+static uint32_t a_mlx90614_registry_check(const uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+    uint32_t h;
+    
+    h = 0x811C9DC5U;                      /* offset basis */
+    for (i = 0; i < len; i++)             /* all bytes */
+    {
+        h ^= buf[i];                      /* xor the byte */
+        h *= 0x01000193U;                 /* multiply by the prime */
+    }
+    
+    return h;                             /* return the checksum */
+}
+
+/**
+ * @brief     write to the image
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] offset image offset
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_mlx90614_registry_write(mlx90614_registry_t *registry, uint32_t offset, const uint8_t *buf, uint32_t len)
+{
+    if (registry->write != NULL)                                  /* platform write */
+    {
+        return registry->write(offset, buf, len);                 /* program the storage */
+    }
+    memcpy(registry->image + offset, buf, len);                   /* writable image */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief     check if a slot is erased
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] index slot index
+ * @return    1 if all bytes are 0xFF else 0
+ * @note      none
+ */
+static uint8_t a_mlx90614_registry_free(mlx90614_registry_t *registry, uint32_t index)
+{
+    const uint8_t *p;
+    uint32_t i;
+    
+    p = registry->image + MLX90614_REGISTRY_SIZE(index);          /* get the slot */
+    for (i = 0; i < MLX90614_REGISTRY_ENTRY_SIZE; i++)            /* all bytes */
+    {
+        if (p[i] != 0xFF)                                         /* programmed */
+        {
+            return 0;                                             /* in use or broken */
+        }
+    }
+    
+    return 1;                                                     /* erased */
+}
+
+/**
+ * @brief      load a slot
+ * @param[in]  *registry pointer to an mlx90614 registry structure
+ * @param[in]  index slot index
+ * @param[out] *entry pointer to an entry buffer
+ * @return     1 if the slot holds a record else 0
+ * @note       a record without the valid flag removes its chip
+ */
+static uint8_t a_mlx90614_registry_load(mlx90614_registry_t *registry, uint32_t index, mlx90614_registry_entry_t *entry)
+{
+    memcpy(entry, registry->image + MLX90614_REGISTRY_SIZE(index), sizeof(mlx90614_registry_entry_t));        /* copy the slot */
+    
+    return (uint8_t)(entry->check == a_mlx90614_registry_check((const uint8_t *)entry,
+                     sizeof(mlx90614_registry_entry_t) - sizeof(uint32_t)));                                 /* check the checksum */
+}
+
+/**
+ * @brief      find the newest record of a chip
+ * @param[in]  *registry pointer to an mlx90614 registry structure
+ * @param[in]  id 64 bits chip id
+ * @param[out] *entry pointer to an entry buffer
+ * @param[out] *index pointer to a slot index buffer
+ * @return     1 if the chip has a record else 0
+ * @note       the record with the highest sequence wins
+ */
+static uint8_t a_mlx90614_registry_newest(mlx90614_registry_t *registry, uint64_t id, mlx90614_registry_entry_t *entry,
+                                          uint32_t *index)
+{
+    mlx90614_registry_entry_t slot;
+    uint32_t i;
+    uint8_t found;
+    
+    found = 0;                                                                          /* not found yet */
+    for (i = 0; i < registry->capacity; i++)                                            /* all slots */
+    {
+        if ((a_mlx90614_registry_load(registry, i, &slot) != 0) && (slot.id == id) &&
+            ((found == 0) || (slot.sequence > entry->sequence)))                        /* a newer record */
+        {
+            *entry = slot;                                                              /* save the record */
+            *index = i;                                                                 /* save the index */
+            found = 1;                                                                  /* found */
+        }
+    }
+    
+    return found;                                                                       /* return the result */
+}
+
+/**
+ * @brief      load a live slot
+ * @param[in]  *registry pointer to an mlx90614 registry structure
+ * @param[in]  index slot index
+ * @param[out] *entry pointer to an entry buffer
+ * @return     1 if the slot holds the newest record of a stored chip else 0
+ * @note       none
+ */
+static uint8_t a_mlx90614_registry_live(mlx90614_registry_t *registry, uint32_t index, mlx90614_registry_entry_t *entry)
+{
+    mlx90614_registry_entry_t newest;
+    uint32_t i;
+    
+    if ((a_mlx90614_registry_load(registry, index, entry) == 0) ||
+        ((entry->flags & MLX90614_REGISTRY_FLAG_VALID) == 0))                           /* no stored chip */
+    {
+        return 0;                                                                       /* not live */
+    }
+    i = index;                                                                          /* init the index */
+    (void)a_mlx90614_registry_newest(registry, entry->id, &newest, &i);                 /* find the newest record */
+    
+    return (uint8_t)(i == index);                                                       /* check the record */
+}
+
+/**
+ * @brief     erase a slot
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] index slot index
+ * @return    status code
+ *            - 0 success
+ *            - 1 erase failed
+ * @note      only used on a writable image, the bits of a flash page can not be set without a page erase
+ */
+static uint8_t a_mlx90614_registry_erase(mlx90614_registry_t *registry, uint32_t index)
+{
+    uint8_t buf[MLX90614_REGISTRY_ENTRY_SIZE];
+    
+    memset(buf, 0xFF, sizeof(buf));                                                                   /* erased */
+    
+    return a_mlx90614_registry_write(registry, MLX90614_REGISTRY_SIZE(index), buf, sizeof(buf));      /* write the slot */
+}
+
+/**
+ * @brief     compact a writable image
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 compact failed
+ * @note      the old records go first, then the removed chips, then the live records are moved to the front,
+ *            every step keeps the newest record of each chip in place
+ */
+static uint8_t a_mlx90614_registry_compact(mlx90614_registry_t *registry)
+{
+    mlx90614_registry_entry_t slot;
+    mlx90614_registry_entry_t newest;
+    uint32_t i;
+    uint32_t j;
+    uint32_t n;
+    
+    for (i = 0; i < registry->capacity; i++)                                                         /* old and broken records */
+    {
+        if (a_mlx90614_registry_free(registry, i) != 0)                                              /* erased */
+        {
+            continue;                                                                                /* skip */
+        }
+        j = i;                                                                                       /* init the index */
+        if ((a_mlx90614_registry_load(registry, i, &slot) == 0) ||
+            ((a_mlx90614_registry_newest(registry, slot.id, &newest, &j) != 0) && (j != i)))         /* broken or old */
+        {
+            if (a_mlx90614_registry_erase(registry, i) != 0)                                         /* erase the slot */
+            {
+                return 1;                                                                            /* return error */
+            }
+        }
+    }
+    for (i = 0; i < registry->capacity; i++)                                                         /* removed chips */
+    {
+        if ((a_mlx90614_registry_load(registry, i, &slot) != 0) &&
+            ((slot.flags & MLX90614_REGISTRY_FLAG_VALID) == 0))                                      /* the last record removes it */
+        {
+            if (a_mlx90614_registry_erase(registry, i) != 0)                                         /* erase the slot */
+            {
+                return 1;                                                                            /* return error */
+            }
+        }
+    }
+    n = 0;                                                                                           /* first free slot */
+    for (i = 0; i < registry->capacity; i++)                                                         /* live records */
+    {
+        if (a_mlx90614_registry_free(registry, i) != 0)                                              /* erased */
+        {
+            continue;                                                                                /* skip */
+        }
+        if (i != n)                                                                                  /* move it to the front */
+        {
+            if ((a_mlx90614_registry_write(registry, MLX90614_REGISTRY_SIZE(n),
+                                           registry->image + MLX90614_REGISTRY_SIZE(i),
+                                           MLX90614_REGISTRY_ENTRY_SIZE) != 0) ||
+                (a_mlx90614_registry_erase(registry, i) != 0))                                       /* move the slot */
+            {
+                return 1;                                                                            /* return error */
+            }
+        }
+        n++;                                                                                         /* next slot */
+    }
+    
+    return 0;                                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     append a record
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] *entry pointer to an entry
+ * @param[in] flags record flags
+ * @return    status code
+ *            - 0 success
+ *            - 1 append failed
+ *            - 4 registry is full
+ * @note      the record takes the next sequence, a full writable image is compacted first
+ */
+static uint8_t a_mlx90614_registry_append(mlx90614_registry_t *registry, const mlx90614_registry_entry_t *entry, uint8_t flags)
+{
+    mlx90614_registry_entry_t slot;
+    mlx90614_registry_entry_t e;
+    uint32_t i;
+    uint32_t index;
+    uint32_t sequence;
+    
+    index = registry->capacity;                                                                      /* no slot yet */
+    sequence = 0;                                                                                    /* first record */
+    for (i = 0; i < registry->capacity; i++)                                                         /* all slots */
+    {
+        if (a_mlx90614_registry_free(registry, i) != 0)                                              /* erased slot */
+        {
+            if (index == registry->capacity)                                                         /* first free slot */
+            {
+                index = i;                                                                           /* keep it */
+            }
+        }
+        else if ((a_mlx90614_registry_load(registry, i, &slot) != 0) && (slot.sequence >= sequence))  /* newer record */
+        {
+            sequence = slot.sequence + 1;                                                            /* next sequence */
+        }
+        else
+        {
+            /* old or broken record */
+        }
+    }
+    if (index == registry->capacity)                                                                 /* check the free slot */
+    {
+        if (registry->write != NULL)                                                                 /* a flash page */
+        {
+            return 4;                                                                                /* return error */
+        }
+        if (a_mlx90614_registry_compact(registry) != 0)                                              /* compact the image */
+        {
+            return 1;                                                                                /* return error */
+        }
+        for (i = 0; i < registry->capacity; i++)                                                     /* all slots */
+        {
+            if (a_mlx90614_registry_free(registry, i) != 0)                                          /* erased slot */
+            {
+                index = i;                                                                           /* keep it */
+                
+                break;                                                                               /* break */
+            }
+        }
+        if (index == registry->capacity)                                                             /* check the free slot */
+        {
+            return 4;                                                                                /* return error */
+        }
+    }
+    
+    memset(&e, 0, sizeof(e));                                                                        /* clear the padding */
+    e.id = entry->id;                                                                                /* set the id */
+    e.addr = entry->addr;                                                                            /* set the address */
+    e.flags = flags;                                                                                 /* set the flags */
+    e.config1 = entry->config1;                                                                      /* set the config1 */
+    e.emissivity = entry->emissivity;                                                                /* set the emissivity */
+    e.ambient_offset = entry->ambient_offset;                                                        /* set the ambient offset */
+    e.object_offset = entry->object_offset;                                                          /* set the object offset */
+    e.sequence = sequence;                                                                           /* set the sequence */
+    e.check = a_mlx90614_registry_check((const uint8_t *)&e, sizeof(e) - sizeof(uint32_t));          /* set the checksum */
+    
+    return a_mlx90614_registry_write(registry, MLX90614_REGISTRY_SIZE(index),
+                                     (const uint8_t *)&e, sizeof(e));                                /* write the slot */
+}
+
+/**
+ * @brief     attach a registry image
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] *image pointer to an image buffer
+ * @param[in] size image size in bytes
+ * @param[in] *write pointer to an image write function, NULL writes the image directly
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 image is too small
+ *            - 5 image was invalid and has been formatted
+ * @note      the image is read in place, writes go through the write function so a flash page
+ *            can be programmed by the platform, an image with a wrong magic, version or size is formatted,
+ *            empty slots are erased to 0xFF and records are only appended, so after the format the write
+ *            function only programs erased bytes, a flash page must be erased before it is formatted because
+ *            the format can not set bits, a full flash page stays full until the platform erases it and inits
+ *            it again, an image without a write function is compacted in place when it is full
+ */
+uint8_t mlx90614_registry_init(mlx90614_registry_t *registry, uint8_t *image, uint32_t size,
+                               uint8_t (*write)(uint32_t offset, const uint8_t *buf, uint32_t len))
+{
+    mlx90614_registry_header_t header;
+    uint32_t i;
+    
+    if ((registry == NULL) || (image == NULL))                                                   /* check the params */
+    {
+        return 1;                                                                                /* return error */
+    }
+    if (size < MLX90614_REGISTRY_SIZE(1))                                                        /* check the size */
+    {
+        return 4;                                                                                /* return error */
+    }
+    
+    registry->image = image;                                                                     /* set the image */
+    registry->capacity = (size - MLX90614_REGISTRY_HEADER_SIZE) / MLX90614_REGISTRY_ENTRY_SIZE;  /* set the capacity */
+    registry->write = write;                                                                     /* set the write function */
+    registry->inited = 0;                                                                        /* not ready yet */
+    
+    memcpy(&header, image, sizeof(header));                                                      /* copy the header */
+    if ((header.magic == MLX90614_REGISTRY_MAGIC) &&
+        (header.version == MLX90614_REGISTRY_VERSION) &&
+        (header.entry_size == MLX90614_REGISTRY_ENTRY_SIZE) &&
+        (header.capacity == registry->capacity) &&
+        (header.check == a_mlx90614_registry_check((const uint8_t *)&header,
+                                                   sizeof(header) - sizeof(uint32_t))))          /* check the header */
+    {
+        registry->inited = 1;                                                                    /* flag finish initialization */
+        
+        return 0;                                                                                /* success return 0 */
+    }
+    
+    for (i = 0; i < registry->capacity; i++)                                                     /* erase all slots */
+    {
+        if (a_mlx90614_registry_erase(registry, i) != 0)                                         /* erase the slot */
+        {
+            return 1;                                                                            /* return error */
+        }
+    }
+    memset(&header, 0, sizeof(header));                                                          /* clear the header */
+    header.magic = MLX90614_REGISTRY_MAGIC;                                                      /* set the magic */
+    header.version = MLX90614_REGISTRY_VERSION;                                                  /* set the version */
+    header.entry_size = MLX90614_REGISTRY_ENTRY_SIZE;                                            /* set the entry size */
+    header.capacity = registry->capacity;                                                        /* set the capacity */
+    header.check = a_mlx90614_registry_check((const uint8_t *)&header,
+                                             sizeof(header) - sizeof(uint32_t));                 /* set the checksum */
+    if (a_mlx90614_registry_write(registry, 0, (const uint8_t *)&header, sizeof(header)) != 0)   /* write the header last */
+    {
+        return 1;                                                                                /* return error */
+    }
+    registry->inited = 1;                                                                        /* flag finish initialization */
+    
+    return 5;                                                                                    /* formatted */
+}
+
+/**
+ * @brief      get an entry by slot
+ * @param[in]  *registry pointer to an mlx90614 registry structure
+ * @param[in]  index slot index
+ * @param[out] *entry pointer to an entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ *             - 4 slot is empty, broken or superseded
+ * @note       none
+ */
+uint8_t mlx90614_registry_get(mlx90614_registry_t *registry, uint32_t index, mlx90614_registry_entry_t *entry)
+{
+    if ((registry == NULL) || (entry == NULL) || (registry->inited != 1))        /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    if (index >= registry->capacity)                                             /* check the index */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    return (a_mlx90614_registry_live(registry, index, entry) != 0) ? 0 : 4;      /* load the slot */
+}
+
+/**
+ * @brief      find an entry by chip id
+ * @param[in]  *registry pointer to an mlx90614 registry structure
+ * @param[in]  id 64 bits chip id
+ * @param[out] *entry pointer to an entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 find failed
+ *             - 4 not found
+ * @note       none
+ */
+uint8_t mlx90614_registry_find(mlx90614_registry_t *registry, uint64_t id, mlx90614_registry_entry_t *entry)
+{
+    uint32_t index;
+    
+    if ((registry == NULL) || (entry == NULL) || (registry->inited != 1))        /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    if ((a_mlx90614_registry_newest(registry, id, entry, &index) != 0) &&
+        ((entry->flags & MLX90614_REGISTRY_FLAG_VALID) != 0))                    /* the newest record stores the chip */
+    {
+        return 0;                                                                /* found */
+    }
+    
+    return 4;                                                                    /* not found */
+}
+
+/**
+ * @brief      find an entry by iic address
+ * @param[in]  *registry pointer to an mlx90614 registry structure
+ * @param[in]  addr iic address
+ * @param[out] *entry pointer to an entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 find failed
+ *             - 4 not found
+ * @note       at startup only the address is known, the entry gives the id to verify against
+ */
+uint8_t mlx90614_registry_find_addr(mlx90614_registry_t *registry, uint8_t addr, mlx90614_registry_entry_t *entry)
+{
+    mlx90614_registry_entry_t slot;
+    uint32_t i;
+    uint8_t found;
+    
+    if ((registry == NULL) || (entry == NULL) || (registry->inited != 1))        /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    found = 0;                                                                   /* not found yet */
+    for (i = 0; i < registry->capacity; i++)                                     /* all slots */
+    {
+        if ((a_mlx90614_registry_live(registry, i, &slot) != 0) && (slot.addr == addr) &&
+            ((found == 0) || (slot.sequence > entry->sequence)))                 /* the newest chip there */
+        {
+            *entry = slot;                                                       /* save the entry */
+            found = 1;                                                           /* found */
+        }
+    }
+    
+    return (found != 0) ? 0 : 4;                                                 /* return the result */
+}
+
+/**
+ * @brief     insert or update an entry
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] *entry pointer to an entry
+ * @return    status code
+ *            - 0 success
+ *            - 1 store failed
+ *            - 4 registry is full
+ * @note      the entry is appended with the next sequence and replaces the older record of the same id,
+ *            an unchanged entry is not written, an other entry on the same address is removed because the
+ *            chip there was replaced, a full image behind a write function stays full until it is erased
+ */
+uint8_t mlx90614_registry_store(mlx90614_registry_t *registry, const mlx90614_registry_entry_t *entry)
+{
+    mlx90614_registry_entry_t slot;
+    uint32_t i;
+    uint8_t res;
+    
+    if ((registry == NULL) || (entry == NULL) || (registry->inited != 1))                            /* check the params */
+    {
+        return 1;                                                                                    /* return error */
+    }
+    
+    if ((a_mlx90614_registry_newest(registry, entry->id, &slot, &i) != 0) &&
+        ((slot.flags & MLX90614_REGISTRY_FLAG_VALID) != 0) &&
+        (slot.addr == entry->addr) && (slot.config1 == entry->config1) &&
+        (slot.emissivity == entry->emissivity) &&
+        (slot.ambient_offset == entry->ambient_offset) &&
+        (slot.object_offset == entry->object_offset))                                                /* check for changes */
+    {
+        return 0;                                                                                    /* nothing to write */
+    }
+    i = 0;                                                                                           /* first slot */
+    while (i < registry->capacity)                                                                   /* all slots */
+    {
+        if ((a_mlx90614_registry_live(registry, i, &slot) != 0) && (slot.addr == entry->addr) &&
+            (slot.id != entry->id))                                                                  /* chip was replaced */
+        {
+            res = a_mlx90614_registry_append(registry, &slot, 0);                                    /* drop the old chip */
+            if (res != 0)                                                                            /* check the result */
+            {
+                return res;                                                                          /* return error */
+            }
+            i = 0;                                                                                   /* the append may compact */
+            
+            continue;                                                                                /* restart */
+        }
+        i++;                                                                                         /* next slot */
+    }
+    
+    return a_mlx90614_registry_append(registry, entry, MLX90614_REGISTRY_FLAG_VALID);               /* append the entry */
+}
+
+/**
+ * @brief     remove an entry
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] id 64 bits chip id
+ * @return    status code
+ *            - 0 success
+ *            - 1 remove failed
+ *            - 4 not found or registry is full
+ * @note      a record without the valid flag is appended
+ */
+uint8_t mlx90614_registry_remove(mlx90614_registry_t *registry, uint64_t id)
+{
+    mlx90614_registry_entry_t slot;
+    
+    if ((registry == NULL) || (registry->inited != 1))                           /* check the params */
+    {
+        return 1;                                                                /* return error */
+    }
+    
+    if (mlx90614_registry_find(registry, id, &slot) != 0)                        /* find the chip */
+    {
+        return 4;                                                                /* not found */
+    }
+    
+    return a_mlx90614_registry_append(registry, &slot, 0);                       /* drop the chip */
+}
+
+/**
+ * @brief      read the registry fields from the chip
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *entry pointer to an entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 capture failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       reads the id, config1 and emissivity, 6 reads in total,
+ *             the calibration offsets and the sequence are left untouched
+ */
+uint8_t mlx90614_registry_capture(mlx90614_handle_t *handle, mlx90614_registry_entry_t *entry)
+{
+    uint8_t res;
+    uint16_t id[4];
+    
+    if (handle == NULL)                                                                           /* check handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+    if (entry == NULL)                                                                            /* check entry */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    
+    res = mlx90614_get_id(handle, id);                                                            /* get id */
+    if (res != 0)                                                                                 /* check result */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    res = mlx90614_get_reg(handle, MLX90614_REGISTRY_REG_CONFIG1, &entry->config1);               /* get config1 */
+    if (res != 0)                                                                                 /* check result */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    res = mlx90614_get_reg(handle, MLX90614_REGISTRY_REG_EMISSIVITY, &entry->emissivity);         /* get emissivity */
+    if (res != 0)                                                                                 /* check result */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    entry->id = ((uint64_t)id[3] << 48) | ((uint64_t)id[2] << 32) |
+                ((uint64_t)id[1] << 16) | (uint64_t)id[0];                                        /* set the id */
+    entry->addr = handle->iic_addr;                                                               /* set the address */
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     verify that the chip still matches its entry
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *entry pointer to an entry
+ * @return    status code
+ *            - 0 success
+ *            - 1 verify failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 chip has changed
+ * @note      sets the handle address to the entry address and reads config1 once,
+ *            the pec checked read proves the chip answers there and the config1 match proves the
+ *            provisioning is still in place, so the caller can skip the eeprom setup,
+ *            a replaced chip with the same config1 is only caught by mlx90614_registry_capture
+ */
+uint8_t mlx90614_registry_verify(mlx90614_handle_t *handle, const mlx90614_registry_entry_t *entry)
+{
+    uint8_t res;
+    uint16_t config1;
+    
+    if (handle == NULL)                                                                    /* check handle */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if (handle->inited != 1)                                                               /* check handle initialization */
+    {
+        return 3;                                                                          /* return error */
+    }
+    if (entry == NULL)                                                                     /* check entry */
+    {
+        return 1;                                                                          /* return error */
+    }
+    
+    handle->iic_addr = entry->addr;                                                        /* set the address */
+    handle->config1_valid = 0;                                                             /* config1 is not cached */
+    res = mlx90614_get_reg(handle, MLX90614_REGISTRY_REG_CONFIG1, &config1);               /* one pec checked read */
+    if (res != 0)                                                                          /* check result */
+    {
+        return 1;                                                                          /* return error */
+    }
+    
+    return (config1 == entry->config1) ? 0 : 4;                                            /* compare the config1 */
+}
@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_registry.h
+ * @brief     driver mlx90614 registry header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_REGISTRY_H
+#define DRIVER_MLX90614_REGISTRY_H
+
+#include "driver_mlx90614.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mlx90614_registry_driver mlx90614 registry driver function
+ * @brief    mlx90614 registry driver modules
+ * @ingroup  mlx90614_driver
+ * @{
+ */
+
+/**
+ * @brief mlx90614 registry format definition
+ */
+#define MLX90614_REGISTRY_MAGIC            0x52584C4DU        /**< image magic "MLXR" */
+#define MLX90614_REGISTRY_VERSION          2                  /**< format version, 2 appends records to erased slots */
+#define MLX90614_REGISTRY_HEADER_SIZE      32                 /**< image header size */
+#define MLX90614_REGISTRY_ENTRY_SIZE       32                 /**< entry size */
+#define MLX90614_REGISTRY_SIZE(n)          (MLX90614_REGISTRY_HEADER_SIZE + (n) * MLX90614_REGISTRY_ENTRY_SIZE) /**< image size of n entries */
+
+/**
+ * @brief mlx90614 registry entry flag definition
+ */
+#define MLX90614_REGISTRY_FLAG_VALID       (1 << 0)           /**< record stores the chip, a record without it removes the chip */
+
+/**
+ * @brief mlx90614 registry header structure definition
+ */
+typedef struct mlx90614_registry_header_s
+{
+    uint32_t magic;               /**< image magic */
+    uint16_t version;             /**< format version */
+    uint16_t entry_size;          /**< entry size */
+    uint32_t capacity;            /**< entry number */
+    uint32_t reserved[4];         /**< reserved */
+    uint32_t check;               /**< fnv-1a checksum of the bytes above */
+} mlx90614_registry_header_t;
+
+/**
+ * @brief mlx90614 registry entry structure definition
+ */
+typedef struct mlx90614_registry_entry_s
+{
+    uint64_t id;                  /**< 64 bits chip id */
+    uint8_t addr;                 /**< iic address the chip answers on */
+    uint8_t flags;                /**< entry flags */
+    uint16_t config1;             /**< last known config1 register */
+    uint16_t emissivity;          /**< last known emissivity register */
+    uint16_t reserved;            /**< reserved */
+    int32_t ambient_offset;       /**< ambient calibration offset in 0.001K */
+    int32_t object_offset;        /**< object calibration offset in 0.001K */
+    uint32_t sequence;            /**< record counter, the newest record of a chip wins */
+    uint32_t check;               /**< fnv-1a checksum of the bytes above */
+} mlx90614_registry_entry_t;
+
+/**
+ * @brief mlx90614 registry structure definition
+ */
+typedef struct mlx90614_registry_s
+{
+    uint8_t *image;                                                      /**< readable image, mapped file or flash page */
+    uint32_t capacity;                                                   /**< entry number */
+    uint8_t (*write)(uint32_t offset, const uint8_t *buf, uint32_t len); /**< image write function, NULL means a writable image */
+    uint8_t inited;                                                      /**< inited flag */
+} mlx90614_registry_t;
+
+/**
+ * @brief     attach a registry image
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] *image pointer to an image buffer
+ * @param[in] size image size in bytes
+ * @param[in] *write pointer to an image write function, NULL writes the image directly
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 4 image is too small
+ *            - 5 image was invalid and has been formatted
+ * @note      the image is read in place, writes go through the write function so a flash page
+ *            can be programmed by the platform, an image with a wrong magic, version or size is formatted,
+ *            empty slots are erased to 0xFF and records are only appended, so after the format the write
+ *            function only programs erased bytes, a flash page must be erased before it is formatted because
+ *            the format can not set bits, a full flash page stays full until the platform erases it and inits
+ *            it again, an image without a write function is compacted in place when it is full
+ */
+uint8_t mlx90614_registry_init(mlx90614_registry_t *registry, uint8_t *image, uint32_t size,
+                               uint8_t (*write)(uint32_t offset, const uint8_t *buf, uint32_t len));
+
+/**
+ * @brief      get an entry by slot
+ * @param[in]  *registry pointer to an mlx90614 registry structure
+ * @param[in]  index slot index
+ * @param[out] *entry pointer to an entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ *             - 4 slot is empty, broken or superseded
+ * @note       none
+ */
+uint8_t mlx90614_registry_get(mlx90614_registry_t *registry, uint32_t index, mlx90614_registry_entry_t *entry);
+
+/**
+ * @brief      find an entry by chip id
+ * @param[in]  *registry pointer to an mlx90614 registry structure
+ * @param[in]  id 64 bits chip id
+ * @param[out] *entry pointer to an entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 find failed
+ *             - 4 not found
+ * @note       none
+ */
+uint8_t mlx90614_registry_find(mlx90614_registry_t *registry, uint64_t id, mlx90614_registry_entry_t *entry);
+
+/**
+ * @brief      find an entry by iic address
+ * @param[in]  *registry pointer to an mlx90614 registry structure
+ * @param[in]  addr iic address
+ * @param[out] *entry pointer to an entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 find failed
+ *             - 4 not found
+ * @note       at startup only the address is known, the entry gives the id to verify against
+ */
+uint8_t mlx90614_registry_find_addr(mlx90614_registry_t *registry, uint8_t addr, mlx90614_registry_entry_t *entry);
+
+/**
+ * @brief     insert or update an entry
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] *entry pointer to an entry
+ * @return    status code
+ *            - 0 success
+ *            - 1 store failed
+ *            - 4 registry is full
+ * @note      the entry is appended with the next sequence and replaces the older record of the same id,
+ *            an unchanged entry is not written, an other entry on the same address is removed because the
+ *            chip there was replaced, a full image behind a write function stays full until it is erased
+ */
+uint8_t mlx90614_registry_store(mlx90614_registry_t *registry, const mlx90614_registry_entry_t *entry);
+
+/**
+ * @brief     remove an entry
+ * @param[in] *registry pointer to an mlx90614 registry structure
+ * @param[in] id 64 bits chip id
+ * @return    status code
+ *            - 0 success
+ *            - 1 remove failed
+ *            - 4 not found or registry is full
+ * @note      a record without the valid flag is appended
+ */
+uint8_t mlx90614_registry_remove(mlx90614_registry_t *registry, uint64_t id);
+
+/**
+ * @brief      read the registry fields from the chip
+ * @param[in]  *handle pointer to an mlx90614 handle structure
+ * @param[out] *entry pointer to an entry buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 capture failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       reads the id, config1 and emissivity, 6 reads in total,
+ *             the calibration offsets and the sequence are left untouched
+ */
+uint8_t mlx90614_registry_capture(mlx90614_handle_t *handle, mlx90614_registry_entry_t *entry);
+
+/**
+ * @brief     verify that the chip still matches its entry
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @param[in] *entry pointer to an entry
+ * @return    status code
+ *            - 0 success
+ *            - 1 verify failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 chip has changed
+ * @note      sets the handle address to the entry address and reads config1 once,
+ *            the pec checked read proves the chip answers there and the config1 match proves the
+ *            provisioning is still in place, so the caller can skip the eeprom setup,
+ *            a replaced chip with the same config1 is only caught by mlx90614_registry_capture
+ */
+uint8_t mlx90614_registry_verify(mlx90614_handle_t *handle, const mlx90614_registry_entry_t *entry);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_adaptive_test.c
+ * @brief     driver mlx90614 adaptive test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_adaptive_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief adaptive test definition
+ */
+#define MLX90614_ADAPTIVE_TEST_CONFIG1        0x9FB4        /**< factory config1, fir 1024 and iir 4 */
+
+static mlx90614_handle_t gs_handle;              /**< mlx90614 handle */
+static uint8_t gs_error;                         /**< set the object error flag once */
+
+/**
+ * @brief     get the synthetic object temperature
+ * @param[in] ms virtual time in ms
+ * @return    temperature in centi celsius
+ * @note      25C for 60 s, a step to 60C, 60C for 20 s, a 2C/s ramp for 20 s, then 100C,
+ *            with one lsb of noise
+ */
+static int32_t a_mlx90614_adaptive_test_object(uint32_t ms)
+{
+    int32_t c;
+    
+    if (ms < 60000)
+    {
+        c = 2500;
+    }
+    else if (ms < 80000)
+    {
+        c = 6000;
+    }
+    else if (ms < 100000)
+    {
+        c = 6000 + (int32_t)(ms - 80000) / 5;
+    }
+    else
+    {
+        c = 10000;
+    }
+    
+    return c + 2 * ((rand() % 3) - 1);
+}
+
+/**
+ * @brief     update tobj1 before it is read
+ * @param[in] reg read register
+ * @note      tobj1 follows the virtual clock
+ */
+static void a_mlx90614_adaptive_test_read_hook(uint8_t reg)
+{
+    uint16_t v;
+    
+    if (reg == 0x07)
+    {
+        v = (uint16_t)((a_mlx90614_adaptive_test_object(mlx90614_bus_test_get_time_ms()) + 27315) / 2);
+        if (gs_error != 0)
+        {
+            v |= 0x8000;
+            gs_error = 0;
+        }
+        mlx90614_bus_test_set_word(reg, v);
+    }
+}
+
+/**
+ * @brief     adaptive sampling test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the sampler reads a synthetic chip through a fake bus on a virtual clock, no chip is needed
+ */
+uint8_t mlx90614_adaptive_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t ramp_slow;
+    uint32_t t;
+    uint32_t now;
+    uint32_t next_ms;
+    uint32_t step_ms;
+    uint32_t samples;
+    uint64_t elapsed_ms;
+    uint16_t ambient_raw;
+    uint16_t object_raw;
+    mlx90614_temperature_t ambient;
+    mlx90614_temperature_t object;
+    mlx90614_adaptive_t adaptive;
+    mlx90614_adaptive_stats_t stats;
+    
+    /* link the synthetic chip */
+    mlx90614_bus_test_link(&gs_handle);
+    mlx90614_bus_test_set_read_hook(a_mlx90614_adaptive_test_read_hook);
+    
+    /* start adaptive test */
+    mlx90614_interface_debug_print("mlx90614: start adaptive test.\n");
+    
+    /* set the synthetic chip */
+    mlx90614_bus_test_set_word(0x06, (25 * 100 + 27315) / 2);
+    mlx90614_bus_test_set_word(0x25, MLX90614_ADAPTIVE_TEST_CONFIG1);
+    res = mlx90614_set_addr(&gs_handle, MLX90614_ADDRESS_DEFAULT);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: set addr failed.\n");
+        
+        return 1;
+    }
+    res = mlx90614_init(&gs_handle);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: init failed.\n");
+        
+        return 1;
+    }
+    
+    for (t = 0; t < times; t++)
+    {
+        mlx90614_interface_debug_print("mlx90614: %d/%d.\n", t + 1, times);
+        res = mlx90614_adaptive_init(&adaptive, &gs_handle, NULL);
+        if (res != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614: adaptive init failed.\n");
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        mlx90614_interface_debug_print("mlx90614: refresh period is %dms, floor period is %dms.\n",
+                                       adaptive.refresh_ms, adaptive.floor_ms);
+        if (adaptive.floor_ms != ((adaptive.refresh_ms > MLX90614_ADAPTIVE_DEFAULT_MIN_PERIOD_MS) ?
+                                   adaptive.refresh_ms : MLX90614_ADAPTIVE_DEFAULT_MIN_PERIOD_MS))
+        {
+            mlx90614_interface_debug_print("mlx90614: floor period check failed.\n");
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* run the stream for 160 s of virtual time */
+        mlx90614_bus_test_set_time_ms(0);
+        gs_error = 0;
+        elapsed_ms = 0;
+        samples = 0;
+        step_ms = 0;
+        ramp_slow = 0;
+        next_ms = 0;
+        while (mlx90614_bus_test_get_time_ms() < 160000)
+        {
+            now = mlx90614_bus_test_get_time_ms();
+            if ((now >= 30000) && (now < 30000 + next_ms))
+            {
+                /* one sample with the error flag in the stable phase */
+                gs_error = 1;
+            }
+            res = mlx90614_adaptive_sample(&adaptive, &ambient_raw, &ambient, &object_raw, &object, &next_ms);
+            if ((res != 0) && (res != 4))
+            {
+                mlx90614_interface_debug_print("mlx90614: adaptive sample failed.\n");
+                (void)mlx90614_deinit(&gs_handle);
+                
+                return 1;
+            }
+            samples++;
+            
+            /* the stable phase has backed off to the max period before the step */
+            if ((now < 60000) && (now + next_ms >= 60000) &&
+                (next_ms != MLX90614_ADAPTIVE_DEFAULT_MAX_PERIOD_MS))
+            {
+                mlx90614_interface_debug_print("mlx90614: back off check failed, period is %dms.\n", next_ms);
+                (void)mlx90614_deinit(&gs_handle);
+                
+                return 1;
+            }
+            
+            /* the first sample after the step drops to the floor */
+            if ((now >= 60000) && (step_ms == 0))
+            {
+                step_ms = now;
+                if (next_ms != adaptive.floor_ms)
+                {
+                    mlx90614_interface_debug_print("mlx90614: step check failed, period is %dms.\n", next_ms);
+                    (void)mlx90614_deinit(&gs_handle);
+                    
+                    return 1;
+                }
+            }
+            
+            /* the ramp keeps the floor */
+            if ((now >= 80000 + 2 * adaptive.floor_ms) && (now < 100000) && (next_ms != adaptive.floor_ms))
+            {
+                ramp_slow = 1;
+            }
+            
+            mlx90614_bus_test_set_time_ms(now + next_ms);
+            elapsed_ms += next_ms;
+        }
+        elapsed_ms -= next_ms;
+        mlx90614_interface_debug_print("mlx90614: step sampled at %dms, last period is %dms.\n", step_ms, next_ms);
+        if ((ramp_slow != 0) || (next_ms != MLX90614_ADAPTIVE_DEFAULT_MAX_PERIOD_MS))
+        {
+            mlx90614_interface_debug_print("mlx90614: ramp and settle check failed.\n");
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* stats */
+        res = mlx90614_adaptive_get_stats(&adaptive, &stats);
+        if (res != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614: adaptive get stats failed.\n");
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        mlx90614_interface_debug_print("mlx90614: samples %d failures %d triggers %d.\n", stats.samples, stats.failures, stats.triggers);
+        mlx90614_interface_debug_print("mlx90614: fixed samples %d saved samples %d saved %d ppm.\n",
+                                       (uint32_t)stats.fixed_samples, (uint32_t)stats.saved_samples, stats.saved_ppm);
+        if ((stats.samples + stats.failures != samples) || (stats.failures != 1) || (stats.triggers == 0) ||
+            (stats.fixed_samples != elapsed_ms / adaptive.floor_ms + 1) ||
+            (stats.saved_samples != stats.fixed_samples - samples) ||
+            (stats.saved_bus_us != stats.saved_samples * 2 * MLX90614_ADAPTIVE_DEFAULT_READ_US))
+        {
+            mlx90614_interface_debug_print("mlx90614: stats check failed.\n");
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* finish adaptive test */
+    mlx90614_interface_debug_print("mlx90614: finish adaptive test.\n");
+    (void)mlx90614_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,311 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_aggregate_test.c
+ * @brief     driver mlx90614 aggregate test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_aggregate_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief aggregate test definition
+ */
+#define MLX90614_AGGREGATE_TEST_SAMPLES        2000          /**< samples of one stream */
+#define MLX90614_AGGREGATE_TEST_RECORDS        4096          /**< max records of one stream */
+#define MLX90614_AGGREGATE_TEST_GAP_MS         200000        /**< long gap, longer than every window */
+#define MLX90614_AGGREGATE_TEST_SHORT_GAP_MS   3000          /**< short gap, shorter than the sliding windows */
+#define MLX90614_AGGREGATE_TEST_FLAG_PERIOD    97            /**< one raw in a period has the error flag */
+
+static const uint32_t gsc_window[MLX90614_AGGREGATE_WINDOW_MAX][2] =
+{
+    {60000, 60000},        /* 1 minute tumbling */
+    {10000, 2000},         /* 10 s sliding in 2 s steps */
+    {8000, 1000},          /* 8 s sliding in 1 s steps */
+    {1000, 1000},          /* 1 s tumbling */
+};
+
+static uint32_t gs_time_ms[MLX90614_AGGREGATE_TEST_SAMPLES];                         /**< sample times */
+static uint16_t gs_raw[MLX90614_AGGREGATE_TEST_SAMPLES];                             /**< sample raw data */
+static mlx90614_aggregate_record_t gs_record[MLX90614_AGGREGATE_TEST_RECORDS];       /**< emitted records */
+static uint32_t gs_records;                                                          /**< emitted record number */
+
+/**
+ * @brief     save a record
+ * @param[in] *arg callback argument
+ * @param[in] *record pointer to a record
+ * @note      none
+ */
+static void a_mlx90614_aggregate_test_callback(void *arg, const mlx90614_aggregate_record_t *record)
+{
+    (void)arg;
+    if (gs_records < MLX90614_AGGREGATE_TEST_RECORDS)
+    {
+        gs_record[gs_records] = *record;
+    }
+    gs_records++;
+}
+
+/**
+ * @brief  get a synthetic stream
+ * @note   a random walk with jittered periods, one long gap, one short gap and some raws with the error flag
+ */
+static void a_mlx90614_aggregate_test_stream(void)
+{
+    uint32_t i;
+    uint32_t t;
+    int32_t raw;
+    
+    t = 1000000 + (uint32_t)(rand() % 1000);
+    raw = 15000;
+    for (i = 0; i < MLX90614_AGGREGATE_TEST_SAMPLES; i++)
+    {
+        if (i == (MLX90614_AGGREGATE_TEST_SAMPLES / 2))
+        {
+            t += MLX90614_AGGREGATE_TEST_GAP_MS;
+        }
+        else if (i == (MLX90614_AGGREGATE_TEST_SAMPLES / 4))
+        {
+            t += MLX90614_AGGREGATE_TEST_SHORT_GAP_MS;
+        }
+        t += 50 + (uint32_t)(rand() % 400);
+        raw += (rand() % 21) - 10;
+        gs_time_ms[i] = t;
+        gs_raw[i] = (uint16_t)raw;
+        if ((i % MLX90614_AGGREGATE_TEST_FLAG_PERIOD) == (MLX90614_AGGREGATE_TEST_FLAG_PERIOD / 2))
+        {
+            gs_raw[i] |= 0x8000U;
+        }
+    }
+}
+
+/**
+ * @brief      recompute a window
+ * @param[in]  start_ms window start in ms
+ * @param[in]  length_ms window length in ms
+ * @param[out] *record pointer to a record
+ * @note       one pass over every sample
+ */
+static void a_mlx90614_aggregate_test_window(uint32_t start_ms, uint32_t length_ms, mlx90614_aggregate_record_t *record)
+{
+    uint32_t i;
+    uint64_t sum;
+    
+    sum = 0;
+    memset(record, 0, sizeof(mlx90614_aggregate_record_t));
+    record->start_ms = start_ms;
+    for (i = 0; i < MLX90614_AGGREGATE_TEST_SAMPLES; i++)
+    {
+        if (((gs_time_ms[i] - start_ms) >= length_ms) || ((gs_raw[i] & 0x8000U) != 0))
+        {
+            continue;
+        }
+        if ((record->count == 0) || (gs_raw[i] < record->min))
+        {
+            record->min = gs_raw[i];
+        }
+        if ((record->count == 0) || (gs_raw[i] > record->max))
+        {
+            record->max = gs_raw[i];
+        }
+        record->last = gs_raw[i];
+        sum += gs_raw[i];
+        record->count++;
+    }
+    if (record->count != 0)
+    {
+        record->mean = (uint16_t)((sum + record->count / 2) / record->count);
+    }
+}
+
+/**
+ * @brief     window aggregate test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the aggregator is fed with a synthetic raw stream with gaps and every record is checked
+ *            against a brute force recompute, no chip is needed
+ */
+uint8_t mlx90614_aggregate_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t w;
+    uint8_t index;
+    uint32_t t;
+    uint32_t i;
+    uint32_t r;
+    uint32_t s;
+    uint32_t first;
+    uint32_t end;
+    uint32_t expected;
+    uint32_t flagged;
+    mlx90614_aggregate_t aggregate;
+    mlx90614_aggregate_record_t ref;
+    
+    /* start aggregate test */
+    mlx90614_interface_debug_print("mlx90614: start aggregate test.\n");
+    
+    for (t = 0; t < times; t++)
+    {
+        mlx90614_interface_debug_print("mlx90614: %d/%d.\n", t + 1, times);
+        
+        /* init the windows */
+        res = mlx90614_aggregate_init(&aggregate, a_mlx90614_aggregate_test_callback, NULL);
+        if (res != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614: aggregate init failed.\n");
+            
+            return 1;
+        }
+        if ((mlx90614_aggregate_add_window(&aggregate, 0, 0, NULL) != 5) ||
+            (mlx90614_aggregate_add_window(&aggregate, 10000, 3000, NULL) != 5) ||
+            (mlx90614_aggregate_add_window(&aggregate, 9000, 1000, NULL) != 5))
+        {
+            mlx90614_interface_debug_print("mlx90614: invalid window check failed.\n");
+            
+            return 1;
+        }
+        for (w = 0; w < MLX90614_AGGREGATE_WINDOW_MAX; w++)
+        {
+            res = mlx90614_aggregate_add_window(&aggregate, gsc_window[w][0], gsc_window[w][1], &index);
+            if ((res != 0) || (index != w))
+            {
+                mlx90614_interface_debug_print("mlx90614: aggregate add window failed.\n");
+                
+                return 1;
+            }
+        }
+        if (mlx90614_aggregate_add_window(&aggregate, 1000, 1000, NULL) != 4)
+        {
+            mlx90614_interface_debug_print("mlx90614: full window check failed.\n");
+            
+            return 1;
+        }
+        
+        /* feed the stream */
+        a_mlx90614_aggregate_test_stream();
+        gs_records = 0;
+        flagged = 0;
+        for (i = 0; i < MLX90614_AGGREGATE_TEST_SAMPLES; i++)
+        {
+            res = mlx90614_aggregate_update(&aggregate, gs_time_ms[i], gs_raw[i]);
+            if (res != (((gs_raw[i] & 0x8000U) != 0) ? 4 : 0))
+            {
+                mlx90614_interface_debug_print("mlx90614: aggregate update sample %d check failed.\n", i);
+                
+                return 1;
+            }
+            flagged += (uint32_t)(res == 4);
+        }
+        (void)mlx90614_aggregate_flush(&aggregate);
+        mlx90614_interface_debug_print("mlx90614: %d samples %d rejected %d records.\n", aggregate.samples,
+                                       aggregate.rejected, aggregate.records);
+        if ((gs_records > MLX90614_AGGREGATE_TEST_RECORDS) || (gs_records != aggregate.records) ||
+            (aggregate.rejected != flagged) || (aggregate.samples + flagged != MLX90614_AGGREGATE_TEST_SAMPLES))
+        {
+            mlx90614_interface_debug_print("mlx90614: record number check failed.\n");
+            
+            return 1;
+        }
+        
+        /* every non empty window up to the flush is emitted once in order */
+        for (w = 0; w < MLX90614_AGGREGATE_WINDOW_MAX; w++)
+        {
+            first = gs_time_ms[0] - (gs_time_ms[0] % gsc_window[w][1]) + gsc_window[w][1] - gsc_window[w][0];
+            end = gs_time_ms[MLX90614_AGGREGATE_TEST_SAMPLES - 1] -
+                  (gs_time_ms[MLX90614_AGGREGATE_TEST_SAMPLES - 1] % gsc_window[w][1]) + gsc_window[w][1];
+            expected = 0;
+            r = 0;
+            for (s = first; (s + gsc_window[w][0]) <= end; s += gsc_window[w][1])
+            {
+                a_mlx90614_aggregate_test_window(s, gsc_window[w][0], &ref);
+                if (ref.count == 0)
+                {
+                    continue;
+                }
+                expected++;
+                while ((r < gs_records) && (gs_record[r].window != w))
+                {
+                    r++;
+                }
+                if ((r == gs_records) || (gs_record[r].start_ms != ref.start_ms) || (gs_record[r].count != ref.count) ||
+                    (gs_record[r].min != ref.min) || (gs_record[r].max != ref.max) ||
+                    (gs_record[r].mean != ref.mean) || (gs_record[r].last != ref.last))
+                {
+                    mlx90614_interface_debug_print("mlx90614: window %d record at %u ms check failed.\n", w, s);
+                    
+                    return 1;
+                }
+                r++;
+            }
+            while ((r < gs_records) && (gs_record[r].window != w))
+            {
+                r++;
+            }
+            if (r != gs_records)
+            {
+                mlx90614_interface_debug_print("mlx90614: window %d extra record check failed.\n", w);
+                
+                return 1;
+            }
+            mlx90614_interface_debug_print("mlx90614: window %d length %dms step %dms %d records check ok.\n",
+                                           w, gsc_window[w][0], gsc_window[w][1], expected);
+        }
+        
+        /* a flushed aggregator starts again */
+        gs_records = 0;
+        (void)mlx90614_aggregate_update(&aggregate, gs_time_ms[0], gs_raw[0]);
+        (void)mlx90614_aggregate_flush(&aggregate);
+        if (gs_records != MLX90614_AGGREGATE_WINDOW_MAX)
+        {
+            mlx90614_interface_debug_print("mlx90614: flush restart check failed.\n");
+            
+            return 1;
+        }
+        for (w = 0; w < MLX90614_AGGREGATE_WINDOW_MAX; w++)
+        {
+            if ((gs_record[w].count != 1) || (gs_record[w].mean != gs_raw[0]))
+            {
+                mlx90614_interface_debug_print("mlx90614: flush restart check failed.\n");
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* finish aggregate test */
+    mlx90614_interface_debug_print("mlx90614: finish aggregate test.\n");
+    
+    return 0;
+}
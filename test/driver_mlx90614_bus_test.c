@@ -0,0 +1,342 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_bus_test.c
+ * @brief     driver mlx90614 synthetic bus test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_bus_test.h"
+
+/**
+ * @brief bus test definition
+ */
+#define MLX90614_BUS_TEST_FLAGS        0xF0        /**< read flags command */
+#define MLX90614_BUS_TEST_SLEEP        0xFF        /**< enter sleep command */
+#define MLX90614_BUS_TEST_TOBJ1        0x07        /**< ram tobj1 command */
+#define MLX90614_BUS_TEST_INIT         0x10        /**< init done flag */
+
+static uint16_t gs_word[0x40];                    /**< chip cells */
+static uint32_t gs_time_ms;                       /**< virtual clock */
+static uint32_t gs_wake_ms;                       /**< time of the last wake up */
+static uint32_t gs_latency_ms;                    /**< wake to valid latency */
+static uint8_t gs_sleep;                          /**< chip sleeps */
+static uint8_t gs_sda;                            /**< sda level */
+static void (*gs_hook)(uint8_t reg);              /**< read hook */
+
+/**
+ * @brief     calculate the smbus pec
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    pec
+ * @note      crc8 with the polynomial x^8 + x^2 + x + 1
+ */
+static uint8_t a_mlx90614_bus_test_pec(const uint8_t *data, uint8_t len)
+{
+    uint8_t crc = 0;
+    uint8_t i;
+    
+    while (len-- != 0)
+    {
+        crc ^= *data++;
+        for (i = 0; i < 8; i++)
+        {
+            crc = (uint8_t)(((crc & 0x80) != 0) ? ((crc << 1) ^ 0x07) : (crc << 1));
+        }
+    }
+    
+    return crc;
+}
+
+/**
+ * @brief  check the wake to valid latency
+ * @return 1 the data is valid, 0 it is not
+ * @note   none
+ */
+static uint8_t a_mlx90614_bus_test_valid(void)
+{
+    return (uint8_t)((gs_time_ms - gs_wake_ms) >= gs_latency_ms);
+}
+
+/**
+ * @brief  iic bus init
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_mlx90614_bus_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  iic bus deinit
+ * @return status code
+ * @note   none
+ */
+static uint8_t a_mlx90614_bus_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      iic bus read of the synthetic chip
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ * @note       a sleeping chip does not answer
+ */
+static uint8_t a_mlx90614_bus_test_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t arr[5];
+    uint16_t v;
+    
+    if (gs_sleep != 0)
+    {
+        return 1;
+    }
+    if (reg == MLX90614_BUS_TEST_FLAGS)
+    {
+        buf[0] = (a_mlx90614_bus_test_valid() != 0) ? MLX90614_BUS_TEST_INIT : 0;
+        
+        return 0;
+    }
+    if ((len != 3) || (reg >= 0x40))
+    {
+        return 1;
+    }
+    if (gs_hook != NULL)
+    {
+        gs_hook(reg);
+    }
+    v = gs_word[reg];
+    if ((reg == MLX90614_BUS_TEST_TOBJ1) && (a_mlx90614_bus_test_valid() == 0))
+    {
+        v = 0;
+    }
+    arr[0] = addr;
+    arr[1] = reg;
+    arr[2] = (uint8_t)(addr + 1);
+    arr[3] = (uint8_t)(v & 0xFF);
+    arr[4] = (uint8_t)(v >> 8);
+    buf[0] = arr[3];
+    buf[1] = arr[4];
+    buf[2] = a_mlx90614_bus_test_pec(arr, 5);
+    
+    return 0;
+}
+
+/**
+ * @brief     iic bus write of the synthetic chip
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ * @note      a cell write or the sleep command with a wrong pec is not acknowledged
+ */
+static uint8_t a_mlx90614_bus_test_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t arr[4];
+    
+    if (gs_sleep != 0)
+    {
+        return 1;
+    }
+    arr[0] = addr;
+    arr[1] = reg;
+    if ((reg == MLX90614_BUS_TEST_SLEEP) && (len == 1))
+    {
+        if (a_mlx90614_bus_test_pec(arr, 2) != buf[0])
+        {
+            return 1;
+        }
+        gs_sleep = 1;
+        
+        return 0;
+    }
+    if ((len != 3) || (reg >= 0x40))
+    {
+        return 1;
+    }
+    arr[2] = buf[0];
+    arr[3] = buf[1];
+    if (a_mlx90614_bus_test_pec(arr, 4) != buf[2])
+    {
+        return 1;
+    }
+    gs_word[reg] = (uint16_t)(((uint16_t)buf[1] << 8) | buf[0]);
+    
+    return 0;
+}
+
+/**
+ * @brief     scl write
+ * @param[in] v written value
+ * @return    status code
+ * @note      none
+ */
+static uint8_t a_mlx90614_bus_test_scl_write(uint8_t v)
+{
+    (void)v;
+    
+    return 0;
+}
+
+/**
+ * @brief     sda write
+ * @param[in] v written value
+ * @return    status code
+ * @note      releasing sda after a low pulse wakes the chip up
+ */
+static uint8_t a_mlx90614_bus_test_sda_write(uint8_t v)
+{
+    if ((v != 0) && (gs_sda == 0))
+    {
+        gs_sleep = 0;
+        gs_wake_ms = gs_time_ms;
+    }
+    gs_sda = (uint8_t)(v != 0);
+    
+    return 0;
+}
+
+/**
+ * @brief     delay on the virtual clock
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_mlx90614_bus_test_delay_ms(uint32_t ms)
+{
+    gs_time_ms += ms;
+}
+
+/**
+ * @brief     link the synthetic chip to a handle
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @note      clears the handle and links the fake smbus, the pins, the virtual clock delay and get_time_ms,
+ *            the chip cells, the clock and the wake state are reset
+ */
+void mlx90614_bus_test_link(mlx90614_handle_t *handle)
+{
+    DRIVER_MLX90614_LINK_INIT(handle, mlx90614_handle_t);
+    DRIVER_MLX90614_LINK_IIC_INIT(handle, a_mlx90614_bus_test_iic_init);
+    DRIVER_MLX90614_LINK_IIC_DEINIT(handle, a_mlx90614_bus_test_iic_deinit);
+    DRIVER_MLX90614_LINK_IIC_READ(handle, a_mlx90614_bus_test_iic_read);
+    DRIVER_MLX90614_LINK_IIC_WRITE(handle, a_mlx90614_bus_test_iic_write);
+    DRIVER_MLX90614_LINK_SCL_WRITE(handle, a_mlx90614_bus_test_scl_write);
+    DRIVER_MLX90614_LINK_SDA_WRITE(handle, a_mlx90614_bus_test_sda_write);
+    DRIVER_MLX90614_LINK_DELAY_MS(handle, a_mlx90614_bus_test_delay_ms);
+    DRIVER_MLX90614_LINK_DEBUG_PRINT(handle, mlx90614_interface_debug_print);
+    DRIVER_MLX90614_LINK_GET_TIME_MS(handle, mlx90614_bus_test_get_time_ms);
+    memset(gs_word, 0, sizeof(gs_word));
+    gs_time_ms = 0;
+    gs_wake_ms = 0;
+    gs_latency_ms = 0;
+    gs_sleep = 0;
+    gs_sda = 1;
+    gs_hook = NULL;
+}
+
+/**
+ * @brief     set a chip cell
+ * @param[in] reg ram or eeprom command
+ * @param[in] data cell data
+ * @note      none
+ */
+void mlx90614_bus_test_set_word(uint8_t reg, uint16_t data)
+{
+    gs_word[reg & 0x3F] = data;
+}
+
+/**
+ * @brief     get a chip cell
+ * @param[in] reg ram or eeprom command
+ * @return    cell data
+ * @note      none
+ */
+uint16_t mlx90614_bus_test_get_word(uint8_t reg)
+{
+    return gs_word[reg & 0x3F];
+}
+
+/**
+ * @brief     set the read hook
+ * @param[in] *hook pointer to a hook function, NULL means none
+ * @note      the hook runs before a cell is served and may change it with mlx90614_bus_test_set_word
+ */
+void mlx90614_bus_test_set_read_hook(void (*hook)(uint8_t reg))
+{
+    gs_hook = hook;
+}
+
+/**
+ * @brief     set the virtual clock
+ * @param[in] ms time in ms
+ * @note      delay_ms advances the clock
+ */
+void mlx90614_bus_test_set_time_ms(uint32_t ms)
+{
+    gs_time_ms = ms;
+}
+
+/**
+ * @brief  get the virtual clock
+ * @return time in ms
+ * @note   none
+ */
+uint32_t mlx90614_bus_test_get_time_ms(void)
+{
+    return gs_time_ms;
+}
+
+/**
+ * @brief     set the wake to valid latency
+ * @param[in] ms latency in ms
+ * @note      the clock starts when sda is released after a low pulse, until then the init flag is
+ *            ongoing and tobj1 reads 0, a sleeping chip does not answer
+ */
+void mlx90614_bus_test_set_wake_latency(uint32_t ms)
+{
+    gs_latency_ms = ms;
+}
+
+/**
+ * @brief  get the sleep state
+ * @return 1 the chip sleeps, 0 it is awake
+ * @note   none
+ */
+uint8_t mlx90614_bus_test_get_sleep(void)
+{
+    return gs_sleep;
+}
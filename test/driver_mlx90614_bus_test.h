@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_bus_test.h
+ * @brief     driver mlx90614 synthetic bus test header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MLX90614_BUS_TEST_H
+#define DRIVER_MLX90614_BUS_TEST_H
+
+#include "driver_mlx90614_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup mlx90614_test_driver
+ * @{
+ */
+
+/**
+ * @brief     link the synthetic chip to a handle
+ * @param[in] *handle pointer to an mlx90614 handle structure
+ * @note      clears the handle and links the fake smbus, the pins, the virtual clock delay and get_time_ms,
+ *            the chip cells, the clock and the wake state are reset
+ */
+void mlx90614_bus_test_link(mlx90614_handle_t *handle);
+
+/**
+ * @brief     set a chip cell
+ * @param[in] reg ram or eeprom command
+ * @param[in] data cell data
+ * @note      none
+ */
+void mlx90614_bus_test_set_word(uint8_t reg, uint16_t data);
+
+/**
+ * @brief     get a chip cell
+ * @param[in] reg ram or eeprom command
+ * @return    cell data
+ * @note      none
+ */
+uint16_t mlx90614_bus_test_get_word(uint8_t reg);
+
+/**
+ * @brief     set the read hook
+ * @param[in] *hook pointer to a hook function, NULL means none
+ * @note      the hook runs before a cell is served and may change it with mlx90614_bus_test_set_word
+ */
+void mlx90614_bus_test_set_read_hook(void (*hook)(uint8_t reg));
+
+/**
+ * @brief     set the virtual clock
+ * @param[in] ms time in ms
+ * @note      delay_ms advances the clock
+ */
+void mlx90614_bus_test_set_time_ms(uint32_t ms);
+
+/**
+ * @brief  get the virtual clock
+ * @return time in ms
+ * @note   none
+ */
+uint32_t mlx90614_bus_test_get_time_ms(void);
+
+/**
+ * @brief     set the wake to valid latency
+ * @param[in] ms latency in ms
+ * @note      the clock starts when sda is released after a low pulse, until then the init flag is
+ *            ongoing and tobj1 reads 0, a sleeping chip does not answer
+ */
+void mlx90614_bus_test_set_wake_latency(uint32_t ms);
+
+/**
+ * @brief  get the sleep state
+ * @return 1 the chip sleeps, 0 it is awake
+ * @note   none
+ */
+uint8_t mlx90614_bus_test_get_sleep(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
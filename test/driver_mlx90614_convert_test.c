@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_convert_test.c
+ * @brief     driver mlx90614 convert test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_convert_test.h"
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief convert test definition
+ */
+#define MLX90614_CONVERT_TEST_LEN           1024         /**< buffer length */
+#define MLX90614_CONVERT_TEST_LOOP          10000        /**< benchmark loops of one round */
+
+static uint16_t gs_raw[MLX90614_CONVERT_TEST_LEN];                   /**< raw data buffer */
+static float gs_out[MLX90614_CONVERT_TEST_LEN];                      /**< float buffer */
+static int32_t gs_milli[MLX90614_CONVERT_TEST_LEN];                  /**< millidegree buffer */
+static uint8_t gs_mask[MLX90614_CONVERT_TEST_LEN / 8];               /**< error mask buffer */
+static const char *const gs_unit[3] = {"C", "K", "F"};               /**< unit name */
+static const char *const gs_simd[4] = {"none", "sse2", "avx2", "neon"};        /**< simd name */
+
+/**
+ * @brief     get the benchmark speed
+ * @param[in] start start clock
+ * @return    million samples per second
+ * @note      none
+ */
+static double a_mlx90614_convert_test_speed(clock_t start)
+{
+    double s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    
+    if (s <= 0.0)
+    {
+        return 0.0;
+    }
+    
+    return (double)MLX90614_CONVERT_TEST_LEN * MLX90614_CONVERT_TEST_LOOP / s / 1000000.0;
+}
+
+/**
+ * @brief     convert test
+ * @param[in] times benchmark times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+uint8_t mlx90614_convert_test(uint32_t times)
+{
+#ifndef MLX90614_FIXED_POINT
+    const float scale[3] = {0.02f, 0.02f, 0.036f};
+    const float offset[3] = {-273.15f, 0.0f, -459.67f};
+#endif
+    const int32_t milli_scale[3] = {20, 20, 36};
+    const int32_t milli_offset[3] = {-273150, 0, -459670};
+    uint32_t base;
+    uint32_t i;
+    uint32_t j;
+    uint32_t unit;
+    uint32_t error;
+    uint32_t check;
+    
+    /* start convert test */
+    mlx90614_interface_debug_print("mlx90614: start convert test.\n");
+    mlx90614_interface_debug_print("mlx90614: simd path is %s.\n", gs_simd[mlx90614_convert_get_simd()]);
+    
+    /* check every raw value, odd lengths cover the scalar tail */
+    for (unit = 0; unit < 3; unit++)
+    {
+        for (base = 0; base < 0x10000; base += MLX90614_CONVERT_TEST_LEN)
+        {
+            uint32_t len = MLX90614_CONVERT_TEST_LEN - ((base / MLX90614_CONVERT_TEST_LEN) % 17);
+            
+            for (i = 0; i < len; i++)
+            {
+                gs_raw[i] = (uint16_t)(base + i);
+            }
+            
+#ifndef MLX90614_FIXED_POINT
+            /* float */
+            memset(gs_mask, 0xA5, sizeof(gs_mask));
+            if (mlx90614_convert_to_float(gs_raw, gs_out, len, (mlx90614_convert_unit_t)unit, gs_mask, &error) != 0)
+            {
+                mlx90614_interface_debug_print("mlx90614: convert to float failed.\n");
+                
+                return 1;
+            }
+            check = 0;
+            for (i = 0; i < len; i++)
+            {
+                float ref = (float)gs_raw[i] * scale[unit] + offset[unit];
+                uint8_t flag = (uint8_t)((gs_mask[i / 8] >> (i % 8)) & 0x01);
+                
+                if ((gs_out[i] - ref > 0.001f) || (ref - gs_out[i] > 0.001f) || (flag != (gs_raw[i] >> 15)))
+                {
+                    mlx90614_interface_debug_print("mlx90614: float check failed at 0x%04X.\n", gs_raw[i]);
+                    
+                    return 1;
+                }
+                check += gs_raw[i] >> 15;
+            }
+            if (check != error)
+            {
+                mlx90614_interface_debug_print("mlx90614: float error number check failed.\n");
+                
+                return 1;
+            }
+#endif
+            
+            /* millidegree */
+            memset(gs_mask, 0x5A, sizeof(gs_mask));
+            if (mlx90614_convert_to_milli(gs_raw, gs_milli, len, (mlx90614_convert_unit_t)unit, gs_mask, &error) != 0)
+            {
+                mlx90614_interface_debug_print("mlx90614: convert to milli failed.\n");
+                
+                return 1;
+            }
+            check = 0;
+            for (i = 0; i < len; i++)
+            {
+                uint8_t flag = (uint8_t)((gs_mask[i / 8] >> (i % 8)) & 0x01);
+                
+                if ((gs_milli[i] != (int32_t)gs_raw[i] * milli_scale[unit] + milli_offset[unit]) ||
+                    (flag != (gs_raw[i] >> 15)))
+                {
+                    mlx90614_interface_debug_print("mlx90614: milli check failed at 0x%04X.\n", gs_raw[i]);
+                    
+                    return 1;
+                }
+                check += gs_raw[i] >> 15;
+            }
+            if (check != error)
+            {
+                mlx90614_interface_debug_print("mlx90614: milli error number check failed.\n");
+                
+                return 1;
+            }
+        }
+        mlx90614_interface_debug_print("mlx90614: unit %s check passed.\n", gs_unit[unit]);
+    }
+    
+    /* ambient like raw data with a few error flags */
+    srand(0);
+    for (i = 0; i < MLX90614_CONVERT_TEST_LEN; i++)
+    {
+        gs_raw[i] = (uint16_t)(14000 + rand() % 3000);
+        if ((rand() % 100) == 0)
+        {
+            gs_raw[i] |= 0x8000;
+        }
+    }
+    
+    /* benchmark */
+    for (i = 0; i < times; i++)
+    {
+        clock_t start;
+        volatile float sink = 0.0f;
+        double single;
+#ifndef MLX90614_FIXED_POINT
+        double bulk;
+#endif
+        double milli;
+        
+        /* one value at a time as the read functions do */
+        start = clock();
+        for (j = 0; j < MLX90614_CONVERT_TEST_LOOP; j++)
+        {
+            uint32_t k;
+            
+            error = 0;
+            for (k = 0; k < MLX90614_CONVERT_TEST_LEN; k++)
+            {
+                if ((gs_raw[k] & 0x8000) != 0)
+                {
+                    error++;
+                    
+                    continue;
+                }
+                gs_out[k] = (float)gs_raw[k] * 0.02f - 273.15f;
+            }
+            sink += gs_out[j % MLX90614_CONVERT_TEST_LEN] + (float)error;
+        }
+        single = a_mlx90614_convert_test_speed(start);
+        
+#ifndef MLX90614_FIXED_POINT
+        /* bulk float */
+        start = clock();
+        for (j = 0; j < MLX90614_CONVERT_TEST_LOOP; j++)
+        {
+            (void)mlx90614_convert_to_float(gs_raw, gs_out, MLX90614_CONVERT_TEST_LEN,
+                                            MLX90614_CONVERT_UNIT_CELSIUS, gs_mask, &error);
+            sink += gs_out[j % MLX90614_CONVERT_TEST_LEN] + (float)error;
+        }
+        bulk = a_mlx90614_convert_test_speed(start);
+#endif
+        
+        /* bulk millidegree */
+        start = clock();
+        for (j = 0; j < MLX90614_CONVERT_TEST_LOOP; j++)
+        {
+            (void)mlx90614_convert_to_milli(gs_raw, gs_milli, MLX90614_CONVERT_TEST_LEN,
+                                            MLX90614_CONVERT_UNIT_CELSIUS, gs_mask, &error);
+            sink += (float)gs_milli[j % MLX90614_CONVERT_TEST_LEN] + (float)error;
+        }
+        milli = a_mlx90614_convert_test_speed(start);
+        (void)sink;
+        
+        /* output */
+        mlx90614_interface_debug_print("mlx90614: %d/%d.\n", i + 1, times);
+#ifndef MLX90614_FIXED_POINT
+        mlx90614_interface_debug_print("mlx90614: single %0.1f Msamples/s, bulk float %0.1f Msamples/s, bulk milli %0.1f Msamples/s.\n",
+                                       single, bulk, milli);
+#else
+        mlx90614_interface_debug_print("mlx90614: single %0.1f Msamples/s, bulk milli %0.1f Msamples/s.\n",
+                                       single, milli);
+#endif
+    }
+    
+    /* finish convert test */
+    mlx90614_interface_debug_print("mlx90614: finish convert test.\n");
+    
+    return 0;
+}
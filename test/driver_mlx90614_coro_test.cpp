@@ -0,0 +1,393 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_coro_test.cpp
+ * @brief     driver mlx90614 c++20 coroutine test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_coro.hpp"
+#include <cstdio>
+
+/**
+ * @brief coroutine test default definition
+ */
+#define MLX90614_CORO_TEST_CHIPS        2          /**< simulated chips on the bus */
+#define MLX90614_CORO_TEST_WAKE_MS      33         /**< shortest sda low time that wakes a chip */
+#define MLX90614_CORO_TEST_SETTLE_MS    250        /**< time from the wake up to the first valid data */
+
+/**
+ * @brief mlx90614 simulated chip structure definition
+ */
+struct SimChip
+{
+    uint8_t addr;                  /**< iic address */
+    bool asleep;                   /**< sleep flag, a sleeping chip nacks */
+    uint32_t valid_ms;             /**< time of the first valid object data */
+    uint32_t busy_ms;              /**< end time of the running eeprom cycle */
+    uint16_t ram[0x20];            /**< ram registers */
+    uint16_t eeprom[0x20];         /**< eeprom registers */
+};
+
+static SimChip gs_chip[MLX90614_CORO_TEST_CHIPS];                /**< simulated chips */
+static mlx90614::coro::Executor *gs_ex = nullptr;                /**< executor of the virtual clock */
+static uint32_t gs_sda_low_ms = 0;                               /**< time sda went low */
+static uint32_t gs_blocking_ms = 0;                              /**< time spent in delay_ms */
+static uint32_t gs_busy_writes = 0;                              /**< writes during an eeprom cycle */
+
+/**
+ * @brief     find a simulated chip
+ * @param[in] addr iic address
+ * @return    pointer to the chip or nullptr
+ * @note      none
+ */
+static SimChip *a_sim_find(uint8_t addr)
+{
+    for (SimChip &chip : gs_chip)
+    {
+        if (chip.addr == addr)
+        {
+            return &chip;
+        }
+    }
+    
+    return nullptr;
+}
+
+/**
+ * @brief mlx90614 simulated transport structure definition
+ * @note  the chips share the executor clock, a sleeping chip or a busy eeprom nacks
+ */
+struct SimTransport
+{
+    static uint8_t iic_init() { return 0; }
+    static uint8_t iic_deinit() { return 0; }
+    
+    static uint8_t iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+    {
+        SimChip *chip = a_sim_find(addr);
+        uint32_t now = gs_ex->now();
+        uint16_t data;
+        uint8_t pec;
+        
+        if ((chip == nullptr) || chip->asleep || (len != 3) || mlx90614::coro::detail::before(now, chip->busy_ms))
+        {
+            return 1;
+        }
+        if (reg < 0x20)
+        {
+            data = chip->ram[reg];
+            if ((reg == mlx90614::detail::REG_RAM_TOBJ1) && mlx90614::coro::detail::before(now, chip->valid_ms))
+            {
+                data = 0x0000;
+            }
+        }
+        else if (reg < 0x40)
+        {
+            data = chip->eeprom[reg - 0x20];
+        }
+        else
+        {
+            return 1;
+        }
+        buf[0] = static_cast<uint8_t>(data & 0xFFU);
+        buf[1] = static_cast<uint8_t>(data >> 8);
+        pec = mlx90614::detail::crc8(mlx90614::detail::crc8(mlx90614::detail::crc8(0, addr), reg), static_cast<uint8_t>(addr + 1));
+        buf[2] = mlx90614::detail::crc8(mlx90614::detail::crc8(pec, buf[0]), buf[1]);
+        
+        return 0;
+    }
+    
+    static uint8_t iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+    {
+        SimChip *chip = a_sim_find(addr);
+        uint32_t now = gs_ex->now();
+        
+        if ((chip == nullptr) || chip->asleep)
+        {
+            return 1;
+        }
+        if (reg == mlx90614::detail::COMMAND_SLEEP)
+        {
+            chip->asleep = true;
+            
+            return 0;
+        }
+        if ((reg < 0x20) || (reg >= 0x40) || (len != 3))
+        {
+            return 1;
+        }
+        if (mlx90614::coro::detail::before(now, chip->busy_ms))
+        {
+            gs_busy_writes++;
+            
+            return 1;
+        }
+        if ((buf[0] == 0) && (buf[1] == 0))
+        {
+            chip->eeprom[reg - 0x20] = 0x0000;
+        }
+        else if (chip->eeprom[reg - 0x20] == 0x0000)
+        {
+            chip->eeprom[reg - 0x20] = static_cast<uint16_t>((static_cast<uint16_t>(buf[1]) << 8) | buf[0]);
+        }
+        else
+        {
+            return 1;
+        }
+        chip->busy_ms = now + MLX90614_EEPROM_WRITE_MS;
+        
+        return 0;
+    }
+    
+    static uint8_t scl_write(uint8_t v)
+    {
+        (void)v;
+        
+        return 0;
+    }
+    
+    static uint8_t sda_write(uint8_t v)
+    {
+        uint32_t now = gs_ex->now();
+        
+        if (v == 0)
+        {
+            gs_sda_low_ms = now;
+            
+            return 0;
+        }
+        if ((now - gs_sda_low_ms) >= MLX90614_CORO_TEST_WAKE_MS)
+        {
+            for (SimChip &chip : gs_chip)
+            {
+                if (chip.asleep)
+                {
+                    chip.asleep = false;
+                    chip.valid_ms = now + MLX90614_CORO_TEST_SETTLE_MS;
+                }
+            }
+        }
+        gs_sda_low_ms = now;
+        
+        return 0;
+    }
+    
+    static void delay_ms(uint32_t ms) { gs_blocking_ms += ms; }
+};
+
+using Chip = mlx90614::Mlx90614<SimTransport>;
+using AsyncChip = mlx90614::coro::AsyncMlx90614<SimTransport>;
+
+/**
+ * @brief     reset the simulated chips
+ * @param[in] &ex executor of the virtual clock
+ * @note      none
+ */
+static void a_sim_reset(mlx90614::coro::Executor &ex)
+{
+    for (uint8_t i = 0; i < MLX90614_CORO_TEST_CHIPS; i++)
+    {
+        gs_chip[i] = SimChip{};
+        gs_chip[i].addr = static_cast<uint8_t>(0xB4 + 2 * i);
+        gs_chip[i].ram[mlx90614::detail::REG_RAM_TA] = 0x3AF7;
+        gs_chip[i].ram[mlx90614::detail::REG_RAM_TOBJ1] = static_cast<uint16_t>(0x3B1C + i);
+        gs_chip[i].eeprom[0x04] = 0xFFFF;
+    }
+    gs_ex = &ex;
+    gs_sda_low_ms = ex.now();
+    gs_blocking_ms = 0;
+    gs_busy_writes = 0;
+}
+
+/**
+ * @brief      sleep both chips and wake them with one request
+ * @param[in]  &a first chip
+ * @param[in]  &b second chip
+ * @param[out] &res status
+ * @return     task
+ * @note       the wake up pulse of the first chip wakes the second chip too
+ */
+static mlx90614::coro::Task<void> a_wake_task(AsyncChip &a, AsyncChip &b, mlx90614::Result<void> &res)
+{
+    res = co_await a.enter_sleep();
+    if (res)
+    {
+        res = co_await b.enter_sleep();
+    }
+    if (res)
+    {
+        res = co_await a.exit_sleep();
+    }
+    if (res)
+    {
+        res = co_await b.wait_ready(0);
+    }
+}
+
+/**
+ * @brief      write the emissivity and read one sample
+ * @param[in]  &chip used chip
+ * @param[in]  emissivity raw emissivity
+ * @param[out] &res status
+ * @param[out] &done_ms finish time
+ * @return     task
+ * @note       straight line code, the executor interleaves the chips
+ */
+static mlx90614::coro::Task<void> a_provision_task(AsyncChip &chip, uint16_t emissivity, mlx90614::Result<mlx90614::Sample> &res, uint32_t &done_ms,
+                                                   mlx90614::coro::Executor &ex)
+{
+    mlx90614::Result<void> w = co_await chip.write_eeprom(0x24, emissivity);
+    
+    if (!w)
+    {
+        res = mlx90614::unexpected(w.error());
+        
+        co_return;
+    }
+    res = co_await chip.read();
+    done_ms = ex.now();
+}
+
+/**
+ * @brief     run the scenario
+ * @param[in] tick_ms poll step of an rtos tick, 0 runs the virtual clock
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+static uint8_t a_coro_run(uint32_t tick_ms)
+{
+    mlx90614::coro::Executor ex(0xFFFFFF00U);
+    mlx90614::Result<void> wake = mlx90614::unexpected(mlx90614::Error::Bus);
+    mlx90614::Result<mlx90614::Sample> sample[MLX90614_CORO_TEST_CHIPS] = {mlx90614::unexpected(mlx90614::Error::Bus),
+                                                                            mlx90614::unexpected(mlx90614::Error::Bus)};
+    uint32_t done_ms[MLX90614_CORO_TEST_CHIPS] = {0, 0};
+    uint32_t start;
+    uint32_t wake_ms;
+    uint32_t write_ms;
+    
+    a_sim_reset(ex);
+    auto chip_a = Chip::open(gs_chip[0].addr);
+    auto chip_b = Chip::open(gs_chip[1].addr);
+    if (!chip_a || !chip_b)
+    {
+        return 1;
+    }
+    AsyncChip a(ex, *chip_a);
+    AsyncChip b(ex, *chip_b);
+    
+    /* wake up, the clock starts near the 32 bit wrap */
+    start = ex.now();
+    ex.spawn(a_wake_task(a, b, wake));
+    if (tick_ms == 0)
+    {
+        (void)ex.run();
+    }
+    else
+    {
+        while (ex.poll(ex.now() + tick_ms))
+        {
+        }
+    }
+    wake_ms = ex.now() - start;
+    if (!wake || (wake_ms < (1 + MLX90614_WAKE_PULSE_MS + MLX90614_CORO_TEST_SETTLE_MS)) || (wake_ms > MLX90614_WAKE_PULSE_MS + MLX90614_READY_TIMEOUT_MS))
+    {
+        printf("mlx90614: wake up failed after %ums.\n", static_cast<unsigned int>(wake_ms));
+        
+        return 1;
+    }
+    
+    /* two eeprom writes in parallel */
+    start = ex.now();
+    ex.spawn(a_provision_task(a, 0xF333, sample[0], done_ms[0], ex));
+    ex.spawn(a_provision_task(b, 0xE666, sample[1], done_ms[1], ex));
+    if (tick_ms == 0)
+    {
+        (void)ex.run();
+    }
+    else
+    {
+        while (ex.poll(ex.now() + tick_ms))
+        {
+        }
+    }
+    write_ms = ex.now() - start;
+    if (!sample[0] || !sample[1] || (gs_chip[0].eeprom[0x04] != 0xF333) || (gs_chip[1].eeprom[0x04] != 0xE666))
+    {
+        printf("mlx90614: eeprom write failed.\n");
+        
+        return 1;
+    }
+    if ((sample[0]->object == sample[1]->object) || ((done_ms[0] - start) != (done_ms[1] - start)))
+    {
+        printf("mlx90614: samples are wrong.\n");
+        
+        return 1;
+    }
+    if ((write_ms < 2 * MLX90614_EEPROM_WRITE_MS) || (write_ms >= 4 * MLX90614_EEPROM_WRITE_MS))
+    {
+        printf("mlx90614: eeprom writes took %ums, they did not overlap.\n", static_cast<unsigned int>(write_ms));
+        
+        return 1;
+    }
+    if ((gs_blocking_ms != 0) || (gs_busy_writes != 0))
+    {
+        printf("mlx90614: %ums blocking delay, %u writes to a busy eeprom.\n", static_cast<unsigned int>(gs_blocking_ms),
+               static_cast<unsigned int>(gs_busy_writes));
+        
+        return 1;
+    }
+    printf("mlx90614: %s wake up %ums, two eeprom writes %ums, 0ms blocking.\n", (tick_ms == 0) ? "virtual clock" : "tick poll",
+           static_cast<unsigned int>(wake_ms), static_cast<unsigned int>(write_ms));
+    
+    return 0;
+}
+
+/**
+ * @brief  coroutine test main function
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs the scenario on the virtual clock and on a 1ms tick
+ */
+int main()
+{
+    if ((a_coro_run(0) != 0) || (a_coro_run(1) != 0))
+    {
+        return 1;
+    }
+    printf("mlx90614: finish coroutine test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,274 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_cpp_benchmark.cpp
+ * @brief     driver mlx90614 c++ wrapper benchmark source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614.h"
+#include "driver_mlx90614.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @brief benchmark default definition
+ */
+#define MLX90614_BENCHMARK_LOOPS        1000000        /**< default read loops */
+#define MLX90614_BENCHMARK_ADDR         0xB4           /**< simulated chip address */
+
+static uint8_t gs_frame[0x40][3];        /**< read frames of the simulated chip with their pec */
+
+/**
+ * @brief     set a register of the simulated chip
+ * @param[in] reg register address
+ * @param[in] data register data
+ * @note      the read frame is built once, so a read costs the same on both paths
+ */
+static void a_sim_set(uint8_t reg, uint16_t data)
+{
+    uint8_t pec;
+    
+    gs_frame[reg][0] = static_cast<uint8_t>(data & 0xFFU);
+    gs_frame[reg][1] = static_cast<uint8_t>(data >> 8);
+    pec = mlx90614::detail::crc8(mlx90614::detail::crc8(0, MLX90614_BENCHMARK_ADDR), reg);
+    pec = mlx90614::detail::crc8(pec, MLX90614_BENCHMARK_ADDR + 1);
+    pec = mlx90614::detail::crc8(mlx90614::detail::crc8(pec, gs_frame[reg][0]), gs_frame[reg][1]);
+    gs_frame[reg][2] = pec;
+}
+
+/**
+ * @brief  simulated iic init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_sim_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_sim_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      simulated iic read
+ * @param[in]  addr iic device address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_sim_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    if ((len != 3) || (reg >= 0x40))
+    {
+        return 1;
+    }
+    buf[0] = gs_frame[reg][0];
+    buf[1] = gs_frame[reg][1];
+    buf[2] = gs_frame[reg][2];
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated iic write
+ * @param[in] addr iic device address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ * @note      writes are dropped
+ */
+static uint8_t a_sim_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)reg;
+    (void)buf;
+    (void)len;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated scl or sda write
+ * @param[in] v written value
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_sim_pin_write(uint8_t v)
+{
+    (void)v;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulated delay
+ * @param[in] ms time
+ * @note      returns at once
+ */
+static void a_sim_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief     simulated debug print
+ * @param[in] fmt format data
+ * @note      prints nothing
+ */
+static void a_sim_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief mlx90614 simulated transport structure definition
+ */
+struct SimTransport
+{
+    static uint8_t iic_init() { return a_sim_iic_init(); }
+    static uint8_t iic_deinit() { return a_sim_iic_deinit(); }
+    static uint8_t iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len) { return a_sim_iic_read(addr, reg, buf, len); }
+    static uint8_t iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len) { return a_sim_iic_write(addr, reg, buf, len); }
+    static uint8_t scl_write(uint8_t v) { return a_sim_pin_write(v); }
+    static uint8_t sda_write(uint8_t v) { return a_sim_pin_write(v); }
+    static void delay_ms(uint32_t ms) { a_sim_delay_ms(ms); }
+};
+
+/**
+ * @brief     benchmark main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      argv[1] sets the loops, each loop reads the ambient and the object1 temperature
+ */
+int main(int argc, char **argv)
+{
+    uint32_t i;
+    uint32_t loops;
+    uint16_t raw;
+    double c_ns;
+    double cpp_ns;
+    mlx90614_handle_t handle;
+    mlx90614_temperature_t ambient;
+    mlx90614_temperature_t object;
+    volatile mlx90614_temperature_t sink = 0;
+    
+    loops = (argc > 1) ? static_cast<uint32_t>(strtoul(argv[1], NULL, 10)) : MLX90614_BENCHMARK_LOOPS;
+    if (loops == 0)
+    {
+        return 1;
+    }
+    a_sim_set(0x06, 0x3AF7);
+    a_sim_set(0x07, 0x3B1C);
+    
+    /* c api */
+    DRIVER_MLX90614_LINK_INIT(&handle, mlx90614_handle_t);
+    DRIVER_MLX90614_LINK_IIC_INIT(&handle, a_sim_iic_init);
+    DRIVER_MLX90614_LINK_IIC_DEINIT(&handle, a_sim_iic_deinit);
+    DRIVER_MLX90614_LINK_IIC_READ(&handle, a_sim_iic_read);
+    DRIVER_MLX90614_LINK_IIC_WRITE(&handle, a_sim_iic_write);
+    DRIVER_MLX90614_LINK_SCL_WRITE(&handle, a_sim_pin_write);
+    DRIVER_MLX90614_LINK_SDA_WRITE(&handle, a_sim_pin_write);
+    DRIVER_MLX90614_LINK_DELAY_MS(&handle, a_sim_delay_ms);
+    DRIVER_MLX90614_LINK_DEBUG_PRINT(&handle, a_sim_debug_print);
+    if ((mlx90614_set_addr(&handle, MLX90614_BENCHMARK_ADDR) != 0) || (mlx90614_init(&handle) != 0))
+    {
+        return 1;
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (i = 0; i < loops; i++)
+    {
+        if ((mlx90614_read_ambient(&handle, &raw, &ambient) != 0) ||
+            (mlx90614_read_object1(&handle, &raw, &object) != 0))
+        {
+            return 1;
+        }
+        sink = sink + ambient + object;
+    }
+    auto stop = std::chrono::steady_clock::now();
+    c_ns = std::chrono::duration<double, std::nano>(stop - start).count() / loops;
+    (void)mlx90614_deinit(&handle);
+    
+    /* c++ wrapper */
+    auto chip = mlx90614::Mlx90614<SimTransport>::open(MLX90614_BENCHMARK_ADDR);
+    if (!chip)
+    {
+        return 1;
+    }
+    start = std::chrono::steady_clock::now();
+    for (i = 0; i < loops; i++)
+    {
+        auto sample = chip->read();
+        
+        if (!sample)
+        {
+            return 1;
+        }
+        sink = sink + sample->ambient + sample->object;
+    }
+    stop = std::chrono::steady_clock::now();
+    cpp_ns = std::chrono::duration<double, std::nano>(stop - start).count() / loops;
+    
+    /* both paths must agree */
+    if ((chip->read()->ambient != ambient) || (chip->read()->object != object))
+    {
+        printf("mlx90614: c and c++ results differ.\n");
+        
+        return 1;
+    }
+    
+    printf("mlx90614: %u reads over the simulated transport.\n", static_cast<unsigned int>(loops));
+    printf("mlx90614: c api %.1fns c++ wrapper %.1fns per read, %.2fx.\n", c_ns, cpp_ns, c_ns / cpp_ns);
+    
+    return 0;
+}
@@ -0,0 +1,340 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_detector_test.c
+ * @brief     driver mlx90614 detector test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_detector_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief detector test definition
+ */
+#define MLX90614_DETECTOR_TEST_STEP_MS        100        /**< sample period in ms */
+#ifdef MLX90614_FIXED_POINT
+#define MLX90614_DETECTOR_TEST_TEMPERATURE(c)        ((mlx90614_temperature_t)(c) * (MLX90614_FIXED_POINT / 100))        /**< centi celsius to temperature */
+#else
+#define MLX90614_DETECTOR_TEST_TEMPERATURE(c)        ((mlx90614_temperature_t)(c) / 100.0f)                               /**< centi celsius to temperature */
+#endif
+
+/**
+ * @brief detector test scenario structure definition
+ */
+typedef struct mlx90614_detector_test_scenario_s
+{
+    const char *name;                        /**< scenario name */
+    mlx90614_detector_type_t type;           /**< rule type */
+    int32_t limit;                           /**< limit in centi celsius */
+    int32_t hysteresis;                      /**< hysteresis in centi celsius */
+    uint32_t hold_ms;                        /**< hold time in ms */
+    uint8_t len;                             /**< sample number */
+    int32_t sample[20];                      /**< samples in centi celsius, one a step */
+    uint8_t expect[20];                      /**< 0 no event, 1 active, 2 cleared */
+} mlx90614_detector_test_scenario_t;
+
+static const mlx90614_detector_test_scenario_t gsc_scenario[3] =
+{
+    {
+        "high hysteresis", MLX90614_DETECTOR_TYPE_HIGH, 5000, 200, 0, 8,
+        {2500, 5000, 5001, 4900, 4800, 4799, 4900, 5100},
+        {0,    0,    1,    0,    0,    2,    0,    1},
+    },
+    {
+        "low hold", MLX90614_DETECTOR_TYPE_LOW, 0, 100, 500, 17,
+        {500, -100, -100, 50, -100, -100, -100, -100, -100, -100, 50, 150, 150, 150, 150, 150, 150},
+        {0,   0,    0,    0,  0,    0,    0,    0,    0,    1,    0,  0,   0,   0,   0,   0,   2},
+    },
+    {
+        "rate hysteresis", MLX90614_DETECTOR_TYPE_RATE, 500, 100, 0, 5,
+        {2000, 2020, 2100, 2145, 2180},
+        {0,    0,    1,    0,    2},
+    },
+};
+
+static mlx90614_handle_t gs_handle;              /**< mlx90614 handle */
+static mlx90614_detector_t gs_detector;          /**< event detector */
+static uint32_t gs_callbacks;                    /**< callback times */
+
+/**
+ * @brief     count the callbacks
+ * @param[in] *arg callback argument
+ * @param[in] *event pointer to an event
+ * @note      none
+ */
+static void a_mlx90614_detector_test_callback(void *arg, const mlx90614_detector_event_t *event)
+{
+    (void)arg;
+    (void)event;
+    gs_callbacks++;
+}
+
+/**
+ * @brief     init the detector with one rule
+ * @param[in] source watched temperature
+ * @param[in] type rule type
+ * @param[in] limit limit in centi celsius
+ * @param[in] hysteresis hysteresis in centi celsius
+ * @param[in] hold_ms hold time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_mlx90614_detector_test_init(mlx90614_detector_source_t source, mlx90614_detector_type_t type,
+                                             int32_t limit, int32_t hysteresis, uint32_t hold_ms)
+{
+    mlx90614_detector_rule_t rule;
+    
+    if (mlx90614_detector_init(&gs_detector, &gs_handle, a_mlx90614_detector_test_callback, NULL) != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: detector init failed.\n");
+        
+        return 1;
+    }
+    rule.source = source;
+    rule.type = type;
+    rule.limit = MLX90614_DETECTOR_TEST_TEMPERATURE(limit);
+    rule.hysteresis = MLX90614_DETECTOR_TEST_TEMPERATURE(hysteresis);
+    rule.hold_ms = hold_ms;
+    if (mlx90614_detector_add_rule(&gs_detector, &rule, NULL) != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: detector add rule failed.\n");
+        (void)mlx90614_detector_deinit(&gs_detector);
+        
+        return 1;
+    }
+    gs_callbacks = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     run a scenario
+ * @param[in] *scenario pointer to a scenario
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every sample is checked against the expected event and time
+ */
+static uint8_t a_mlx90614_detector_test_scenario(const mlx90614_detector_test_scenario_t *scenario)
+{
+    uint8_t i;
+    uint8_t events;
+    mlx90614_detector_event_t event;
+    
+    if (a_mlx90614_detector_test_init(MLX90614_DETECTOR_SOURCE_OBJECT1, scenario->type, scenario->limit,
+                                      scenario->hysteresis, scenario->hold_ms) != 0)
+    {
+        return 1;
+    }
+    events = 0;
+    for (i = 0; i < scenario->len; i++)
+    {
+        (void)mlx90614_detector_evaluate(&gs_detector, MLX90614_DETECTOR_SOURCE_AMBIENT, MLX90614_DETECTOR_TEST_TEMPERATURE(-4000));
+        (void)mlx90614_detector_evaluate(&gs_detector, MLX90614_DETECTOR_SOURCE_OBJECT1, MLX90614_DETECTOR_TEST_TEMPERATURE(scenario->sample[i]));
+        if (scenario->expect[i] != 0)
+        {
+            if ((mlx90614_detector_pop(&gs_detector, &event) != 0) || (event.rule != 0) ||
+                (event.source != MLX90614_DETECTOR_SOURCE_OBJECT1) || (event.type != scenario->type) ||
+                (event.active != (uint8_t)(scenario->expect[i] == 1)) || (event.time_ms != mlx90614_bus_test_get_time_ms()))
+            {
+                mlx90614_interface_debug_print("mlx90614: %s sample %d check failed.\n", scenario->name, i);
+                (void)mlx90614_detector_deinit(&gs_detector);
+                
+                return 1;
+            }
+            events++;
+        }
+        if (mlx90614_detector_pop(&gs_detector, &event) != 4)
+        {
+            mlx90614_interface_debug_print("mlx90614: %s sample %d unexpected event.\n", scenario->name, i);
+            (void)mlx90614_detector_deinit(&gs_detector);
+            
+            return 1;
+        }
+        mlx90614_bus_test_set_time_ms(mlx90614_bus_test_get_time_ms() + MLX90614_DETECTOR_TEST_STEP_MS);
+    }
+    (void)mlx90614_detector_deinit(&gs_detector);
+    mlx90614_interface_debug_print("mlx90614: %s %d events check ok.\n", scenario->name, events);
+    
+    return 0;
+}
+
+/**
+ * @brief     event detector test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the detector is fed with synthetic sample streams on a virtual clock through a fake bus, no chip is needed
+ */
+uint8_t mlx90614_detector_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t i;
+    uint16_t raw;
+    uint32_t t;
+    mlx90614_temperature_t celsius;
+    mlx90614_detector_event_t event;
+    
+    /* link the synthetic chip */
+    mlx90614_bus_test_link(&gs_handle);
+    
+    /* start detector test */
+    mlx90614_interface_debug_print("mlx90614: start detector test.\n");
+    
+    res = mlx90614_set_addr(&gs_handle, MLX90614_ADDRESS_DEFAULT);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: set addr failed.\n");
+        
+        return 1;
+    }
+    res = mlx90614_init(&gs_handle);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: init failed.\n");
+        
+        return 1;
+    }
+    
+    for (t = 0; t < times; t++)
+    {
+        /* the first round runs over the wrap of the clock */
+        mlx90614_bus_test_set_time_ms((t == 0) ? 0xFFFFFF00U : (uint32_t)rand());
+        mlx90614_interface_debug_print("mlx90614: %d/%d clock starts at %u ms.\n", t + 1, times, mlx90614_bus_test_get_time_ms());
+        
+        /* transitions */
+        for (i = 0; i < 3; i++)
+        {
+            if (a_mlx90614_detector_test_scenario(&gsc_scenario[i]) != 0)
+            {
+                (void)mlx90614_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        
+        /* queue overflow */
+        if (a_mlx90614_detector_test_init(MLX90614_DETECTOR_SOURCE_OBJECT1, MLX90614_DETECTOR_TYPE_HIGH, 5000, 0, 0) != 0)
+        {
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < MLX90614_DETECTOR_QUEUE_SIZE + 4; i++)
+        {
+            (void)mlx90614_detector_evaluate(&gs_detector, MLX90614_DETECTOR_SOURCE_OBJECT1,
+                                             MLX90614_DETECTOR_TEST_TEMPERATURE(((i % 2) == 0) ? 6000 : 4000));
+            mlx90614_bus_test_set_time_ms(mlx90614_bus_test_get_time_ms() + MLX90614_DETECTOR_TEST_STEP_MS);
+        }
+        mlx90614_interface_debug_print("mlx90614: callbacks %d queued %d dropped %d.\n", gs_callbacks, gs_detector.count, gs_detector.dropped);
+        if ((gs_callbacks != MLX90614_DETECTOR_QUEUE_SIZE + 4) || (gs_detector.count != MLX90614_DETECTOR_QUEUE_SIZE) ||
+            (gs_detector.dropped != 4))
+        {
+            mlx90614_interface_debug_print("mlx90614: queue overflow check failed.\n");
+            (void)mlx90614_detector_deinit(&gs_detector);
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 4; i < MLX90614_DETECTOR_QUEUE_SIZE + 4; i++)
+        {
+            /* the oldest 4 events are dropped, the rest pop in order */
+            if ((mlx90614_detector_pop(&gs_detector, &event) != 0) || (event.active != (uint8_t)((i % 2) == 0)) ||
+                (event.time_ms != mlx90614_bus_test_get_time_ms() - (uint32_t)(MLX90614_DETECTOR_QUEUE_SIZE + 4 - i) * MLX90614_DETECTOR_TEST_STEP_MS))
+            {
+                mlx90614_interface_debug_print("mlx90614: queue order check failed.\n");
+                (void)mlx90614_detector_deinit(&gs_detector);
+                (void)mlx90614_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        if (mlx90614_detector_pop(&gs_detector, &event) != 4)
+        {
+            mlx90614_interface_debug_print("mlx90614: queue empty check failed.\n");
+            (void)mlx90614_detector_deinit(&gs_detector);
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        (void)mlx90614_detector_deinit(&gs_detector);
+        mlx90614_interface_debug_print("mlx90614: queue overflow check ok.\n");
+        
+        /* reads through the sample hook */
+        if (a_mlx90614_detector_test_init(MLX90614_DETECTOR_SOURCE_OBJECT1, MLX90614_DETECTOR_TYPE_HIGH, 5000, 200, 0) != 0)
+        {
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        mlx90614_bus_test_set_word(0x06, (uint16_t)((6000 + 27315) / 2));
+        mlx90614_bus_test_set_word(0x07, (uint16_t)((6000 + 27315) / 2));
+        res = mlx90614_read_ambient(&gs_handle, &raw, &celsius);
+        if ((res != 0) || (mlx90614_detector_pop(&gs_detector, &event) != 4))
+        {
+            mlx90614_interface_debug_print("mlx90614: ambient hook check failed.\n");
+            (void)mlx90614_detector_deinit(&gs_detector);
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = mlx90614_read_object1(&gs_handle, &raw, &celsius);
+        if ((res != 0) || (mlx90614_detector_pop(&gs_detector, &event) != 0) || (event.active != 1) ||
+            (event.value != celsius) || (gs_callbacks != 1))
+        {
+            mlx90614_interface_debug_print("mlx90614: object hook check failed.\n");
+            (void)mlx90614_detector_deinit(&gs_detector);
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        (void)mlx90614_detector_deinit(&gs_detector);
+        if (gs_handle.sample_hook != NULL)
+        {
+            mlx90614_interface_debug_print("mlx90614: hook release check failed.\n");
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        mlx90614_interface_debug_print("mlx90614: sample hook check ok.\n");
+    }
+    
+    /* finish detector test */
+    mlx90614_interface_debug_print("mlx90614: finish detector test.\n");
+    (void)mlx90614_deinit(&gs_handle);
+    
+    return 0;
+}
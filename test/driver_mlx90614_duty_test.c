@@ -0,0 +1,264 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_duty_test.c
+ * @brief     driver mlx90614 duty test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_duty_test.h"
+
+/**
+ * @brief duty test definition
+ */
+#define MLX90614_DUTY_TEST_CONFIG1         0x9FB4        /**< factory config1, fir 1024 and iir 4 */
+#define MLX90614_DUTY_TEST_PERIOD_MS       1000          /**< sample period in ms */
+#define MLX90614_DUTY_TEST_CYCLES          32            /**< cycles of one run */
+#define MLX90614_DUTY_TEST_SETTLED         16            /**< cycles before the latency has converged */
+#define MLX90614_DUTY_TEST_LONG_MS         137           /**< wake latency of a long filter in ms */
+#define MLX90614_DUTY_TEST_SHORT_MS        60            /**< wake latency of a short filter in ms */
+#define MLX90614_DUTY_TEST_TIMEOUT_MS      2000          /**< wake latency beyond the timeout in ms */
+#define MLX90614_DUTY_TEST_AMBIENT         0x3A97        /**< ambient raw, 26.84C */
+#define MLX90614_DUTY_TEST_OBJECT          0x3C5B        /**< object raw, 36.90C */
+
+static mlx90614_handle_t gs_handle;        /**< mlx90614 handle */
+
+/**
+ * @brief      run the scheduler on one wake latency
+ * @param[in]  latency_ms wake to valid latency of the synthetic chip
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       the awake and sleep times are counted from the virtual clock and checked against the stats
+ */
+static uint8_t a_mlx90614_duty_test_run(uint32_t latency_ms, mlx90614_duty_stats_t *stats)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t start;
+    uint32_t awake;
+    uint32_t polls;
+    uint64_t awake_ms;
+    uint64_t sleep_ms;
+    uint64_t total;
+    uint64_t energy_nj;
+    uint16_t ambient_raw;
+    uint16_t object_raw;
+    mlx90614_temperature_t ambient;
+    mlx90614_temperature_t object;
+    mlx90614_duty_t duty;
+    
+    mlx90614_bus_test_set_wake_latency(latency_ms);
+    res = mlx90614_duty_init(&duty, &gs_handle, MLX90614_DUTY_TEST_PERIOD_MS, NULL);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: duty init failed.\n");
+        
+        return 1;
+    }
+    awake_ms = 0;
+    sleep_ms = 0;
+    for (i = 0; i < MLX90614_DUTY_TEST_CYCLES; i++)
+    {
+        start = mlx90614_bus_test_get_time_ms();
+        polls = duty.polls;
+        res = mlx90614_duty_sample(&duty, &ambient_raw, &ambient, &object_raw, &object);
+        if (res != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614: duty sample failed.\n");
+            
+            return 1;
+        }
+        if ((ambient_raw != MLX90614_DUTY_TEST_AMBIENT) || (object_raw != MLX90614_DUTY_TEST_OBJECT) ||
+            (mlx90614_bus_test_get_sleep() == 0))
+        {
+            mlx90614_interface_debug_print("mlx90614: cycle %d check failed.\n", i);
+            
+            return 1;
+        }
+        
+        /* after the probe phase the first poll misses by less than one step and the second one hits */
+        polls = duty.polls - polls;
+        if ((i >= MLX90614_DUTY_TEST_SETTLED) &&
+            ((polls != 2) || (duty.latency_ms < latency_ms) || (duty.latency_ms >= latency_ms + duty.step_ms)))
+        {
+            mlx90614_interface_debug_print("mlx90614: cycle %d latency %dms polls %d convergence check failed.\n",
+                                           i, duty.latency_ms, polls);
+            
+            return 1;
+        }
+        
+        /* the caller sleeps for the rest of the period */
+        awake = mlx90614_bus_test_get_time_ms() - start;
+        awake_ms += awake;
+        sleep_ms += (awake < MLX90614_DUTY_TEST_PERIOD_MS) ? (MLX90614_DUTY_TEST_PERIOD_MS - awake) : 0;
+        mlx90614_bus_test_set_time_ms(start + MLX90614_DUTY_TEST_PERIOD_MS);
+    }
+    
+    /* stats */
+    res = mlx90614_duty_get_stats(&duty, stats);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: duty get stats failed.\n");
+        
+        return 1;
+    }
+    mlx90614_interface_debug_print("mlx90614: wake latency %dms learned %dms min %dms max %dms.\n",
+                                   latency_ms, stats->latency_ms, stats->latency_min_ms, stats->latency_max_ms);
+    mlx90614_interface_debug_print("mlx90614: polls %d.%02d duty %d ppm average %d nA energy %d uJ per sample.\n",
+                                   stats->polls_per_sample_x100 / 100, stats->polls_per_sample_x100 % 100,
+                                   stats->duty_ppm, stats->average_na, stats->energy_per_sample_uj);
+    total = awake_ms + sleep_ms;
+    energy_nj = (uint64_t)MLX90614_DUTY_DEFAULT_SUPPLY_MV * MLX90614_DUTY_DEFAULT_ACTIVE_UA * awake_ms / 1000U +
+                (uint64_t)MLX90614_DUTY_DEFAULT_SUPPLY_MV * MLX90614_DUTY_DEFAULT_SLEEP_NA * sleep_ms / 1000000U;
+    if ((stats->samples != MLX90614_DUTY_TEST_CYCLES) || (stats->failures != 0) ||
+        (stats->latency_min_ms < latency_ms) || (stats->latency_max_ms >= latency_ms + duty.step_ms) ||
+        (stats->polls_per_sample_x100 != (uint32_t)((uint64_t)duty.polls * 100U / MLX90614_DUTY_TEST_CYCLES)) ||
+        (stats->polls_per_sample_x100 > 200) ||
+        (stats->duty_ppm != (uint32_t)(awake_ms * 1000000U / total)) ||
+        (stats->average_na != (uint32_t)(((uint64_t)MLX90614_DUTY_DEFAULT_ACTIVE_UA * 1000U * awake_ms +
+                                          (uint64_t)MLX90614_DUTY_DEFAULT_SLEEP_NA * sleep_ms) / total)) ||
+        (stats->energy_per_sample_uj != (uint32_t)(energy_nj / 1000U / MLX90614_DUTY_TEST_CYCLES)))
+    {
+        mlx90614_interface_debug_print("mlx90614: stats check failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     duty cycle test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the scheduler wakes a synthetic chip through a fake bus on a virtual clock, no chip is needed
+ */
+uint8_t mlx90614_duty_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t t;
+    uint16_t ambient_raw;
+    uint16_t object_raw;
+    mlx90614_temperature_t ambient;
+    mlx90614_temperature_t object;
+    mlx90614_duty_t duty;
+    mlx90614_duty_stats_t stats_long;
+    mlx90614_duty_stats_t stats_short;
+    mlx90614_duty_stats_t stats;
+    
+    /* link the synthetic chip */
+    mlx90614_bus_test_link(&gs_handle);
+    
+    /* start duty test */
+    mlx90614_interface_debug_print("mlx90614: start duty test.\n");
+    
+    /* set the synthetic chip */
+    mlx90614_bus_test_set_word(0x06, MLX90614_DUTY_TEST_AMBIENT);
+    mlx90614_bus_test_set_word(0x07, MLX90614_DUTY_TEST_OBJECT);
+    mlx90614_bus_test_set_word(0x25, MLX90614_DUTY_TEST_CONFIG1);
+    res = mlx90614_set_addr(&gs_handle, MLX90614_ADDRESS_DEFAULT);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: set addr failed.\n");
+        
+        return 1;
+    }
+    res = mlx90614_init(&gs_handle);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: init failed.\n");
+        
+        return 1;
+    }
+    res = mlx90614_enter_sleep_mode(&gs_handle);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: enter sleep mode failed.\n");
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    for (t = 0; t < times; t++)
+    {
+        mlx90614_interface_debug_print("mlx90614: %d/%d.\n", t + 1, times);
+        
+        /* a long and a short filter setting, the shorter wake costs less energy */
+        if ((a_mlx90614_duty_test_run(MLX90614_DUTY_TEST_LONG_MS, &stats_long) != 0) ||
+            (a_mlx90614_duty_test_run(MLX90614_DUTY_TEST_SHORT_MS, &stats_short) != 0))
+        {
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if ((stats_short.energy_per_sample_uj >= stats_long.energy_per_sample_uj) ||
+            (stats_short.duty_ppm >= stats_long.duty_ppm))
+        {
+            mlx90614_interface_debug_print("mlx90614: energy compare check failed.\n");
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* a chip that never becomes valid times out and is put back to sleep */
+        mlx90614_bus_test_set_wake_latency(MLX90614_DUTY_TEST_TIMEOUT_MS);
+        res = mlx90614_duty_init(&duty, &gs_handle, MLX90614_DUTY_TEST_PERIOD_MS, NULL);
+        if (res != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614: duty init failed.\n");
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = mlx90614_duty_sample(&duty, &ambient_raw, &ambient, &object_raw, &object);
+        (void)mlx90614_duty_get_stats(&duty, &stats);
+        mlx90614_interface_debug_print("mlx90614: timeout returns %d, failures %d.\n", res, stats.failures);
+        if ((res != 4) || (stats.samples != 0) || (stats.failures != 1) ||
+            (stats.latency_ms != MLX90614_WAKE_SETTLE_MS) || (mlx90614_bus_test_get_sleep() == 0))
+        {
+            mlx90614_interface_debug_print("mlx90614: timeout check failed.\n");
+            (void)mlx90614_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
+    /* finish duty test */
+    mlx90614_interface_debug_print("mlx90614: finish duty test.\n");
+    (void)mlx90614_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_emissivity_test.c
+ * @brief     driver mlx90614 emissivity test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_emissivity_test.h"
+#include <stdlib.h>
+
+#ifndef MLX90614_FIXED_POINT
+
+#include <math.h>
+
+/**
+ * @brief emissivity test definition
+ */
+#define MLX90614_EMISSIVITY_TEST_TARGETS        8            /**< target emissivities of one sample */
+#define MLX90614_EMISSIVITY_TEST_EXACT          0.005        /**< max error of the exact path in C */
+#define MLX90614_EMISSIVITY_TEST_BATCH          0.01         /**< max error of the batch path in C */
+#define MLX90614_EMISSIVITY_TEST_TRUE           0.25         /**< max error against the true temperature in C, 0.02K raw steps scaled by factory / emissivity */
+
+static mlx90614_emissivity_engine_t gs_engine;        /**< emissivity engine */
+
+/**
+ * @brief     get the raw data of a kelvin temperature
+ * @param[in] kelvin temperature in K
+ * @return    raw data
+ * @note      none
+ */
+static uint16_t a_mlx90614_emissivity_test_raw(double kelvin)
+{
+    return (uint16_t)(kelvin / 0.02 + 0.5);
+}
+
+/**
+ * @brief     get the closed form compensated temperature
+ * @param[in] factory factory emissivity
+ * @param[in] ambient_raw ambient raw data
+ * @param[in] object_raw object raw data
+ * @param[in] emissivity target emissivity
+ * @return    temperature in C
+ * @note      t^4 = ta^4 + factory / emissivity * (tobj^4 - ta^4)
+ */
+static double a_mlx90614_emissivity_test_reference(double factory, uint16_t ambient_raw, uint16_t object_raw, double emissivity)
+{
+    double ta4 = pow((double)ambient_raw * 0.02, 4.0);
+    double to4 = pow((double)object_raw * 0.02, 4.0);
+    
+    return pow(ta4 + factory / emissivity * (to4 - ta4), 0.25) - 273.15;
+}
+
+#endif
+
+/**
+ * @brief     emissivity engine test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the engine is fed with synthetic raw data from the closed form t^4 relation, no chip is needed,
+ *            the engine is float only and the test is skipped with MLX90614_FIXED_POINT
+ */
+uint8_t mlx90614_emissivity_test(uint32_t times)
+{
+#ifndef MLX90614_FIXED_POINT
+    uint8_t res;
+    uint32_t t;
+    uint32_t i;
+    uint32_t checked;
+    int32_t ta;
+    int32_t obj;
+    double factory;
+    double max_exact;
+    double max_batch;
+    double max_true;
+    float celsius;
+    float emissivity[MLX90614_EMISSIVITY_TEST_TARGETS];
+    float out[MLX90614_EMISSIVITY_TEST_TARGETS];
+    const uint16_t factory_reg[2] = {0xFFFF, 0xF332};
+    
+    /* start emissivity test */
+    mlx90614_interface_debug_print("mlx90614: start emissivity test.\n");
+    
+    for (t = 0; t < times; t++)
+    {
+        /* init with the factory emissivity */
+        res = mlx90614_emissivity_init(&gs_engine, factory_reg[t % 2]);
+        if (res != 0)
+        {
+            mlx90614_interface_debug_print("mlx90614: emissivity init failed.\n");
+            
+            return 1;
+        }
+        factory = (double)factory_reg[t % 2] / 65535.0;
+        for (i = 0; i < MLX90614_EMISSIVITY_TEST_TARGETS; i++)
+        {
+            emissivity[i] = 0.3f + 0.7f * (float)(rand() % 1001) / 1000.0f;
+        }
+        
+        /* ta -40C to 125C, true object -70C to 380C */
+        checked = 0;
+        max_exact = 0.0;
+        max_batch = 0.0;
+        max_true = 0.0;
+        for (ta = -40; ta <= 125; ta += 15)
+        {
+            for (obj = -70; obj <= 380; obj += 10)
+            {
+                uint16_t ambient_raw = a_mlx90614_emissivity_test_raw((double)ta + 273.15);
+                double ta4 = pow((double)ambient_raw * 0.02, 4.0);
+                double t4 = pow((double)obj + 273.15, 4.0);
+                
+                for (i = 0; i < MLX90614_EMISSIVITY_TEST_TARGETS; i++)
+                {
+                    double to4;
+                    double ref;
+                    uint16_t object_raw;
+                    
+                    /* the object raw data the chip reports with the factory emissivity */
+                    to4 = ta4 + (double)emissivity[i] / factory * (t4 - ta4);
+                    if (to4 <= 0.0)
+                    {
+                        continue;
+                    }
+                    object_raw = a_mlx90614_emissivity_test_raw(pow(to4, 0.25));
+                    if ((object_raw & 0x8000) != 0)
+                    {
+                        continue;
+                    }
+                    
+                    /* exact path */
+                    res = mlx90614_emissivity_compensate(&gs_engine, ambient_raw, object_raw, emissivity[i], &celsius);
+                    if (res != 0)
+                    {
+                        mlx90614_interface_debug_print("mlx90614: emissivity compensate failed %d.\n", res);
+                        
+                        return 1;
+                    }
+                    ref = a_mlx90614_emissivity_test_reference(factory, ambient_raw, object_raw, (double)emissivity[i]);
+                    max_exact = fmax(max_exact, fabs((double)celsius - ref));
+                    max_true = fmax(max_true, fabs((double)celsius - (double)obj));
+                    
+                    /* batch path */
+                    res = mlx90614_emissivity_compensate_batch(&gs_engine, ambient_raw, object_raw, &emissivity[i], out, 1);
+                    if (res != 0)
+                    {
+                        mlx90614_interface_debug_print("mlx90614: emissivity compensate batch failed %d.\n", res);
+                        
+                        return 1;
+                    }
+                    max_batch = fmax(max_batch, fabs((double)out[0] - ref));
+                    checked++;
+                }
+            }
+        }
+        
+        /* output */
+        mlx90614_interface_debug_print("mlx90614: %d/%d factory %0.4f checked %d samples.\n", t + 1, times, factory, checked);
+        mlx90614_interface_debug_print("mlx90614: max error exact %0.4fC batch %0.4fC true %0.4fC.\n", max_exact, max_batch, max_true);
+        if ((checked == 0) || (max_exact > MLX90614_EMISSIVITY_TEST_EXACT) ||
+            (max_batch > MLX90614_EMISSIVITY_TEST_BATCH) || (max_true > MLX90614_EMISSIVITY_TEST_TRUE))
+        {
+            mlx90614_interface_debug_print("mlx90614: emissivity round trip check failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* invalid input */
+    mlx90614_interface_debug_print("mlx90614: invalid input test.\n");
+    emissivity[0] = 0.9f;
+    emissivity[1] = 0.0f;
+    emissivity[2] = 1.5f;
+    if ((mlx90614_emissivity_compensate(&gs_engine, 14915, 0x8000 | 15000, 0.9f, &celsius) != 4) ||
+        (mlx90614_emissivity_compensate(&gs_engine, 14915, 15000, 0.0f, &celsius) != 5) ||
+        (mlx90614_emissivity_compensate(&gs_engine, 14915, 15000, 1.5f, &celsius) != 5))
+    {
+        mlx90614_interface_debug_print("mlx90614: invalid input check failed.\n");
+        
+        return 1;
+    }
+    if ((mlx90614_emissivity_compensate_batch(&gs_engine, 14915, 15000, emissivity, out, 3) != 6) ||
+        isnan(out[0]) || !isnan(out[1]) || !isnan(out[2]))
+    {
+        mlx90614_interface_debug_print("mlx90614: invalid batch check failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish emissivity test */
+    mlx90614_interface_debug_print("mlx90614: finish emissivity test.\n");
+#else
+    (void)times;
+    mlx90614_interface_debug_print("mlx90614: emissivity engine is float only, skip the test.\n");
+#endif
+    
+    return 0;
+}
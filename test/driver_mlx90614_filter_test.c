@@ -0,0 +1,388 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_filter_test.c
+ * @brief     driver mlx90614 filter test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_filter_test.h"
+#include <stdlib.h>
+#include <math.h>
+
+/**
+ * @brief filter test definition
+ */
+#define MLX90614_FILTER_TEST_SAMPLES        512        /**< samples of one stream */
+#ifdef MLX90614_FIXED_POINT
+#define MLX90614_FILTER_TEST_TEMPERATURE(c)        ((mlx90614_temperature_t)(c) * (MLX90614_FIXED_POINT / 100))        /**< centi celsius to temperature */
+#define MLX90614_FILTER_TEST_CELSIUS(t)            ((double)(t) / (double)MLX90614_FIXED_POINT)                         /**< temperature to celsius */
+#define MLX90614_FILTER_TEST_EMA_ERROR             (1.0 / (double)MLX90614_FIXED_POINT)                                 /**< max ema error in C */
+#else
+#define MLX90614_FILTER_TEST_TEMPERATURE(c)        ((mlx90614_temperature_t)(c) / 100.0f)                               /**< centi celsius to temperature */
+#define MLX90614_FILTER_TEST_CELSIUS(t)            ((double)(t))                                                        /**< temperature to celsius */
+#define MLX90614_FILTER_TEST_EMA_ERROR             0.001                                                                /**< max ema error in C */
+#define MLX90614_FILTER_TEST_KALMAN_ERROR          0.001                                                                /**< max kalman error in C */
+#endif
+
+static mlx90614_temperature_t gs_input[MLX90614_FILTER_TEST_SAMPLES];        /**< input stream */
+static mlx90614_temperature_t gs_stage[MLX90614_FILTER_TEST_SAMPLES];        /**< first stage output stream */
+
+/**
+ * @brief  get a synthetic stream
+ * @note   a slow ramp with noise and single sample spikes
+ */
+static void a_mlx90614_filter_test_stream(void)
+{
+    int32_t i;
+    int32_t c;
+    
+    for (i = 0; i < MLX90614_FILTER_TEST_SAMPLES; i++)
+    {
+        c = 2500 + i * 3 + (rand() % 41) - 20;
+        if ((rand() % 17) == 0)
+        {
+            c += ((rand() % 2) != 0) ? 3000 : -3000;
+        }
+        gs_input[i] = MLX90614_FILTER_TEST_TEMPERATURE(c);
+    }
+}
+
+/**
+ * @brief     get the reference median of the samples before an index
+ * @param[in] *input pointer to an input stream
+ * @param[in] i sample index
+ * @param[in] len window length
+ * @return    median
+ * @note      sorts a copy of the window, an even window returns the mean of the two middle samples
+ */
+static mlx90614_temperature_t a_mlx90614_filter_test_median(const mlx90614_temperature_t *input, int32_t i, uint8_t len)
+{
+    mlx90614_temperature_t w[MLX90614_FILTER_WINDOW_MAX];
+    mlx90614_temperature_t t;
+    int32_t n;
+    int32_t j;
+    int32_t k;
+    
+    n = ((i + 1) < len) ? (i + 1) : len;
+    for (j = 0; j < n; j++)
+    {
+        w[j] = input[i - j];
+    }
+    for (j = 1; j < n; j++)
+    {
+        for (k = j; (k > 0) && (w[k - 1] > w[k]); k--)
+        {
+            t = w[k];
+            w[k] = w[k - 1];
+            w[k - 1] = t;
+        }
+    }
+    if ((n % 2) != 0)
+    {
+        return w[n / 2];
+    }
+#ifdef MLX90614_FIXED_POINT
+    return (mlx90614_temperature_t)(((int64_t)w[n / 2 - 1] + (int64_t)w[n / 2]) / 2);
+#else
+    return (w[n / 2 - 1] + w[n / 2]) * 0.5f;
+#endif
+}
+
+/**
+ * @brief     get the reference box mean of the samples before an index
+ * @param[in] *input pointer to an input stream
+ * @param[in] i sample index
+ * @param[in] len window length
+ * @return    mean in C
+ * @note      none
+ */
+static double a_mlx90614_filter_test_box(const mlx90614_temperature_t *input, int32_t i, uint8_t len)
+{
+    double sum;
+    int32_t n;
+    int32_t j;
+    
+    n = ((i + 1) < len) ? (i + 1) : len;
+    sum = 0.0;
+    for (j = 0; j < n; j++)
+    {
+        sum += MLX90614_FILTER_TEST_CELSIUS(input[i - j]);
+    }
+    
+    return sum / (double)n;
+}
+
+/**
+ * @brief     filter test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the filters are fed with synthetic sample streams and checked against reference models, no chip is needed
+ */
+uint8_t mlx90614_filter_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t len;
+    uint32_t t;
+    int32_t i;
+    double ref;
+    double err;
+    double max_err;
+#ifndef MLX90614_FIXED_POINT
+    double p;
+    double k;
+#endif
+    mlx90614_temperature_t out;
+    mlx90614_filter_t filter;
+    mlx90614_filter_t median;
+    mlx90614_filter_t box;
+    mlx90614_filter_pipeline_t pipeline;
+    const int32_t known_in[6] = {1000, 5000, 2000, 3000, 10000, 4000};
+    const int32_t known_out[6] = {1000, 3000, 2000, 3000, 3000, 4000};
+    
+    /* start filter test */
+    mlx90614_interface_debug_print("mlx90614: start filter test.\n");
+    
+    /* known median output */
+    mlx90614_interface_debug_print("mlx90614: median known output test.\n");
+    res = mlx90614_filter_median_init(&filter, 3);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: filter median init failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 6; i++)
+    {
+        (void)mlx90614_filter_update(&filter, MLX90614_FILTER_TEST_TEMPERATURE(known_in[i]), &out);
+        mlx90614_interface_debug_print("mlx90614: median in %0.2fC out %0.2fC.\n",
+                                       MLX90614_FILTER_TEST_CELSIUS(MLX90614_FILTER_TEST_TEMPERATURE(known_in[i])),
+                                       MLX90614_FILTER_TEST_CELSIUS(out));
+        if (out != MLX90614_FILTER_TEST_TEMPERATURE(known_out[i]))
+        {
+            mlx90614_interface_debug_print("mlx90614: median known output check failed.\n");
+            
+            return 1;
+        }
+    }
+    
+#ifndef MLX90614_FIXED_POINT
+    /* known kalman output */
+    mlx90614_interface_debug_print("mlx90614: kalman known output test.\n");
+    res = mlx90614_filter_kalman_init(&filter, 0.01f, 1.0f);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: filter kalman init failed.\n");
+        
+        return 1;
+    }
+    
+    /* 10C, then a 20C step, then 20C with alternating 1C noise */
+    for (i = 0; i < 64; i++)
+    {
+        mlx90614_temperature_t in = (i == 0) ? 10.0f : (((i % 2) != 0) ? 21.0f : 19.0f);
+        
+        (void)mlx90614_filter_update(&filter, in, &out);
+        if (i == 1)
+        {
+            /* p = 1 + 0.01, k = p / (p + 1) */
+            if (fabs((double)out - (10.0 + 1.01 / 2.01 * 11.0)) > MLX90614_FILTER_TEST_KALMAN_ERROR)
+            {
+                mlx90614_interface_debug_print("mlx90614: kalman known output check failed.\n");
+                
+                return 1;
+            }
+        }
+    }
+    mlx90614_interface_debug_print("mlx90614: kalman settles at %0.3fC.\n", out);
+    if (fabs((double)out - 20.0) > 0.2)
+    {
+        mlx90614_interface_debug_print("mlx90614: kalman settle check failed.\n");
+        
+        return 1;
+    }
+#endif
+    
+    for (t = 0; t < times; t++)
+    {
+        mlx90614_interface_debug_print("mlx90614: %d/%d.\n", t + 1, times);
+        a_mlx90614_filter_test_stream();
+        
+        /* median and box of every window length */
+        for (len = 1; len <= MLX90614_FILTER_WINDOW_MAX; len++)
+        {
+            (void)mlx90614_filter_median_init(&median, len);
+            (void)mlx90614_filter_box_init(&box, len);
+            max_err = 0.0;
+            for (i = 0; i < MLX90614_FILTER_TEST_SAMPLES; i++)
+            {
+                (void)mlx90614_filter_update(&median, gs_input[i], &out);
+                if (out != a_mlx90614_filter_test_median(gs_input, i, len))
+                {
+                    mlx90614_interface_debug_print("mlx90614: median len %d sample %d check failed.\n", len, i);
+                    
+                    return 1;
+                }
+                (void)mlx90614_filter_update(&box, gs_input[i], &out);
+                err = fabs(MLX90614_FILTER_TEST_CELSIUS(out) - a_mlx90614_filter_test_box(gs_input, i, len));
+                max_err = (err > max_err) ? err : max_err;
+            }
+#ifdef MLX90614_FIXED_POINT
+            if (max_err >= MLX90614_FILTER_TEST_CELSIUS(1))
+#else
+            if (max_err > 0.001)
+#endif
+            {
+                mlx90614_interface_debug_print("mlx90614: box len %d error %0.4fC check failed.\n", len, max_err);
+                
+                return 1;
+            }
+        }
+        mlx90614_interface_debug_print("mlx90614: median and box windows 1 to %d check ok.\n", MLX90614_FILTER_WINDOW_MAX);
+        
+        /* ema */
+        (void)mlx90614_filter_ema_init(&filter, 32);
+        max_err = 0.0;
+        ref = 0.0;
+        for (i = 0; i < MLX90614_FILTER_TEST_SAMPLES; i++)
+        {
+            (void)mlx90614_filter_update(&filter, gs_input[i], &out);
+            ref = (i == 0) ? MLX90614_FILTER_TEST_CELSIUS(gs_input[i]) :
+                             (ref + (MLX90614_FILTER_TEST_CELSIUS(gs_input[i]) - ref) * 32.0 / 256.0);
+            err = fabs(MLX90614_FILTER_TEST_CELSIUS(out) - ref);
+            max_err = (err > max_err) ? err : max_err;
+        }
+        mlx90614_interface_debug_print("mlx90614: ema max error %0.4fC.\n", max_err);
+        if (max_err > MLX90614_FILTER_TEST_EMA_ERROR)
+        {
+            mlx90614_interface_debug_print("mlx90614: ema check failed.\n");
+            
+            return 1;
+        }
+        
+#ifndef MLX90614_FIXED_POINT
+        /* kalman */
+        (void)mlx90614_filter_kalman_init(&filter, 0.05f, 4.0f);
+        max_err = 0.0;
+        ref = 0.0;
+        p = 0.0;
+        for (i = 0; i < MLX90614_FILTER_TEST_SAMPLES; i++)
+        {
+            (void)mlx90614_filter_update(&filter, gs_input[i], &out);
+            if (i == 0)
+            {
+                ref = gs_input[i];
+                p = 4.0;
+            }
+            else
+            {
+                p += 0.05;
+                k = p / (p + 4.0);
+                ref += k * ((double)gs_input[i] - ref);
+                p *= 1.0 - k;
+            }
+            err = fabs((double)out - ref);
+            max_err = (err > max_err) ? err : max_err;
+        }
+        mlx90614_interface_debug_print("mlx90614: kalman max error %0.4fC.\n", max_err);
+        if (max_err > MLX90614_FILTER_TEST_KALMAN_ERROR)
+        {
+            mlx90614_interface_debug_print("mlx90614: kalman check failed.\n");
+            
+            return 1;
+        }
+#endif
+        
+        /* median 5 then box 4 pipeline against the single stages */
+        (void)mlx90614_filter_pipeline_init(&pipeline);
+        (void)mlx90614_filter_median_init(&median, 5);
+        (void)mlx90614_filter_box_init(&box, 4);
+        (void)mlx90614_filter_pipeline_add(&pipeline, &median);
+        (void)mlx90614_filter_pipeline_add(&pipeline, &box);
+        (void)mlx90614_filter_median_init(&filter, 5);
+        for (i = 0; i < MLX90614_FILTER_TEST_SAMPLES; i++)
+        {
+            (void)mlx90614_filter_update(&filter, gs_input[i], &gs_stage[i]);
+        }
+        for (i = 0; i < MLX90614_FILTER_TEST_SAMPLES; i++)
+        {
+            if (i == (MLX90614_FILTER_TEST_SAMPLES / 2))
+            {
+                /* the first sample after a reset passes through */
+                (void)mlx90614_filter_pipeline_reset(&pipeline);
+                (void)mlx90614_filter_pipeline_update(&pipeline, gs_input[i], &out);
+                if (out != gs_input[i])
+                {
+                    mlx90614_interface_debug_print("mlx90614: pipeline reset check failed.\n");
+                    
+                    return 1;
+                }
+                break;
+            }
+            (void)mlx90614_filter_pipeline_update(&pipeline, gs_input[i], &out);
+            err = fabs(MLX90614_FILTER_TEST_CELSIUS(out) - a_mlx90614_filter_test_box(gs_stage, i, 4));
+#ifdef MLX90614_FIXED_POINT
+            if (err >= MLX90614_FILTER_TEST_CELSIUS(1))
+#else
+            if (err > 0.001)
+#endif
+            {
+                mlx90614_interface_debug_print("mlx90614: pipeline sample %d check failed.\n", i);
+                
+                return 1;
+            }
+        }
+        mlx90614_interface_debug_print("mlx90614: stream filters and pipeline check ok.\n");
+    }
+    
+    /* invalid input */
+    mlx90614_interface_debug_print("mlx90614: invalid input test.\n");
+    if ((mlx90614_filter_median_init(&filter, 0) != 4) ||
+        (mlx90614_filter_box_init(&filter, MLX90614_FILTER_WINDOW_MAX + 1) != 4) ||
+        (mlx90614_filter_ema_init(&filter, 257) != 4)
+#ifndef MLX90614_FIXED_POINT
+        || (mlx90614_filter_kalman_init(&filter, 0.1f, 0.0f) != 4)
+#endif
+       )
+    {
+        mlx90614_interface_debug_print("mlx90614: invalid input check failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish filter test */
+    mlx90614_interface_debug_print("mlx90614: finish filter test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,345 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ *
+ * @file      driver_mlx90614_pwm_test.c
+ * @brief     driver mlx90614 pwm test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mlx90614_pwm_test.h"
+#include <stdlib.h>
+
+/**
+ * @brief pwm test definition
+ */
+#define MLX90614_PWM_TEST_PERIOD_NS        10240000        /**< 10.24 ms period */
+#define MLX90614_PWM_TEST_JITTER_NS        500             /**< max edge jitter */
+#define MLX90614_PWM_TEST_PERIODS          1000            /**< periods of one round */
+
+static uint64_t gs_time_ns;        /**< synthetic clock */
+
+/**
+ * @brief  get the edge jitter
+ * @return jitter in ns
+ * @note   none
+ */
+static int64_t a_mlx90614_pwm_test_jitter(void)
+{
+    return (int64_t)(rand() % (2 * MLX90614_PWM_TEST_JITTER_NS + 1)) - MLX90614_PWM_TEST_JITTER_NS;
+}
+
+/**
+ * @brief      feed one synthetic period to the decoder
+ * @param[in]  *decoder pointer to a decoder structure
+ * @param[in]  period period in ns
+ * @param[in]  high high time in ns
+ * @param[out] *sample pointer to a sample structure
+ * @return     the result of the rising edge that ends the previous period
+ * @note       none
+ */
+static uint8_t a_mlx90614_pwm_test_period(mlx90614_pwm_decoder_t *decoder, uint64_t period, uint64_t high,
+                                          mlx90614_pwm_sample_t *sample)
+{
+    uint8_t res;
+    
+    res = mlx90614_pwm_decoder_push(decoder, gs_time_ns + a_mlx90614_pwm_test_jitter(), 1, sample);
+    (void)mlx90614_pwm_decoder_push(decoder, gs_time_ns + high + a_mlx90614_pwm_test_jitter(), 0, sample);
+    gs_time_ns += period;
+    
+    return res;
+}
+
+/**
+ * @brief     get the high time of a temperature
+ * @param[in] centi_kelvin temperature in 0.01 K
+ * @param[in] min scale min in 0.01 K
+ * @param[in] range scale range in 0.01 K
+ * @return    high time in ns
+ * @note      none
+ */
+static uint64_t a_mlx90614_pwm_test_high(int32_t centi_kelvin, int32_t min, int32_t range)
+{
+    uint64_t span = (uint64_t)MLX90614_PWM_TEST_PERIOD_NS * 3 / 4;
+    
+    return MLX90614_PWM_TEST_PERIOD_NS / 8 + (uint64_t)(centi_kelvin - min) * span / (uint64_t)range;
+}
+
+/**
+ * @brief     pwm decoder test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the decoder is fed with synthetic edge streams, no chip is needed
+ */
+uint8_t mlx90614_pwm_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t t;
+    uint32_t i;
+    uint32_t g;
+    uint32_t glitches;
+    int32_t expect;
+    int32_t diff;
+    int32_t max_diff;
+    int32_t ta_min;
+    int32_t ta_range;
+    int32_t target[2];
+    mlx90614_pwm_decoder_t decoder;
+    mlx90614_pwm_decoder_config_t config;
+    mlx90614_pwm_sample_t sample;
+    
+    /* start pwm test */
+    mlx90614_interface_debug_print("mlx90614: start pwm test.\n");
+    
+    /* single pwm with a -20C to 120C object range */
+    memset(&config, 0, sizeof(config));
+    config.ctrl.mode = MLX90614_PWM_MODE_SINGLE;
+    config.ctrl.enable = MLX90614_BOOL_TRUE;
+    config.ctrl.output = MLX90614_PWM_OUTPUT_PWM;
+    config.mode = MLX90614_MODE_TA_TOBJ1;
+    config.to_min = 25315;
+    config.to_max = 39315;
+    config.ta_min = 28;
+    config.ta_max = 247;
+    if (mlx90614_pwm_decoder_init(&decoder, &config) != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: decoder init failed.\n");
+        
+        return 1;
+    }
+    mlx90614_interface_debug_print("mlx90614: single pwm test.\n");
+    for (t = 0; t < times; t++)
+    {
+        max_diff = 0;
+        expect = -1;
+        for (i = 0; i < MLX90614_PWM_TEST_PERIODS; i++)
+        {
+            int32_t next = 25315 + rand() % 14001;
+            
+            res = a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS,
+                                             a_mlx90614_pwm_test_high(next, 25315, 14000), &sample);
+            if ((res == 0) && (expect >= 0))
+            {
+                if (sample.source != MLX90614_PWM_SOURCE_TOBJ1)
+                {
+                    mlx90614_interface_debug_print("mlx90614: source check failed.\n");
+                    
+                    return 1;
+                }
+                diff = abs((int32_t)sample.raw * 2 - expect);
+                max_diff = (diff > max_diff) ? diff : max_diff;
+            }
+            else if ((res != 4) && (expect >= 0))
+            {
+                mlx90614_interface_debug_print("mlx90614: decode failed %d.\n", res);
+                
+                return 1;
+            }
+            else
+            {
+                /* the first period has no sample */
+            }
+            expect = next;
+        }
+        mlx90614_interface_debug_print("mlx90614: %d/%d max error is %d.%02dK.\n", t + 1, times, max_diff / 100, max_diff % 100);
+        if (max_diff > 4)
+        {
+            mlx90614_interface_debug_print("mlx90614: single pwm check failed.\n");
+            
+            return 1;
+        }
+    }
+    
+    /* extended pwm with ta and tobj1 */
+    mlx90614_interface_debug_print("mlx90614: extended pwm test.\n");
+    config.ctrl.mode = MLX90614_PWM_MODE_EXTENDED;
+    if (mlx90614_pwm_decoder_init(&decoder, &config) != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: decoder init failed.\n");
+        
+        return 1;
+    }
+    ta_min = 28 * 64 - 3820 + 27315;
+    ta_range = (247 - 28) * 64;
+    max_diff = 0;
+    target[0] = 29815;
+    target[1] = 31315;
+    (void)a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS,
+                                     a_mlx90614_pwm_test_high(target[0], ta_min, ta_range), &sample);
+    (void)a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS,
+                                     a_mlx90614_pwm_test_high(target[1], 25315, 14000), &sample);
+    for (i = 0; i < 2 * times; i++)
+    {
+        res = a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS,
+                                         a_mlx90614_pwm_test_high(target[i % 2], (i % 2) ? 25315 : ta_min,
+                                                                  (i % 2) ? 14000 : ta_range), &sample);
+        if ((res != 0) || (sample.source != ((i % 2) ? MLX90614_PWM_SOURCE_TA : MLX90614_PWM_SOURCE_TOBJ1)))
+        {
+            mlx90614_interface_debug_print("mlx90614: extended pwm frame check failed.\n");
+            
+            return 1;
+        }
+        diff = abs((int32_t)sample.raw * 2 - target[(i + 1) % 2]);
+        max_diff = (diff > max_diff) ? diff : max_diff;
+    }
+    mlx90614_interface_debug_print("mlx90614: max error is %d.%02dK.\n", max_diff / 100, max_diff % 100);
+    if (max_diff > 4)
+    {
+        mlx90614_interface_debug_print("mlx90614: extended pwm check failed.\n");
+        
+        return 1;
+    }
+    
+    /* a glitch, a lost period and a second falling edge in a ta period keep the extended pwm phase */
+    mlx90614_interface_debug_print("mlx90614: extended pwm glitch test.\n");
+    glitches = decoder.glitches;
+    for (g = 0; g < 3; g++)
+    {
+        if (g == 0)
+        {
+            (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns, 1, &sample);
+            (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns + a_mlx90614_pwm_test_high(target[0], ta_min, ta_range), 0, &sample);
+            (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns + MLX90614_PWM_TEST_PERIOD_NS * 3 / 4, 1, &sample);
+            (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns + MLX90614_PWM_TEST_PERIOD_NS * 3 / 4 + 100000, 0, &sample);
+        }
+        else if (g == 2)
+        {
+            (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns, 1, &sample);
+            (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns + a_mlx90614_pwm_test_high(target[0], ta_min, ta_range), 0, &sample);
+            (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns + MLX90614_PWM_TEST_PERIOD_NS * 7 / 8, 0, &sample);
+        }
+        else
+        {
+            /* the edges of the ta period are lost */
+        }
+        gs_time_ns += MLX90614_PWM_TEST_PERIOD_NS;
+        
+        /* the next period is tobj1, a decoder that restarts at the first frame swaps the sources */
+        for (i = 0; i < 5; i++)
+        {
+            res = a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS,
+                                             a_mlx90614_pwm_test_high(target[(i + 1) % 2], (i % 2) ? ta_min : 25315,
+                                                                      (i % 2) ? ta_range : 14000), &sample);
+            if ((i != 0) &&
+                ((res != 0) || (sample.source != ((i % 2) ? MLX90614_PWM_SOURCE_TOBJ1 : MLX90614_PWM_SOURCE_TA)) ||
+                 (abs((int32_t)sample.raw * 2 - target[i % 2]) > 4)))
+            {
+                mlx90614_interface_debug_print("mlx90614: extended pwm glitch %d frame check failed.\n", g);
+                
+                return 1;
+            }
+        }
+    }
+    /* the pulse splits one period in two rejected ones */
+    if (decoder.glitches != glitches + 4)
+    {
+        mlx90614_interface_debug_print("mlx90614: extended pwm glitch count check failed.\n");
+        
+        return 1;
+    }
+    mlx90614_interface_debug_print("mlx90614: %d glitches keep the phase.\n", decoder.glitches - glitches);
+    
+    /* glitch */
+    mlx90614_interface_debug_print("mlx90614: glitch test.\n");
+    config.ctrl.mode = MLX90614_PWM_MODE_SINGLE;
+    (void)mlx90614_pwm_decoder_init(&decoder, &config);
+    for (i = 0; i < 4; i++)
+    {
+        (void)a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS,
+                                         a_mlx90614_pwm_test_high(31315, 25315, 14000), &sample);
+    }
+    (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns, 1, &sample);
+    (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns + MLX90614_PWM_TEST_PERIOD_NS / 2, 0, &sample);
+    res = mlx90614_pwm_decoder_push(&decoder, gs_time_ns + MLX90614_PWM_TEST_PERIOD_NS * 3 / 4, 1, &sample);
+    (void)mlx90614_pwm_decoder_push(&decoder, gs_time_ns + MLX90614_PWM_TEST_PERIOD_NS * 3 / 4 + 100000, 0, &sample);
+    gs_time_ns += MLX90614_PWM_TEST_PERIOD_NS;
+    if (res != 5)
+    {
+        mlx90614_interface_debug_print("mlx90614: glitch check failed.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 3; i++)
+    {
+        res = a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS,
+                                         a_mlx90614_pwm_test_high(31315, 25315, 14000), &sample);
+    }
+    if ((res != 0) || (abs((int32_t)sample.raw * 2 - 31315) > 4) || (decoder.glitches == 0))
+    {
+        mlx90614_interface_debug_print("mlx90614: glitch recovery check failed.\n");
+        
+        return 1;
+    }
+    mlx90614_interface_debug_print("mlx90614: %d glitches are rejected.\n", decoder.glitches);
+    
+    /* period change */
+    mlx90614_interface_debug_print("mlx90614: period change test.\n");
+    for (i = 0; i < 4; i++)
+    {
+        res = a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS / 2,
+                                         a_mlx90614_pwm_test_high(31315, 25315, 14000) / 2, &sample);
+    }
+    if ((res != 0) || (abs((int32_t)sample.raw * 2 - 31315) > 4))
+    {
+        mlx90614_interface_debug_print("mlx90614: period change check failed.\n");
+        
+        return 1;
+    }
+    
+    /* error band */
+    mlx90614_interface_debug_print("mlx90614: error band test.\n");
+    (void)a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS / 2,
+                                     MLX90614_PWM_TEST_PERIOD_NS / 2 * 31 / 32, &sample);
+    res = a_mlx90614_pwm_test_period(&decoder, MLX90614_PWM_TEST_PERIOD_NS / 2,
+                                     a_mlx90614_pwm_test_high(31315, 25315, 14000) / 2, &sample);
+    if (res != 6)
+    {
+        mlx90614_interface_debug_print("mlx90614: error band check failed.\n");
+        
+        return 1;
+    }
+    
+    /* thermal relay is not decoded */
+    config.ctrl.output = MLX90614_PWM_OUTPUT_THERMAL_RELAY;
+    if (mlx90614_pwm_decoder_init(&decoder, &config) != 4)
+    {
+        mlx90614_interface_debug_print("mlx90614: thermal relay check failed.\n");
+        
+        return 1;
+    }
+    
+    /* finish pwm test */
+    mlx90614_interface_debug_print("mlx90614: finish pwm test.\n");
+    
+    return 0;
+}
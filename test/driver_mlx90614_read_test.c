@@ -37,8 +37,77 @@
 #include "driver_mlx90614_read_test.h"
 #include <stdlib.h>
 
+/**
+ * @brief read test print definition
+ * @note  the fixed point build reports 1 / MLX90614_FIXED_POINT celsius
+ */
+#ifdef MLX90614_FIXED_POINT
+#define MLX90614_READ_TEST_CELSIUS(t)        ((float)(t) / (float)MLX90614_FIXED_POINT)        /**< temperature to print */
+#else
+#define MLX90614_READ_TEST_CELSIUS(t)        (t)                                                 /**< temperature to print */
+#endif
+
 static mlx90614_handle_t gs_handle;        /**< mlx90614 handle */
 
+/**
+ * @brief  wait until the data of the current filter setting is settled
+ * @return status code
+ *         - 0 success
+ *         - 1 wait failed
+ * @note   a timeout is reported and the test goes on
+ */
+static uint8_t a_mlx90614_read_test_wait_ready(void)
+{
+    uint8_t res;
+    uint8_t frames;
+    uint32_t ms;
+    uint32_t elapsed;
+    mlx90614_fir_length_t len;
+    mlx90614_iir_t iir;
+    
+    /* get the filter setting */
+    res = mlx90614_get_fir_length(&gs_handle, &len);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: get fir length failed.\n");
+        
+        return 1;
+    }
+    res = mlx90614_get_iir(&gs_handle, &iir);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: get iir failed.\n");
+        
+        return 1;
+    }
+    res = mlx90614_settling_model(&gs_handle, len, iir, &frames, &ms);
+    if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: settling model failed.\n");
+        
+        return 1;
+    }
+    
+    /* wait for the settled data */
+    res = mlx90614_wait_ready(&gs_handle, frames, 2 * ms + MLX90614_READY_TIMEOUT_MS, &elapsed);
+    if (res == 4)
+    {
+        mlx90614_interface_debug_print("mlx90614: wait ready timeout after %ums, model is %ums.\n", elapsed, ms);
+    }
+    else if (res != 0)
+    {
+        mlx90614_interface_debug_print("mlx90614: wait ready failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        mlx90614_interface_debug_print("mlx90614: ready after %ums, model is %ums.\n", elapsed, ms);
+    }
+    
+    return 0;
+}
+
 /**
  * @brief     read test
  * @param[in] times test times
@@ -50,9 +119,9 @@ static mlx90614_handle_t gs_handle;        /**< mlx90614 handle */
 uint8_t mlx90614_read_test(uint32_t times)
 {
     uint8_t res;
-    float ambient;
-    float object;
-    float object2;
+    mlx90614_temperature_t ambient;
+    mlx90614_temperature_t object;
+    mlx90614_temperature_t object2;
     uint16_t raw;
     uint16_t value;
     uint16_t raw2;
@@ -154,8 +223,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set fir length 8.\n");
         
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -164,7 +238,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -174,7 +248,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -194,7 +268,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -212,8 +286,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set fir length 16.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -222,7 +301,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -232,7 +311,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -252,7 +331,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -270,8 +349,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set fir length 32.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -280,7 +364,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -290,7 +374,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -310,7 +394,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -328,8 +412,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set fir length 64.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -338,7 +427,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -348,7 +437,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -368,7 +457,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -386,8 +475,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set fir length 128.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -396,7 +490,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -406,7 +500,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -426,7 +520,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -444,8 +538,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set fir length 256.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -454,7 +553,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -464,7 +563,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -484,7 +583,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -502,8 +601,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set fir length 512.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -512,7 +616,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -522,7 +626,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -542,7 +646,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -560,8 +664,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set fir length 1024.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -570,7 +679,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -580,7 +689,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -600,7 +709,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -618,8 +727,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set iir a1 0.5 b1 0.5.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -628,7 +742,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -638,7 +752,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -658,7 +772,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -676,8 +790,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set iir a1 0.25 b1 0.75.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -686,7 +805,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -696,7 +815,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -716,7 +835,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -734,8 +853,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set iir a1 0.166 b1 0.83.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -744,7 +868,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -754,7 +878,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -774,7 +898,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -792,8 +916,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set iir a1 0.125 b1 0.875.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -802,7 +931,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -812,7 +941,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -832,7 +961,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -850,8 +979,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set iir a1 1 b1 0.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -860,7 +994,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -870,7 +1004,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -890,7 +1024,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -908,8 +1042,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set iir a1 0.8 b1 0.2.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -918,7 +1057,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -928,7 +1067,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -948,7 +1087,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -966,8 +1105,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set iir a1 0.666 b1 0.333.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -976,7 +1120,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -986,7 +1130,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1006,7 +1150,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1024,8 +1168,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set iir a1 0.571 b1 0.428.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1034,7 +1183,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1044,7 +1193,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1064,7 +1213,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1082,8 +1231,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set ir sensor single.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1092,7 +1246,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1102,7 +1256,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1122,7 +1276,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1140,8 +1294,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set ir sensor dual.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1150,7 +1309,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1160,7 +1319,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1180,7 +1339,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1198,8 +1357,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set ks positive.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1208,7 +1372,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1218,7 +1382,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1238,7 +1402,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1256,8 +1420,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set ks negative.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1266,7 +1435,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1276,7 +1445,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1296,7 +1465,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1314,8 +1483,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set kt2 positive.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1324,7 +1498,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1334,7 +1508,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1354,7 +1528,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1372,8 +1546,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set kt2 negative.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1382,7 +1561,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1392,7 +1571,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1412,7 +1591,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1430,8 +1609,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set gain 1.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1440,7 +1624,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1450,7 +1634,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1470,7 +1654,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1488,8 +1672,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set gain 3.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1498,7 +1687,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1508,7 +1697,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1528,7 +1717,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1546,8 +1735,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set gain 6.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1556,7 +1750,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1566,7 +1760,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1586,7 +1780,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1604,8 +1798,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set gain 12.5.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1614,7 +1813,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1624,7 +1823,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1644,7 +1843,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1662,8 +1861,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set gain 25.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1672,7 +1876,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1682,7 +1886,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1702,7 +1906,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1720,8 +1924,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set gain 50.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1730,7 +1939,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1740,7 +1949,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1760,7 +1969,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1778,8 +1987,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set gain 100.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1788,7 +2002,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1798,7 +2012,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1818,7 +2032,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1836,8 +2050,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set emissivity correction coefficient %d.\n", value);
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1846,7 +2065,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1856,7 +2075,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1876,7 +2095,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1894,8 +2113,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set ta tobj1 mode.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1904,7 +2128,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1914,7 +2138,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -1934,7 +2158,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -1952,8 +2176,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set ta tobj2 mode.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -1962,7 +2191,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read ambient */
-        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (float *)&ambient);
+        res = mlx90614_read_ambient(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&ambient);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read ambient failed.\n");
@@ -1972,7 +2201,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object2 */
-        res = mlx90614_read_object2(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object2(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object2 failed.\n");
@@ -1992,7 +2221,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", ambient, object);
+        mlx90614_interface_debug_print("mlx90614: ambient is %0.2fC object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(ambient), MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -2010,8 +2239,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set tobj2 mode.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -2020,7 +2254,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read object2 */
-        res = mlx90614_read_object2(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object2(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object2 failed.\n");
@@ -2040,7 +2274,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: object is %0.2fC.\n", object);
+        mlx90614_interface_debug_print("mlx90614: object is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(object));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
@@ -2058,8 +2292,13 @@ uint8_t mlx90614_read_test(uint32_t times)
     }
     mlx90614_interface_debug_print("mlx90614: set tobj1 tobj2 mode.\n");
     
-    /* delay 3000 ms */
-    mlx90614_interface_delay_ms(3000);
+    /* wait for the settled data */
+    if (a_mlx90614_read_test_wait_ready() != 0)
+    {
+        (void)mlx90614_deinit(&gs_handle);
+        
+        return 1;
+    }
     
     /* read data */
     for (i = 0; i < times; i++)
@@ -2068,7 +2307,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         uint16_t channel_2;
         
         /* read object1 */
-        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (float *)&object);
+        res = mlx90614_read_object1(&gs_handle, (uint16_t *)&raw, (mlx90614_temperature_t *)&object);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object1 failed.\n");
@@ -2078,7 +2317,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* read object2 */
-        res = mlx90614_read_object2(&gs_handle, (uint16_t *)&raw2, (float *)&object2);
+        res = mlx90614_read_object2(&gs_handle, (uint16_t *)&raw2, (mlx90614_temperature_t *)&object2);
         if (res != 0)
         {
             mlx90614_interface_debug_print("mlx90614: read object2 failed.\n");
@@ -2098,7 +2337,7 @@ uint8_t mlx90614_read_test(uint32_t times)
         }
         
         /* print the data */
-        mlx90614_interface_debug_print("mlx90614: object1 is %0.2fC object2 is %0.2fC.\n", object, object2);
+        mlx90614_interface_debug_print("mlx90614: object1 is %0.2fC object2 is %0.2fC.\n", MLX90614_READ_TEST_CELSIUS(object), MLX90614_READ_TEST_CELSIUS(object2));
         mlx90614_interface_debug_print("mlx90614: channel1 raw is 0x%04X channel2 raw is 0x%04X.\n", channel_1, channel_2);
         
         /* delay 1000 ms */
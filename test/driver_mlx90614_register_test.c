@@ -51,7 +51,7 @@ uint8_t mlx90614_register_test(void)
     uint8_t res;
     uint8_t addr, addr_check;
     uint16_t value, value_check;
-    double s, s_check;
+    mlx90614_emissivity_t s, s_check;
     uint16_t id[4];
     uint16_t flag;
     mlx90614_fir_length_t len;
@@ -957,7 +957,11 @@ uint8_t mlx90614_register_test(void)
     /* mlx90614_emissivity_correction_coefficient_convert_to_register/mlx90614_emissivity_correction_coefficient_convert_to_data test */
     mlx90614_interface_debug_print("mlx90614: mlx90614_emissivity_correction_coefficient_convert_to_register/mlx90614_emissivity_correction_coefficient_convert_to_data test.\n");
     
+#ifdef MLX90614_FIXED_POINT
+    s = (mlx90614_emissivity_t)(rand() % (MLX90614_EMISSIVITY_SCALE + 1));
+#else
     s = (double)(rand() % 65536) / 65536.0;
+#endif
     res = mlx90614_emissivity_correction_coefficient_convert_to_register(&gs_handle, s, (uint16_t *)&value);
     if (res != 0)
     {
@@ -966,8 +970,12 @@ uint8_t mlx90614_register_test(void)
         
         return 1;
     }
+#ifdef MLX90614_FIXED_POINT
+    mlx90614_interface_debug_print("mlx90614: %u/%u convert to register 0x%02X.\n", s, MLX90614_EMISSIVITY_SCALE, value);
+#else
     mlx90614_interface_debug_print("mlx90614: %f convert to register 0x%02X.\n", s, value);
-    res = mlx90614_emissivity_correction_coefficient_convert_to_data(&gs_handle, value, (double *)&s_check);
+#endif
+    res = mlx90614_emissivity_correction_coefficient_convert_to_data(&gs_handle, value, (mlx90614_emissivity_t *)&s_check);
     if (res != 0)
     {
         mlx90614_interface_debug_print("mlx90614: emissivity correction coefficient convert to data failed.\n");
@@ -975,7 +983,11 @@ uint8_t mlx90614_register_test(void)
         
         return 1;
     }
+#ifdef MLX90614_FIXED_POINT
+    mlx90614_interface_debug_print("mlx90614: 0x%02X convert to data %u/%u.\n", value, s_check, MLX90614_EMISSIVITY_SCALE);
+#else
     mlx90614_interface_debug_print("mlx90614: 0x%02X convert to data %f.\n", value, s_check);
+#endif
     
     /* mlx90614_get_id test */
     mlx90614_interface_debug_print("mlx90614: mlx90614_get_id test.\n");